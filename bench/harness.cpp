@@ -0,0 +1,322 @@
+#include "harness.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#include "axiom/core/cpu.hpp"
+#include "axiom/core/parallel.hpp"
+
+namespace axiom::bench {
+    namespace {
+        using Clock = std::chrono::steady_clock;
+
+        double time_calls(const std::function<void()>& fn, const core::index calls) {
+            const auto start = Clock::now();
+            for (core::index i = 0; i < calls; ++i) fn();
+            return std::chrono::duration<double>(Clock::now() - start).count();
+        }
+
+        std::string format_time(const double s) {
+            char buf[32];
+            if (s < 1e-6) std::snprintf(buf, sizeof buf, "%8.1f ns", s * 1e9);
+            else if (s < 1e-3) std::snprintf(buf, sizeof buf, "%8.2f us", s * 1e6);
+            else if (s < 1.0) std::snprintf(buf, sizeof buf, "%8.2f ms", s * 1e3);
+            else std::snprintf(buf, sizeof buf, "%8.3f s ", s);
+            return buf;
+        }
+
+        void print_row(const Result& r) {
+            std::printf("%-40s %s %10.2f %10.2f\n", r.key().c_str(), format_time(r.seconds).c_str(), r.gflops(), r.gbps());
+            std::fflush(stdout);
+        }
+
+        std::string escape(const std::string& s) {
+            std::string out;
+            for (const char c : s) {
+                if (c == '"' || c == '\\') out += '\\';
+                out += c;
+            }
+            return out;
+        }
+
+        // reads back the JSON written by write_json (objects, arrays, strings, numbers, literals)
+        class Parser {
+        public:
+            explicit Parser(std::string text) : s_(std::move(text)) {}
+
+            Baseline baseline() {
+                Baseline out;
+                object([&](const std::string& key) {
+                    if (key == "isa") return void(out.isa = string());
+                    if (key == "threads") return void(out.threads = static_cast<core::index>(number()));
+                    if (key == "quick") return void(out.quick = boolean());
+                    if (key != "results") return skip();
+                    expect('[');
+                    if (peek() == ']') return void(++i_);
+                    do {
+                        Result r;
+                        object([&](const std::string& field) {
+                            if (field == "name") r.name = string();
+                            else if (field == "params") r.params = string();
+                            else if (field == "iterations") r.iterations = static_cast<core::index>(number());
+                            else if (field == "seconds") r.seconds = number();
+                            else if (field == "min_seconds") r.min_seconds = number();
+                            else if (field == "flops") r.flops = number();
+                            else if (field == "bytes") r.bytes = number();
+                            else skip();
+                        });
+                        out.results.push_back(std::move(r));
+                    } while (next(']'));
+                });
+                return out;
+            }
+
+        private:
+            std::string s_;
+            std::size_t i_ = 0;
+
+            [[noreturn]] void fail(const char* what) const {
+                throw std::runtime_error("read_json(): " + std::string(what) + " at offset " + std::to_string(i_));
+            }
+
+            char peek() {
+                while (i_ < s_.size() && std::isspace(static_cast<unsigned char>(s_[i_]))) ++i_;
+                if (i_ == s_.size()) fail("unexpected end");
+                return s_[i_];
+            }
+
+            void expect(const char c) {
+                if (peek() != c) fail("unexpected character");
+                ++i_;
+            }
+
+            // after an element: true on ',', false on the closing character
+            bool next(const char close) {
+                const char c = peek();
+                ++i_;
+                if (c == ',') return true;
+                if (c != close) fail("expected ',' or closing bracket");
+                return false;
+            }
+
+            template <typename F>
+            void object(F&& on_key) {
+                expect('{');
+                if (peek() == '}') return void(++i_);
+                do {
+                    const std::string key = string();
+                    expect(':');
+                    on_key(key);
+                } while (next('}'));
+            }
+
+            std::string string() {
+                expect('"');
+                std::string out;
+                while (i_ < s_.size() && s_[i_] != '"') {
+                    if (s_[i_] == '\\' && i_ + 1 < s_.size()) ++i_;
+                    out += s_[i_++];
+                }
+                if (i_ == s_.size()) fail("unterminated string");
+                ++i_;
+                return out;
+            }
+
+            bool boolean() {
+                peek();
+                for (const bool v : {true, false}) {
+                    const std::string word = v ? "true" : "false";
+                    if (s_.compare(i_, word.size(), word) == 0) {
+                        i_ += word.size();
+                        return v;
+                    }
+                }
+                fail("expected true or false");
+            }
+
+            double number() {
+                peek();
+                const char* begin = s_.c_str() + i_;
+                char* end = nullptr;
+                const double v = std::strtod(begin, &end);
+                if (end == begin) fail("expected a number");
+                i_ += end - begin;
+                return v;
+            }
+
+            void skip() {
+                const char c = peek();
+                if (c == '"') {
+                    string();
+                } else if (c == '{') {
+                    object([&](const std::string&) { skip(); });
+                } else if (c == '[') {
+                    ++i_;
+                    if (peek() == ']') return void(++i_);
+                    do skip(); while (next(']'));
+                } else if (std::isalpha(static_cast<unsigned char>(c))) {
+                    while (i_ < s_.size() && std::isalpha(static_cast<unsigned char>(s_[i_]))) ++i_;
+                } else {
+                    number();
+                }
+            }
+        };
+
+        [[noreturn]] void usage(const char* error) {
+            if (error) std::fprintf(stderr, "AxiomBench: %s\n\n", error);
+            std::fprintf(stderr,
+                "usage: AxiomBench [options]\n"
+                "  --filter=TEXT      only cases whose name/params contain TEXT\n"
+                "  --min-time=SEC     time spent per case (default 0.2)\n"
+                "  --samples=N        timed samples per case, the median is reported (default 5)\n"
+                "  --quick            smaller size sweep\n"
+                "  --threads=N        threads for the multithreaded cases (default all)\n"
+                "  --json=FILE        write results as JSON\n"
+                "  --baseline=FILE    compare against a JSON baseline, exit 1 on a regression\n"
+                "  --tolerance=FRAC   allowed slowdown against the baseline (default 0.10)\n"
+                "  --list             list the cases and exit\n");
+            std::exit(error ? 2 : 0);
+        }
+    }
+
+    void Suite::add(std::string name, std::string params, const double flops, const double bytes,
+                    std::function<std::function<void()>()> setup) {
+        cases_.push_back({std::move(name), std::move(params), flops, bytes, std::move(setup)});
+    }
+
+    std::vector<Result> Suite::run(const Options& options) const {
+        std::printf("%-40s %11s %10s %10s\n", "case", "time", "GFLOP/s", "GB/s");
+        std::vector<Result> results;
+        const core::index samples = std::max<core::index>(options.samples, 1);
+        for (const Case& c : cases_) {
+            Result r{c.name, c.params, 1, 0.0, 0.0, c.flops, c.bytes};
+            if (!options.filter.empty() && r.key().find(options.filter) == std::string::npos) continue;
+            const std::function<void()> fn = c.setup();
+
+            // warm up, then double the calls until one sample is long enough
+            const double target = options.min_time / static_cast<double>(samples);
+            double t = time_calls(fn, 1);
+            while (t < target && r.iterations < (core::index{1} << 30)) {
+                r.iterations = t <= 0.0 ? r.iterations * 2
+                    : std::max(r.iterations * 2, static_cast<core::index>(r.iterations * target / t * 1.2));
+                t = time_calls(fn, r.iterations);
+            }
+
+            std::vector<double> per_call(samples);
+            for (double& s : per_call) s = time_calls(fn, r.iterations) / static_cast<double>(r.iterations);
+            std::sort(per_call.begin(), per_call.end());
+            r.seconds = per_call[samples / 2];
+            r.min_seconds = per_call.front();
+            print_row(r);
+            results.push_back(std::move(r));
+        }
+        return results;
+    }
+
+    Options parse_options(const int argc, char** argv) {
+        Options o;
+        for (int a = 1; a < argc; ++a) {
+            const std::string arg = argv[a];
+            const auto eq = arg.find('=');
+            const std::string key = arg.substr(0, eq);
+            const std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+            const auto need_value = [&] { if (eq == std::string::npos) usage(("missing value for " + key).c_str()); };
+            try {
+                if (key == "--help" || key == "-h") usage(nullptr);
+                else if (key == "--quick") o.quick = true;
+                else if (key == "--list") o.list = true;
+                else if (key == "--filter") { need_value(); o.filter = value; }
+                else if (key == "--json") { need_value(); o.json = value; }
+                else if (key == "--baseline") { need_value(); o.baseline = value; }
+                else if (key == "--min-time") { need_value(); o.min_time = std::stod(value); }
+                else if (key == "--samples") { need_value(); o.samples = std::stoul(value); }
+                else if (key == "--threads") { need_value(); o.threads = std::stoul(value); }
+                else if (key == "--tolerance") { need_value(); o.tolerance = std::stod(value); }
+                else usage(("unknown option " + arg).c_str());
+            } catch (const std::logic_error&) {
+                usage(("invalid value for " + key).c_str());
+            }
+        }
+        if (o.threads == 0) o.threads = core::hardware_threads();
+        return o;
+    }
+
+    void write_json(const std::string& path, const std::vector<Result>& results, const Options& options) {
+        std::ofstream out(path);
+        if (!out) throw std::runtime_error("write_json(): cannot open " + path);
+        out.precision(9);
+        out << "{\n";
+        out << "  \"isa\": \"" << core::isa_name(core::active_isa()) << "\",\n";
+        out << "  \"threads\": " << options.threads << ",\n";
+        out << "  \"quick\": " << (options.quick ? "true" : "false") << ",\n";
+        out << "  \"results\": [";
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            const Result& r = results[i];
+            out << (i == 0 ? "\n" : ",\n");
+            out << "    {\"name\": \"" << escape(r.name) << "\", \"params\": \"" << escape(r.params) << "\""
+                << ", \"iterations\": " << r.iterations << ", \"seconds\": " << r.seconds
+                << ", \"min_seconds\": " << r.min_seconds << ", \"flops\": " << r.flops
+                << ", \"bytes\": " << r.bytes << ", \"gflops\": " << r.gflops() << ", \"gbps\": " << r.gbps() << "}";
+        }
+        out << "\n  ]\n}\n";
+        if (!out) throw std::runtime_error("write_json(): failed writing " + path);
+    }
+
+    Baseline read_json(const std::string& path) {
+        std::ifstream in(path);
+        if (!in) throw std::runtime_error("read_json(): cannot open " + path);
+        std::stringstream text;
+        text << in.rdbuf();
+        return Parser(text.str()).baseline();
+    }
+
+    void check_baseline(const Baseline& baseline, const Options& options) {
+        // timings of another kernel set, thread count or size sweep say nothing about a regression
+        const std::string isa = core::isa_name(core::active_isa());
+        if (!baseline.isa.empty() && baseline.isa != isa) {
+            throw std::runtime_error("the baseline was recorded with isa " + baseline.isa +
+                                     ", this run uses " + isa);
+        }
+        if (baseline.threads != 0 && baseline.threads != options.threads) {
+            throw std::runtime_error("the baseline was recorded with --threads=" + std::to_string(baseline.threads) +
+                                     ", this run uses " + std::to_string(options.threads));
+        }
+        if (baseline.quick != options.quick) {
+            throw std::runtime_error(std::string("the baseline was recorded ") +
+                                     (baseline.quick ? "with" : "without") + " --quick, this run " +
+                                     (options.quick ? "uses" : "does not use") + " it");
+        }
+    }
+
+    core::index compare(const std::vector<Result>& results, const Baseline& baseline, const Options& options) {
+        check_baseline(baseline, options);
+        const double tolerance = options.tolerance;
+        core::index regressions = 0;
+        std::printf("\n%-40s %11s %11s %8s\n", "case", "time", "baseline", "change");
+        for (const Result& r : results) {
+            const auto it = std::find_if(baseline.results.begin(), baseline.results.end(),
+                                         [&](const Result& b) { return b.key() == r.key(); });
+            if (it == baseline.results.end() || it->seconds <= 0.0) {
+                std::printf("%-40s %s %11s %8s\n", r.key().c_str(), format_time(r.seconds).c_str(), "-", "new");
+                continue;
+            }
+            const double change = r.seconds / it->seconds - 1.0;
+            const bool regressed = change > tolerance;
+            regressions += regressed;
+            std::printf("%-40s %s %s %+7.1f%%%s\n", r.key().c_str(), format_time(r.seconds).c_str(),
+                        format_time(it->seconds).c_str(), change * 100.0, regressed ? "  REGRESSION" : "");
+        }
+        std::printf("\n%zu regression(s) beyond %.0f%% tolerance\n", static_cast<std::size_t>(regressions),
+                    tolerance * 100.0);
+        return regressions;
+    }
+
+}
\ No newline at end of file
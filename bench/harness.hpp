@@ -0,0 +1,103 @@
+#ifndef AXIOM_BENCH_HARNESS_HPP
+#define AXIOM_BENCH_HARNESS_HPP
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "axiom/core/core.hpp"
+
+namespace axiom::bench {
+/*
+ * small benchmark harness for AxiomBench:
+ * - a case is registered with its flop and byte counts per call and a setup function that
+ *   builds the inputs and returns the callable to time, so filtered-out cases allocate nothing
+ * - each case is calibrated until one sample takes min_time / samples, then timed `samples`
+ *   times, the median time per call is reported with GFLOP/s and GB/s derived from it
+ * - results are written as JSON and can be compared against a stored baseline: a case slower
+ *   than baseline * (1 + tolerance) is a regression and makes the run fail; a baseline recorded
+ *   on another ISA or with another size sweep (--quick) is refused rather than compared
+ */
+
+    struct Options {
+        std::string filter;             // substring of "name/params", empty runs everything
+        double min_time = 0.2;          // seconds per case, split over all samples
+        core::index samples = 5;
+        bool quick = false;             // smaller size sweep
+        core::index threads = 0;        // for the multithreaded cases, 0 = all hardware threads
+        std::string json;               // results file, empty = none
+        std::string baseline;           // baseline to compare against, empty = none
+        double tolerance = 0.10;        // allowed slowdown against the baseline
+        bool list = false;
+    };
+
+    struct Result {
+        std::string name;
+        std::string params;
+        core::index iterations = 0;     // calls per sample
+        double seconds = 0.0;           // median per call
+        double min_seconds = 0.0;       // fastest sample per call
+        double flops = 0.0;             // per call
+        double bytes = 0.0;             // per call
+
+        [[nodiscard]] std::string key() const { return name + "/" + params; }
+        [[nodiscard]] double gflops() const { return seconds > 0.0 ? flops / seconds * 1e-9 : 0.0; }
+        [[nodiscard]] double gbps() const { return seconds > 0.0 ? bytes / seconds * 1e-9 : 0.0; }
+    };
+
+    // a results file read back: the run's ISA, thread count and sweep, and its cases
+    struct Baseline {
+        std::string isa;                // empty when the file does not record it
+        core::index threads = 0;        // 0 when the file does not record it
+        bool quick = false;
+        std::vector<Result> results;
+    };
+
+    struct Case {
+        std::string name;
+        std::string params;
+        double flops = 0.0;
+        double bytes = 0.0;
+        std::function<std::function<void()>()> setup;
+    };
+
+    class Suite {
+    public:
+        void add(std::string name, std::string params, double flops, double bytes,
+                 std::function<std::function<void()>()> setup);
+
+        [[nodiscard]] const std::vector<Case>& cases() const noexcept { return cases_; }
+
+        // runs every case matching options.filter, printing one row per case as it finishes
+        std::vector<Result> run(const Options& options) const;
+
+    private:
+        std::vector<Case> cases_;
+    };
+
+    // keeps the compiler from dropping a computed value
+    template <typename T>
+    void keep(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const void* sink;
+        sink = &value;
+#endif
+    }
+
+    Options parse_options(int argc, char** argv);
+
+    void write_json(const std::string& path, const std::vector<Result>& results, const Options& options);
+    Baseline read_json(const std::string& path);
+
+    // throws std::runtime_error if the baseline's ISA or sweep differs from this run's
+    void check_baseline(const Baseline& baseline, const Options& options);
+
+    // prints a comparison against the baseline (check_baseline() first), returns the number of
+    // regressions
+    core::index compare(const std::vector<Result>& results, const Baseline& baseline, const Options& options);
+
+}
+
+#endif //AXIOM_BENCH_HARNESS_HPP
\ No newline at end of file
@@ -0,0 +1,447 @@
+#include <cstdio>
+#include <exception>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "harness.hpp"
+
+#include "axiom/core/cpu.hpp"
+#include "axiom/exec/exec.hpp"
+#include "axiom/linalg/batch.hpp"
+#include "axiom/linalg/decomposition.hpp"
+#include "axiom/linalg/distance.hpp"
+#include "axiom/linalg/krylov.hpp"
+#include "axiom/linalg/mixed.hpp"
+#include "axiom/linalg/ops.hpp"
+#include "axiom/linalg/sparse.hpp"
+#include "axiom/linalg/transpose.hpp"
+
+using axiom::core::index;
+using axiom::linalg::Mat;
+using axiom::linalg::Vec;
+namespace bench = axiom::bench;
+namespace linalg = axiom::linalg;
+
+/*
+ * AxiomBench: sweeps sizes over the vector ops and norms, the batched 3-vector kernels, gemv /
+ * gemm, transposes, pairwise distances and k-NN, sparse products and Krylov solvers, the dense
+ * decompositions and mixed-precision solves, reporting time, GFLOP/s and GB/s per case
+ * flops count multiply and add separately, bytes are the compulsory traffic of one call
+ * (every operand read once, every output written once), so GB/s is a lower bound
+ *
+ *   AxiomBench --json=current.json --baseline=baseline.json --tolerance=0.15
+ */
+
+namespace {
+    template <typename T>
+    Vec<T> random_vec(const index n, const std::uint64_t seed) {
+        std::mt19937_64 rng(seed);
+        std::uniform_real_distribution<double> dist(-1.0, 1.0);
+        Vec<T> v(n);
+        for (index i = 0; i < n; ++i) v[i] = static_cast<T>(dist(rng));
+        return v;
+    }
+
+    template <typename T>
+    Mat<T> random_mat(const index rows, const index cols, const std::uint64_t seed) {
+        std::mt19937_64 rng(seed);
+        std::uniform_real_distribution<double> dist(-1.0, 1.0);
+        Mat<T> m(rows, cols);
+        for (index i = 0; i < rows; ++i) {
+            for (index j = 0; j < cols; ++j) m(i, j) = static_cast<T>(dist(rng));
+        }
+        return m;
+    }
+
+    // well conditioned for LU and positive definite for Cholesky
+    Mat<double> random_spd(const index n, const std::uint64_t seed) {
+        const Mat<double> a = random_mat<double>(n, n, seed);
+        const linalg::MatView<const double> at(a.data(), n, n, 1, n);
+        Mat<double> spd = linalg::matmul(at, a);
+        for (index i = 0; i < n; ++i) spd(i, i) += static_cast<double>(n);
+        return spd;
+    }
+
+    // 5-point Laplacian on a g x g grid
+    linalg::CsrMat<double> laplacian(const index g) {
+        std::vector<linalg::Triplet<double>> t;
+        t.reserve(5 * g * g);
+        for (index i = 0; i < g; ++i) {
+            for (index j = 0; j < g; ++j) {
+                const index r = i * g + j;
+                t.push_back({r, r, 4.0});
+                if (i > 0) t.push_back({r, r - g, -1.0});
+                if (i + 1 < g) t.push_back({r, r + g, -1.0});
+                if (j > 0) t.push_back({r, r - 1, -1.0});
+                if (j + 1 < g) t.push_back({r, r + 1, -1.0});
+            }
+        }
+        return linalg::CsrMat<double>::from_triplets(g * g, g * g, t);
+    }
+
+    std::string param(const char* name, const index v) { return std::string(name) + "=" + std::to_string(v); }
+
+    std::string dims(const index m, const index n) { return "m=" + std::to_string(m) + ",n=" + std::to_string(n); }
+
+    void vector_cases(bench::Suite& suite, const bench::Options& o) {
+        const std::vector<index> sizes = o.quick ? std::vector<index>{1 << 10, 1 << 16}
+                                                 : std::vector<index>{1 << 10, 1 << 14, 1 << 18, 1 << 22};
+        for (const index n : sizes) {
+            const double nd = static_cast<double>(n), d = sizeof(double);
+            suite.add("dot<double>", param("n", n), 2 * nd, 2 * d * nd, [n] {
+                auto a = std::make_shared<Vec<double>>(random_vec<double>(n, 1));
+                auto b = std::make_shared<Vec<double>>(random_vec<double>(n, 2));
+                return [a, b] { bench::keep(linalg::dot(*a, *b)); };
+            });
+            suite.add("dot<float>", param("n", n), 2 * nd, 2 * sizeof(float) * nd, [n] {
+                auto a = std::make_shared<Vec<float>>(random_vec<float>(n, 1));
+                auto b = std::make_shared<Vec<float>>(random_vec<float>(n, 2));
+                return [a, b] { bench::keep(linalg::dot(*a, *b)); };
+            });
+            suite.add("sum", param("n", n), nd, d * nd, [n] {
+                auto a = std::make_shared<Vec<double>>(random_vec<double>(n, 3));
+                return [a] { bench::keep(linalg::sum(*a)); };
+            });
+            suite.add("axpy", param("n", n), 2 * nd, 3 * d * nd, [n] {
+                auto x = std::make_shared<Vec<double>>(random_vec<double>(n, 4));
+                auto y = std::make_shared<Vec<double>>(random_vec<double>(n, 5));
+                return [x, y] { *y += 1e-9 * *x; bench::keep(y->data()[0]); };
+            });
+            suite.add("distance", param("n", n), 3 * nd, 2 * d * nd, [n] {
+                auto a = std::make_shared<Vec<double>>(random_vec<double>(n, 6));
+                auto b = std::make_shared<Vec<double>>(random_vec<double>(n, 7));
+                return [a, b] { bench::keep(linalg::distance(*a, *b)); };
+            });
+            suite.add("maxCoeff", param("n", n), nd, d * nd, [n] {
+                auto a = std::make_shared<Vec<double>>(random_vec<double>(n, 8));
+                return [a] { bench::keep(linalg::maxCoeff(*a)); };
+            });
+            suite.add("argMax", param("n", n), nd, d * nd, [n] {
+                auto a = std::make_shared<Vec<double>>(random_vec<double>(n, 9));
+                return [a] { bench::keep(linalg::argMax(*a)); };
+            });
+
+            // norms of vec.hpp
+            suite.add("l1_norm", param("n", n), 2 * nd, d * nd, [n] {
+                auto a = std::make_shared<Vec<double>>(random_vec<double>(n, 10));
+                return [a] { bench::keep(a->l1_norm()); };
+            });
+            suite.add("l2_norm", param("n", n), 2 * nd, d * nd, [n] {
+                auto a = std::make_shared<Vec<double>>(random_vec<double>(n, 11));
+                return [a] { bench::keep(a->l2_norm()); };
+            });
+            suite.add("infty_norm", param("n", n), nd, d * nd, [n] {
+                auto a = std::make_shared<Vec<double>>(random_vec<double>(n, 12));
+                return [a] { bench::keep(a->infty_norm()); };
+            });
+        }
+
+        const index n = o.quick ? index{1} << 18 : index{1} << 22;
+        const double nd = static_cast<double>(n);
+        const axiom::exec::Parallel par{.threads = o.threads};
+        suite.add("sum/par", param("n", n) + ",t=" + std::to_string(o.threads), nd, sizeof(double) * nd, [n, par] {
+            auto a = std::make_shared<Vec<double>>(random_vec<double>(n, 13));
+            return [a, par] { bench::keep(linalg::sum(par, *a)); };
+        });
+        suite.add("dot/par", param("n", n) + ",t=" + std::to_string(o.threads), 2 * nd, 2 * sizeof(double) * nd,
+                  [n, par] {
+            auto a = std::make_shared<Vec<double>>(random_vec<double>(n, 14));
+            auto b = std::make_shared<Vec<double>>(random_vec<double>(n, 15));
+            return [a, b, par] { bench::keep(linalg::dot(par, *a, *b)); };
+        });
+    }
+
+    // structure-of-arrays 3-vectors, flops without the sqrt / division of normalize
+    void batch_cases(bench::Suite& suite, const bench::Options& o) {
+        const std::vector<index> sizes = o.quick ? std::vector<index>{1 << 12, 1 << 18}
+                                                 : std::vector<index>{1 << 12, 1 << 16, 1 << 20};
+        for (const index n : sizes) {
+            const double nd = static_cast<double>(n), d = sizeof(double);
+            suite.add("batch3_dot", param("n", n), 5 * nd, 7 * d * nd, [n] {
+                auto a = std::make_shared<linalg::Batch3<double>>(
+                    linalg::Batch3<double>::from_rows(random_mat<double>(n, 3, 60)));
+                auto b = std::make_shared<linalg::Batch3<double>>(
+                    linalg::Batch3<double>::from_rows(random_mat<double>(n, 3, 61)));
+                auto out = std::make_shared<Vec<double>>(n);
+                return [a, b, out] { linalg::dot(*a, *b, *out); bench::keep(out->data()[0]); };
+            });
+            suite.add("batch3_cross", param("n", n), 9 * nd, 9 * d * nd, [n] {
+                auto a = std::make_shared<linalg::Batch3<double>>(
+                    linalg::Batch3<double>::from_rows(random_mat<double>(n, 3, 62)));
+                auto b = std::make_shared<linalg::Batch3<double>>(
+                    linalg::Batch3<double>::from_rows(random_mat<double>(n, 3, 63)));
+                auto out = std::make_shared<linalg::Batch3<double>>(n);
+                return [a, b, out] { linalg::cross(*a, *b, *out); bench::keep(out->x()[0]); };
+            });
+            suite.add("batch3_normalize", param("n", n), 8 * nd, 6 * d * nd, [n] {
+                auto a = std::make_shared<linalg::Batch3<double>>(
+                    linalg::Batch3<double>::from_rows(random_mat<double>(n, 3, 64)));
+                auto out = std::make_shared<linalg::Batch3<double>>(n);
+                return [a, out] { linalg::normalize(*a, *out); bench::keep(out->x()[0]); };
+            });
+            suite.add("batch3_reflect<float>", param("n", n), 12 * nd, 9 * sizeof(float) * nd, [n] {
+                auto v = std::make_shared<linalg::Batch3<float>>(
+                    linalg::Batch3<float>::from_rows(random_mat<float>(n, 3, 65)));
+                auto normal = std::make_shared<linalg::Batch3<float>>(n);
+                linalg::normalize(linalg::Batch3<float>::from_rows(random_mat<float>(n, 3, 66)), *normal);
+                auto out = std::make_shared<linalg::Batch3<float>>(n);
+                return [v, normal, out] { linalg::reflect(*v, *normal, *out); bench::keep(out->x()[0]); };
+            });
+        }
+
+        const index n = o.quick ? index{1} << 18 : index{1} << 22;
+        const double nd = static_cast<double>(n);
+        const axiom::exec::Parallel par{.threads = o.threads};
+        suite.add("batch3_normalize/par", param("n", n) + ",t=" + std::to_string(o.threads), 8 * nd,
+                  6 * sizeof(double) * nd, [n, par] {
+            auto a = std::make_shared<linalg::Batch3<double>>(
+                linalg::Batch3<double>::from_rows(random_mat<double>(n, 3, 67)));
+            auto out = std::make_shared<linalg::Batch3<double>>(n);
+            return [a, out, par] { linalg::normalize(par, *a, *out); bench::keep(out->x()[0]); };
+        });
+    }
+
+    void matrix_cases(bench::Suite& suite, const bench::Options& o) {
+        const double d = sizeof(double);
+        for (const index n : o.quick ? std::vector<index>{256, 1024} : std::vector<index>{256, 1024, 4096}) {
+            const double nd = static_cast<double>(n);
+            suite.add("gemv", dims(n, n), 2 * nd * nd, d * (nd * nd + 2 * nd), [n] {
+                auto a = std::make_shared<Mat<double>>(random_mat<double>(n, n, 20));
+                auto x = std::make_shared<Vec<double>>(random_vec<double>(n, 21));
+                auto y = std::make_shared<Vec<double>>(n);
+                return [a, x, y] { linalg::gemv(1.0, *a, *x, 0.0, *y); bench::keep(y->data()[0]); };
+            });
+            suite.add("gemv_t", dims(n, n), 2 * nd * nd, d * (nd * nd + 2 * nd), [n] {
+                auto a = std::make_shared<Mat<double>>(random_mat<double>(n, n, 22));
+                auto x = std::make_shared<Vec<double>>(random_vec<double>(n, 23));
+                auto y = std::make_shared<Vec<double>>(n);
+                return [a, x, y] { linalg::gemv_t(1.0, *a, *x, 0.0, *y); bench::keep(y->data()[0]); };
+            });
+        }
+
+        for (const index n : o.quick ? std::vector<index>{64, 256} : std::vector<index>{64, 256, 512, 1024}) {
+            const double nd = static_cast<double>(n), flops = 2 * nd * nd * nd, bytes = 3 * d * nd * nd;
+            suite.add("gemm<double>", param("n", n), flops, bytes, [n] {
+                auto a = std::make_shared<Mat<double>>(random_mat<double>(n, n, 30));
+                auto b = std::make_shared<Mat<double>>(random_mat<double>(n, n, 31));
+                auto c = std::make_shared<Mat<double>>(n, n);
+                return [a, b, c] { linalg::gemm(1.0, *a, *b, 0.0, *c); bench::keep(c->data()[0]); };
+            });
+            suite.add("gemm<float>", param("n", n), flops, bytes / 2, [n] {
+                auto a = std::make_shared<Mat<float>>(random_mat<float>(n, n, 32));
+                auto b = std::make_shared<Mat<float>>(random_mat<float>(n, n, 33));
+                auto c = std::make_shared<Mat<float>>(n, n);
+                return [a, b, c] { linalg::gemm(1.0f, *a, *b, 0.0f, *c); bench::keep(c->data()[0]); };
+            });
+        }
+        const index n = o.quick ? 256 : 1024;
+        const double nd = static_cast<double>(n);
+        suite.add("gemm/par", param("n", n) + ",t=" + std::to_string(o.threads), 2 * nd * nd * nd, 3 * d * nd * nd,
+                  [n, par = axiom::exec::Parallel{.threads = o.threads}] {
+            auto a = std::make_shared<Mat<double>>(random_mat<double>(n, n, 34));
+            auto b = std::make_shared<Mat<double>>(random_mat<double>(n, n, 35));
+            auto c = std::make_shared<Mat<double>>(n, n);
+            return [a, b, c, par] { linalg::gemm(par, 1.0, *a, *b, 0.0, *c); bench::keep(c->data()[0]); };
+        });
+
+        // layout changes move data only, every element read and written once
+        using ColMat = Mat<double, axiom::core::dynamic, axiom::core::dynamic, linalg::ColMajor>;
+        for (const index m : o.quick ? std::vector<index>{256, 1024} : std::vector<index>{256, 1024, 4096}) {
+            const double md = static_cast<double>(m);
+            suite.add("transpose", param("n", m), 0.0, 2 * d * md * md, [m] {
+                auto a = std::make_shared<Mat<double>>(random_mat<double>(m, m, 36));
+                return [a] { bench::keep(linalg::transpose(*a).data()[0]); };
+            });
+            suite.add("to_layout<ColMajor>", param("n", m), 0.0, 2 * d * md * md, [m] {
+                auto a = std::make_shared<Mat<double>>(random_mat<double>(m, m, 37));
+                return [a] { bench::keep(linalg::to_layout<linalg::ColMajor>(*a).data()[0]); };
+            });
+            suite.add("transpose_in_place", param("n", m), 0.0, 2 * d * md * md, [m] {
+                auto a = std::make_shared<ColMat>(random_mat<double>(m, m, 38));
+                return [a] { linalg::transpose_in_place(*a); bench::keep(a->data()[1]); };
+            });
+        }
+        const index m = o.quick ? 1024 : 4096;
+        const double md = static_cast<double>(m);
+        suite.add("transpose/par", param("n", m) + ",t=" + std::to_string(o.threads), 0.0, 2 * d * md * md,
+                  [m, par = axiom::exec::Parallel{.threads = o.threads}] {
+            auto a = std::make_shared<Mat<double>>(random_mat<double>(m, m, 39));
+            return [a, par] { bench::keep(linalg::transpose(par, *a).data()[0]); };
+        });
+    }
+
+    // N queries against M references in dim dimensions, the gemm cross terms dominate the flops
+    void distance_cases(bench::Suite& suite, const bench::Options& o) {
+        const double d = sizeof(double);
+        const index dim = 32, k = 8;
+        for (const index n : o.quick ? std::vector<index>{1024} : std::vector<index>{1024, 4096}) {
+            const double nd = static_cast<double>(n), dd = static_cast<double>(dim);
+            const double flops = 2 * nd * nd * dd + 2 * nd * nd, inputs = 2 * d * nd * dd;
+            suite.add("pairwise_sq_distances", dims(n, n) + ",d=" + std::to_string(dim), flops,
+                      inputs + d * nd * nd, [n] {
+                auto x = std::make_shared<Mat<double>>(random_mat<double>(n, dim, 70));
+                auto y = std::make_shared<Mat<double>>(random_mat<double>(n, dim, 71));
+                auto out = std::make_shared<Mat<double>>(n, n);
+                return [x, y, out] { linalg::pairwise_sq_distances(*x, *y, *out); bench::keep(out->data()[0]); };
+            });
+            // never materializes the N x M matrix, only the k results per query are written
+            suite.add("knn", dims(n, n) + ",d=" + std::to_string(dim) + ",k=" + std::to_string(k), flops,
+                      inputs + (d + sizeof(index)) * nd * static_cast<double>(k), [n] {
+                auto x = std::make_shared<Mat<double>>(random_mat<double>(n, dim, 72));
+                auto y = std::make_shared<Mat<double>>(random_mat<double>(n, dim, 73));
+                return [x, y] { bench::keep(linalg::knn(*x, *y, k).distances.data()[0]); };
+            });
+        }
+
+        const index n = o.quick ? 2048 : 8192;
+        const double nd = static_cast<double>(n), dd = static_cast<double>(dim);
+        suite.add("knn/par", dims(n, n) + ",d=" + std::to_string(dim) + ",k=" + std::to_string(k) + ",t=" +
+                  std::to_string(o.threads), 2 * nd * nd * dd + 2 * nd * nd,
+                  2 * d * nd * dd + (d + sizeof(index)) * nd * static_cast<double>(k),
+                  [n, par = axiom::exec::Parallel{.threads = o.threads}] {
+            auto x = std::make_shared<Mat<double>>(random_mat<double>(n, dim, 74));
+            auto y = std::make_shared<Mat<double>>(random_mat<double>(n, dim, 75));
+            return [x, y, par] { bench::keep(linalg::knn(par, *x, *y, k).distances.data()[0]); };
+        });
+    }
+
+    void sparse_cases(bench::Suite& suite, const bench::Options& o) {
+        for (const index g : o.quick ? std::vector<index>{64} : std::vector<index>{64, 512}) {
+            const double rows = static_cast<double>(g * g), nnz = 5.0 * rows;
+            // values and column indices once, x and y once, row pointers once
+            const double bytes = nnz * (sizeof(double) + sizeof(index)) + rows * (2 * sizeof(double) + sizeof(index));
+            suite.add("spmv", param("grid", g), 2 * nnz, bytes, [g] {
+                auto a = std::make_shared<linalg::CsrMat<double>>(laplacian(g));
+                auto x = std::make_shared<Vec<double>>(random_vec<double>(g * g, 40));
+                auto y = std::make_shared<Vec<double>>(g * g);
+                return [a, x, y] { linalg::gemv(1.0, *a, *x, 0.0, *y); bench::keep(y->data()[0]); };
+            });
+            suite.add("spmv_t", param("grid", g), 2 * nnz, bytes, [g] {
+                auto a = std::make_shared<linalg::CsrMat<double>>(laplacian(g));
+                auto x = std::make_shared<Vec<double>>(random_vec<double>(g * g, 41));
+                auto y = std::make_shared<Vec<double>>(g * g);
+                return [a, x, y] { linalg::gemv_t(1.0, *a, *x, 0.0, *y); bench::keep(y->data()[0]); };
+            });
+
+            // a fixed number of iterations (tolerance 0 never converges) so the work per call is
+            // constant; per iteration one spmv plus the vector updates, GMRES Gram-Schmidt counted
+            // at the mean basis size of a restart cycle, bytes are the spmv traffic only
+            const linalg::KrylovOptions krylov{.tolerance = 0.0, .max_iterations = 50, .restart = 30};
+            const double iters = static_cast<double>(krylov.max_iterations);
+            const double cg_flops = iters * (2 * nnz + 11 * rows);
+            const double gmres_flops = iters * (2 * nnz + (4 * (krylov.restart / 2.0) + 3) * rows);
+            suite.add("cg/jacobi", param("grid", g), cg_flops, iters * bytes, [g, krylov] {
+                auto a = std::make_shared<linalg::CsrMat<double>>(laplacian(g));
+                auto m = std::make_shared<linalg::Jacobi<double>>(*a);
+                auto b = std::make_shared<Vec<double>>(random_vec<double>(g * g, 42));
+                auto x = std::make_shared<Vec<double>>(g * g);
+                auto cg = std::make_shared<linalg::Cg<double>>(g * g, krylov);
+                return [a, m, b, x, cg] {
+                    x->fill(0.0);
+                    bench::keep(cg->solve(*a, *b, *x, *m).residual);
+                };
+            });
+            suite.add("gmres", param("grid", g), gmres_flops, iters * bytes, [g, krylov] {
+                auto a = std::make_shared<linalg::CsrMat<double>>(laplacian(g));
+                auto b = std::make_shared<Vec<double>>(random_vec<double>(g * g, 43));
+                auto x = std::make_shared<Vec<double>>(g * g);
+                auto gmres = std::make_shared<linalg::Gmres<double>>(g * g, krylov);
+                return [a, b, x, gmres] {
+                    x->fill(0.0);
+                    bench::keep(gmres->solve(*a, *b, *x).residual);
+                };
+            });
+        }
+    }
+
+    void decomposition_cases(bench::Suite& suite, const bench::Options& o) {
+        const double d = sizeof(double);
+        for (const index n : o.quick ? std::vector<index>{128, 256} : std::vector<index>{128, 512, 1024}) {
+            const double nd = static_cast<double>(n), bytes = 2 * d * nd * nd;
+            suite.add("lu", param("n", n), 2.0 / 3.0 * nd * nd * nd, bytes, [n] {
+                auto a = std::make_shared<Mat<double>>(random_spd(n, 50));
+                return [a] { bench::keep(linalg::lu(*a).packed().data()[0]); };
+            });
+            suite.add("cholesky", param("n", n), 1.0 / 3.0 * nd * nd * nd, bytes, [n] {
+                auto a = std::make_shared<Mat<double>>(random_spd(n, 51));
+                return [a] { bench::keep(linalg::cholesky(*a).lower().data()[0]); };
+            });
+            suite.add("qr", param("n", n), 4.0 / 3.0 * nd * nd * nd, bytes, [n] {
+                auto a = std::make_shared<Mat<double>>(random_mat<double>(n, n, 52));
+                return [a] { bench::keep(linalg::qr(*a).packed().data()[0]); };
+            });
+            suite.add("lu_solve", param("n", n), 2.0 / 3.0 * nd * nd * nd + 2 * nd * nd, bytes + 2 * d * nd, [n] {
+                auto a = std::make_shared<Mat<double>>(random_spd(n, 53));
+                auto b = std::make_shared<Vec<double>>(random_vec<double>(n, 54));
+                return [a, b] { bench::keep(linalg::solve(*a, *b).data()[0]); };
+            });
+            // float factorization and double refinement against lu_solve / cholesky above
+            suite.add("mixed_solve", param("n", n), 2.0 / 3.0 * nd * nd * nd + 2 * nd * nd, bytes + 2 * d * nd, [n] {
+                auto a = std::make_shared<Mat<double>>(random_spd(n, 59));
+                auto b = std::make_shared<Vec<double>>(random_vec<double>(n, 60));
+                return [a, b] { bench::keep(linalg::mixed_solve(*a, *b).x.data()[0]); };
+            });
+            suite.add("mixed_solve/cholesky", param("n", n), 1.0 / 3.0 * nd * nd * nd + 2 * nd * nd,
+                      bytes + 2 * d * nd, [n] {
+                auto a = std::make_shared<Mat<double>>(random_spd(n, 61));
+                auto b = std::make_shared<Vec<double>>(random_vec<double>(n, 62));
+                const linalg::RefineOptions opts{.factorization = linalg::Factorization::kCholesky};
+                return [a, b, opts] { bench::keep(linalg::mixed_solve(*a, *b, opts).x.data()[0]); };
+            });
+        }
+
+        // tall least squares, 2 m n^2 flops for the factorization
+        const index m = o.quick ? 1 << 14 : 1 << 17, n = 32;
+        const double md = static_cast<double>(m), nd = static_cast<double>(n);
+        suite.add("lstsq", dims(m, n), 2 * md * nd * nd, d * (md * nd + md + nd), [m, n] {
+            auto a = std::make_shared<Mat<double>>(random_mat<double>(m, n, 55));
+            auto b = std::make_shared<Vec<double>>(random_vec<double>(m, 56));
+            return [a, b] { bench::keep(linalg::lstsq(*a, *b).data()[0]); };
+        });
+        suite.add("lstsq/par", dims(m, n) + ",t=" + std::to_string(o.threads), 2 * md * nd * nd,
+                  d * (md * nd + md + nd), [m, n, par = axiom::exec::Parallel{.threads = o.threads}] {
+            auto a = std::make_shared<Mat<double>>(random_mat<double>(m, n, 57));
+            auto b = std::make_shared<Vec<double>>(random_vec<double>(m, 58));
+            return [a, b, par] { bench::keep(linalg::lstsq(par, *a, *b).data()[0]); };
+        });
+    }
+}
+
+int main(int argc, char** argv) {
+    try {
+        const bench::Options options = bench::parse_options(argc, argv);
+        bench::Suite suite;
+        vector_cases(suite, options);
+        batch_cases(suite, options);
+        matrix_cases(suite, options);
+        distance_cases(suite, options);
+        sparse_cases(suite, options);
+        decomposition_cases(suite, options);
+
+        if (options.list) {
+            for (const auto& c : suite.cases()) std::printf("%s/%s\n", c.name.c_str(), c.params.c_str());
+            return 0;
+        }
+
+        // a baseline that cannot be compared fails before the sweep, not after it
+        bench::Baseline baseline;
+        if (!options.baseline.empty()) {
+            baseline = bench::read_json(options.baseline);
+            bench::check_baseline(baseline, options);
+        }
+
+        std::printf("isa %s, %zu thread(s)%s\n\n", axiom::core::isa_name(axiom::core::active_isa()),
+                    static_cast<std::size_t>(options.threads), options.quick ? ", quick sweep" : "");
+        const auto results = suite.run(options);
+        if (!options.json.empty()) bench::write_json(options.json, results, options);
+        if (!options.baseline.empty()) {
+            return bench::compare(results, baseline, options) == 0 ? 0 : 1;
+        }
+        return 0;
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "AxiomBench: %s\n", e.what());
+        return 2;
+    }
+}
\ No newline at end of file
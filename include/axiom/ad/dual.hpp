@@ -0,0 +1,157 @@
+#ifndef AXIOM_DUAL_HPP
+#define AXIOM_DUAL_HPP
+
+#include <cmath>
+#include <compare>
+#include <concepts>
+#include <ostream>
+#include <utility>
+
+#include "axiom/core/core.hpp"
+#include "axiom/linalg/vec.hpp"
+
+namespace axiom::ad {
+/*
+ * forward-mode automatic differentiation:
+ * - Dual<T> carries a value and one tangent, every operation applies the chain rule to the
+ *   tangent, so f(Dual(x, v)) gives f(x) and the directional derivative J v in one pass
+ * - a plain T converts implicitly to a constant (tangent 0), so Dual<T> works as the scalar of
+ *   Vec / Mat and through the generic paths of ops.hpp (dot, matvec, expressions, fixed-size
+ *   cross products ...), the SIMD kernels only ever see float / double
+ * - math functions are found by argument-dependent lookup, generic code calls them unqualified
+ *   after `using std::exp;` and friends; comparisons look at the value only
+ * - a full gradient takes n passes, one per input, reverse mode (tape.hpp) takes one pass for
+ *   any n and is the better choice once n grows past a handful
+ */
+
+    template <std::floating_point T>
+    struct Dual {
+        using value_type = T;
+
+        T val{};
+        T eps{};
+
+        constexpr Dual() = default;
+        constexpr Dual(const T value) noexcept : val(value) {}
+        constexpr Dual(const T value, const T tangent) noexcept : val(value), eps(tangent) {}
+
+        constexpr Dual& operator+=(const Dual& o) noexcept {
+            val += o.val;
+            eps += o.eps;
+            return *this;
+        }
+        constexpr Dual& operator-=(const Dual& o) noexcept {
+            val -= o.val;
+            eps -= o.eps;
+            return *this;
+        }
+        constexpr Dual& operator*=(const Dual& o) noexcept {
+            eps = eps * o.val + val * o.eps;
+            val *= o.val;
+            return *this;
+        }
+        constexpr Dual& operator/=(const Dual& o) noexcept {
+            val /= o.val;
+            eps = (eps - val * o.eps) / o.val;
+            return *this;
+        }
+
+        friend constexpr Dual operator+(Dual a, const Dual& b) noexcept { return a += b; }
+        friend constexpr Dual operator-(Dual a, const Dual& b) noexcept { return a -= b; }
+        friend constexpr Dual operator*(Dual a, const Dual& b) noexcept { return a *= b; }
+        friend constexpr Dual operator/(Dual a, const Dual& b) noexcept { return a /= b; }
+        friend constexpr Dual operator-(const Dual& a) noexcept { return {-a.val, -a.eps}; }
+        friend constexpr Dual operator+(const Dual& a) noexcept { return a; }
+
+        friend constexpr bool operator==(const Dual& a, const Dual& b) noexcept { return a.val == b.val; }
+        friend constexpr auto operator<=>(const Dual& a, const Dual& b) noexcept { return a.val <=> b.val; }
+
+        friend std::ostream& operator<<(std::ostream& os, const Dual& d) { return os << d.val << " + " << d.eps << "e"; }
+
+        // f(a + e) = f(a) + f'(a) e
+        friend Dual abs(const Dual& a) noexcept { return a.val < T{} ? -a : a; }
+        friend Dual sqrt(const Dual& a) noexcept {
+            const T s = std::sqrt(a.val);
+            return {s, a.eps / (T{2} * s)};
+        }
+        friend Dual exp(const Dual& a) noexcept {
+            const T e = std::exp(a.val);
+            return {e, a.eps * e};
+        }
+        friend Dual log(const Dual& a) noexcept { return {std::log(a.val), a.eps / a.val}; }
+        friend Dual sin(const Dual& a) noexcept { return {std::sin(a.val), a.eps * std::cos(a.val)}; }
+        friend Dual cos(const Dual& a) noexcept { return {std::cos(a.val), -a.eps * std::sin(a.val)}; }
+        friend Dual tan(const Dual& a) noexcept {
+            const T t = std::tan(a.val);
+            return {t, a.eps * (T{1} + t * t)};
+        }
+        friend Dual tanh(const Dual& a) noexcept {
+            const T t = std::tanh(a.val);
+            return {t, a.eps * (T{1} - t * t)};
+        }
+        friend Dual pow(const Dual& a, const T p) noexcept {
+            return {std::pow(a.val, p), a.eps * p * std::pow(a.val, p - T{1})};
+        }
+        // the exponent's tangent needs a > 0, a constant exponent never reads log(a)
+        friend Dual pow(const Dual& a, const Dual& p) noexcept {
+            const T v = std::pow(a.val, p.val);
+            T d = a.eps * p.val * std::pow(a.val, p.val - T{1});
+            if (p.eps != T{}) d += p.eps * v * std::log(a.val);
+            return {v, d};
+        }
+    };
+
+    // d/dx f at x for a scalar f
+    template <std::floating_point T, typename F>
+        requires std::invocable<F&, Dual<T>>
+    T derivative(F&& f, const T x) {
+        return static_cast<Dual<T>>(f(Dual<T>(x, T{1}))).eps;
+    }
+
+    // holds the dual workspace, f(const Vec<Dual<T>>&) -> Dual<T>
+    // operator() has the signature opt/ expects of an objective with gradient
+    template <std::floating_point T, typename F>
+    class ForwardGradient {
+    public:
+        ForwardGradient(const core::index n, F f) : f_(std::move(f)), x_(n) {}
+
+        [[nodiscard]] core::index size() const noexcept { return x_.size(); }
+
+        // J v at x, one pass
+        T directional(const linalg::Vec<T>& x, const linalg::Vec<T>& v) {
+            check(x.size(), v.size(), "ForwardGradient::directional(): x and v must have n elements");
+            for (core::index i = 0; i < size(); ++i) x_[i] = Dual<T>(x[i], v[i]);
+            return static_cast<Dual<T>>(f_(std::as_const(x_))).eps;
+        }
+
+        // g = grad f(x) in n passes, returns f(x)
+        T operator()(const linalg::Vec<T>& x, linalg::Vec<T>& g) {
+            check(x.size(), g.size(), "ForwardGradient: x and g must have n elements");
+            T value{};
+            for (core::index i = 0; i < size(); ++i) x_[i] = Dual<T>(x[i]);
+            for (core::index i = 0; i < size(); ++i) {
+                x_[i].eps = T{1};
+                const Dual<T> y = f_(std::as_const(x_));
+                x_[i].eps = T{};
+                g[i] = y.eps;
+                value = y.val;
+            }
+            return value;
+        }
+
+    private:
+        F f_;
+        linalg::Vec<Dual<T>> x_;
+
+        void check(const core::index a, const core::index b, const char* msg) const {
+            if (a != size() || b != size()) throw core::Error(core::ErrorCode::kShapeMismatch, msg);
+        }
+    };
+
+    template <std::floating_point T, typename F>
+    [[nodiscard]] ForwardGradient<T, F> forward_gradient(const core::index n, F f) {
+        return ForwardGradient<T, F>(n, std::move(f));
+    }
+}
+
+#endif //AXIOM_DUAL_HPP
\ No newline at end of file
@@ -0,0 +1,328 @@
+#ifndef AXIOM_TAPE_HPP
+#define AXIOM_TAPE_HPP
+
+#include <cmath>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "axiom/core/core.hpp"
+#include "axiom/core/memory.hpp"
+#include "axiom/core/profile.hpp"
+#include "axiom/linalg/vec.hpp"
+
+namespace axiom::ad {
+/*
+ * reverse-mode automatic differentiation:
+ * - a Tape<T> records every operation on Var<T> as a node (operation, operands, value), nodes
+ *   are appended in evaluation order and live in fixed-size blocks drawn from the tape's own
+ *   core::Arena, so recording does not allocate per node and clear() keeps the blocks for the
+ *   next recording
+ * - backward(y) sweeps the nodes once in reverse and leaves dy / dnode in every adjoint, so the
+ *   whole gradient costs a small constant times one evaluation, whatever the number of inputs
+ * - a recorded graph can be replayed: set_value() on the inputs and forward() recompute every
+ *   node in order without recording again, valid as long as the computation is static (no
+ *   branches on values, the same operations for every input)
+ * - Var<T> works as the scalar of Vec / Mat and through the generic paths of ops.hpp like
+ *   Dual<T> does, a plain T is a constant that joins a tape when combined with a variable
+ * - a tape is used from one thread at a time and must outlive its variables
+ */
+
+    template <std::floating_point T>
+    class Tape;
+
+    enum class Op : std::uint8_t { kInput, kConst, kAdd, kSub, kMul, kDiv, kNeg, kAbs, kSqrt, kExp, kLog,
+                                    kSin, kCos, kTan, kTanh, kPow, kPowConst };
+
+    template <std::floating_point T>
+    class Var {
+    public:
+        using value_type = T;
+
+        constexpr Var() = default;
+        constexpr Var(const T value) noexcept : value_(value) {}
+
+        // value when recorded, Tape::value() has the one of the last forward()
+        [[nodiscard]] T value() const noexcept { return value_; }
+        [[nodiscard]] Tape<T>* tape() const noexcept { return tape_; }
+        [[nodiscard]] core::index id() const noexcept { return id_; }
+        [[nodiscard]] bool is_constant() const noexcept { return tape_ == nullptr; }
+
+        Var& operator+=(const Var& o) { return *this = *this + o; }
+        Var& operator-=(const Var& o) { return *this = *this - o; }
+        Var& operator*=(const Var& o) { return *this = *this * o; }
+        Var& operator/=(const Var& o) { return *this = *this / o; }
+
+        friend Var operator+(const Var& a, const Var& b) { return binary(Op::kAdd, a, b, a.value_ + b.value_); }
+        friend Var operator-(const Var& a, const Var& b) { return binary(Op::kSub, a, b, a.value_ - b.value_); }
+        friend Var operator*(const Var& a, const Var& b) { return binary(Op::kMul, a, b, a.value_ * b.value_); }
+        friend Var operator/(const Var& a, const Var& b) { return binary(Op::kDiv, a, b, a.value_ / b.value_); }
+        friend Var operator-(const Var& a) { return unary(Op::kNeg, a, -a.value_); }
+        friend Var operator+(const Var& a) { return a; }
+
+        friend bool operator==(const Var& a, const Var& b) noexcept { return a.value_ == b.value_; }
+        friend auto operator<=>(const Var& a, const Var& b) noexcept { return a.value_ <=> b.value_; }
+
+        friend Var abs(const Var& a) { return unary(Op::kAbs, a, std::abs(a.value_)); }
+        friend Var sqrt(const Var& a) { return unary(Op::kSqrt, a, std::sqrt(a.value_)); }
+        friend Var exp(const Var& a) { return unary(Op::kExp, a, std::exp(a.value_)); }
+        friend Var log(const Var& a) { return unary(Op::kLog, a, std::log(a.value_)); }
+        friend Var sin(const Var& a) { return unary(Op::kSin, a, std::sin(a.value_)); }
+        friend Var cos(const Var& a) { return unary(Op::kCos, a, std::cos(a.value_)); }
+        friend Var tan(const Var& a) { return unary(Op::kTan, a, std::tan(a.value_)); }
+        friend Var tanh(const Var& a) { return unary(Op::kTanh, a, std::tanh(a.value_)); }
+        friend Var pow(const Var& a, const T p) { return unary(Op::kPowConst, a, std::pow(a.value_, p), p); }
+        friend Var pow(const Var& a, const Var& p) { return binary(Op::kPow, a, p, std::pow(a.value_, p.value_)); }
+
+    private:
+        friend class Tape<T>;
+
+        Tape<T>* tape_ = nullptr;
+        core::index id_ = 0;
+        T value_{};
+
+        Var(Tape<T>* tape, const core::index id, const T value) noexcept : tape_(tape), id_(id), value_(value) {}
+
+        static Var unary(const Op op, const Var& a, const T value, const T aux = T{}) {
+            if (a.is_constant()) return Var(value);
+            return a.tape_->push(op, a.id_, 0, aux, value);
+        }
+
+        // a constant operand is recorded as a kConst node on the other operand's tape
+        static Var binary(const Op op, const Var& a, const Var& b, const T value) {
+            if (a.tape_ != nullptr && b.tape_ != nullptr && a.tape_ != b.tape_) {
+                throw core::Error(core::ErrorCode::kInvalidArgument, "Var: operands are recorded on different tapes");
+            }
+            Tape<T>* tape = a.tape_ != nullptr ? a.tape_ : b.tape_;
+            if (tape == nullptr) return Var(value);
+            const core::index ia = a.is_constant() ? tape->constant(a.value_).id_ : a.id_;
+            const core::index ib = b.is_constant() ? tape->constant(b.value_).id_ : b.id_;
+            return tape->push(op, ia, ib, T{}, value);
+        }
+    };
+
+    template <std::floating_point T>
+    class Tape {
+    public:
+        // nodes per arena block
+        static constexpr core::index kBlock = 1024;
+
+        Tape() = default;
+        Tape(const Tape&) = delete;
+        Tape& operator=(const Tape&) = delete;
+
+        // number of recorded nodes
+        [[nodiscard]] core::index size() const noexcept { return size_; }
+        // nodes the current blocks hold before another block is drawn from the arena
+        [[nodiscard]] core::index capacity() const noexcept { return blocks_.size() * kBlock; }
+
+        // forget every node, the blocks stay for the next recording
+        void clear() noexcept { size_ = 0; }
+
+        // a new input
+        Var<T> variable(const T value) { return push(Op::kInput, 0, 0, T{}, value); }
+
+        // a constant the replay keeps as recorded
+        Var<T> constant(const T value) { return push(Op::kConst, 0, 0, T{}, value); }
+
+        [[nodiscard]] T value(const Var<T>& v) const noexcept { return v.is_constant() ? v.value() : node(v.id()).value; }
+        [[nodiscard]] T adjoint(const Var<T>& v) const noexcept { return v.is_constant() ? T{} : node(v.id()).adjoint; }
+
+        // new value for an input, takes effect for forward()
+        void set_value(const Var<T>& input, const T value) {
+            if (input.tape() != this || node(input.id()).op != Op::kInput) {
+                throw core::Error(core::ErrorCode::kInvalidArgument, "Tape::set_value(): not an input of this tape");
+            }
+            node(input.id()).value = value;
+        }
+
+        // recompute every node from the inputs in recording order
+        void forward() {
+            AXIOM_PROFILE_SCOPE("ad::Tape::forward");
+            for (core::index i = 0; i < size_; ++i) {
+                Node& n = node(i);
+                if (n.op == Op::kInput || n.op == Op::kConst) continue;
+                n.value = evaluate(n);
+            }
+        }
+
+        // adjoint(v) = dy / dv for every node v recorded before y
+        void backward(const Var<T>& y) {
+            if (y.is_constant()) {
+                for (core::index i = 0; i < size_; ++i) node(i).adjoint = T{};
+                return;
+            }
+            if (y.tape() != this) {
+                throw core::Error(core::ErrorCode::kInvalidArgument, "Tape::backward(): output is not on this tape");
+            }
+            AXIOM_PROFILE_SCOPE("ad::Tape::backward");
+            for (core::index i = 0; i < size_; ++i) node(i).adjoint = T{};
+            node(y.id()).adjoint = T{1};
+            for (core::index i = y.id() + 1; i-- > 0;) {
+                const Node& n = node(i);
+                if (n.adjoint != T{}) propagate(n);
+            }
+        }
+
+        // g[i] = dy / d inputs[i] after backward(y)
+        void gradient(std::span<const Var<T>> inputs, linalg::Vec<T>& g) const {
+            if (inputs.size() != g.size()) {
+                throw core::Error(core::ErrorCode::kShapeMismatch, "Tape::gradient(): g must have one element per input");
+            }
+            for (core::index i = 0; i < inputs.size(); ++i) g[i] = adjoint(inputs[i]);
+        }
+
+    private:
+        friend class Var<T>;
+
+        struct Node {
+            Op op;
+            core::index a;
+            core::index b;
+            T aux;                          // exponent of kPowConst
+            T value;
+            T adjoint;
+        };
+
+        core::Arena arena_{kBlock * sizeof(Node)};
+        std::vector<Node*> blocks_;
+        core::index size_ = 0;
+
+        Node& node(const core::index i) noexcept { return blocks_[i / kBlock][i % kBlock]; }
+        const Node& node(const core::index i) const noexcept { return blocks_[i / kBlock][i % kBlock]; }
+
+        Var<T> push(const Op op, const core::index a, const core::index b, const T aux, const T value) {
+            if (size_ == capacity()) {
+                blocks_.push_back(static_cast<Node*>(arena_.allocate(kBlock * sizeof(Node), alignof(Node))));
+            }
+            node(size_) = Node{op, a, b, aux, value, T{}};
+            return Var<T>(this, size_++, value);
+        }
+
+        T evaluate(const Node& n) const noexcept {
+            const T x = node(n.a).value;
+            switch (n.op) {
+                case Op::kAdd: return x + node(n.b).value;
+                case Op::kSub: return x - node(n.b).value;
+                case Op::kMul: return x * node(n.b).value;
+                case Op::kDiv: return x / node(n.b).value;
+                case Op::kNeg: return -x;
+                case Op::kAbs: return std::abs(x);
+                case Op::kSqrt: return std::sqrt(x);
+                case Op::kExp: return std::exp(x);
+                case Op::kLog: return std::log(x);
+                case Op::kSin: return std::sin(x);
+                case Op::kCos: return std::cos(x);
+                case Op::kTan: return std::tan(x);
+                case Op::kTanh: return std::tanh(x);
+                case Op::kPow: return std::pow(x, node(n.b).value);
+                case Op::kPowConst: return std::pow(x, n.aux);
+                case Op::kInput:
+                case Op::kConst: break;
+            }
+            return n.value;
+        }
+
+        // adds the node's adjoint times its local partials into its operands
+        void propagate(const Node& n) noexcept {
+            const T g = n.adjoint;
+            switch (n.op) {
+                case Op::kInput:
+                case Op::kConst: return;
+                case Op::kAdd:
+                    node(n.a).adjoint += g;
+                    node(n.b).adjoint += g;
+                    return;
+                case Op::kSub:
+                    node(n.a).adjoint += g;
+                    node(n.b).adjoint -= g;
+                    return;
+                case Op::kMul: {
+                    const T x = node(n.a).value, y = node(n.b).value;
+                    node(n.a).adjoint += g * y;
+                    node(n.b).adjoint += g * x;
+                    return;
+                }
+                case Op::kDiv: {
+                    const T y = node(n.b).value;
+                    node(n.a).adjoint += g / y;
+                    node(n.b).adjoint -= g * n.value / y;
+                    return;
+                }
+                case Op::kPow: {
+                    const T x = node(n.a).value, p = node(n.b).value;
+                    node(n.a).adjoint += g * p * std::pow(x, p - T{1});
+                    // the exponent's partial exists for x > 0 only
+                    if (x > T{}) node(n.b).adjoint += g * n.value * std::log(x);
+                    return;
+                }
+                default: break;
+            }
+            const T x = node(n.a).value;
+            T d{};
+            switch (n.op) {
+                case Op::kNeg: d = -T{1}; break;
+                case Op::kAbs: d = x < T{} ? -T{1} : T{1}; break;
+                case Op::kSqrt: d = T{1} / (T{2} * n.value); break;
+                case Op::kExp: d = n.value; break;
+                case Op::kLog: d = T{1} / x; break;
+                case Op::kSin: d = std::cos(x); break;
+                case Op::kCos: d = -std::sin(x); break;
+                case Op::kTan: d = T{1} + n.value * n.value; break;
+                case Op::kTanh: d = T{1} - n.value * n.value; break;
+                case Op::kPowConst: d = n.aux * std::pow(x, n.aux - T{1}); break;
+                default: break;
+            }
+            node(n.a).adjoint += g * d;
+        }
+    };
+
+    // reverse-mode gradient of f(const Vec<Var<T>>&) -> Var<T> with the signature opt/ expects of an
+    // objective with gradient; with replay the first call records and later calls replay it
+    template <std::floating_point T, typename F>
+    class ReverseGradient {
+    public:
+        ReverseGradient(const core::index n, F f, const bool replay = false)
+            : f_(std::move(f)), inputs_(n), replay_(replay) {}
+
+        [[nodiscard]] core::index size() const noexcept { return inputs_.size(); }
+        [[nodiscard]] const Tape<T>& tape() const noexcept { return tape_; }
+
+        // g = grad f(x), returns f(x)
+        T operator()(const linalg::Vec<T>& x, linalg::Vec<T>& g) {
+            if (x.size() != size() || g.size() != size()) {
+                throw core::Error(core::ErrorCode::kShapeMismatch, "ReverseGradient: x and g must have n elements");
+            }
+            if (replay_ && recorded_) {
+                for (core::index i = 0; i < size(); ++i) tape_.set_value(inputs_[i], x[i]);
+                tape_.forward();
+            } else {
+                tape_.clear();
+                for (core::index i = 0; i < size(); ++i) inputs_[i] = tape_.variable(x[i]);
+                output_ = f_(std::as_const(inputs_));
+                recorded_ = true;
+            }
+            tape_.backward(output_);
+            for (core::index i = 0; i < size(); ++i) g[i] = tape_.adjoint(inputs_[i]);
+            return tape_.value(output_);
+        }
+
+    private:
+        F f_;
+        Tape<T> tape_;
+        linalg::Vec<Var<T>> inputs_;
+        Var<T> output_;
+        bool replay_;
+        bool recorded_ = false;
+    };
+
+    template <std::floating_point T, typename F>
+    [[nodiscard]] ReverseGradient<T, F> reverse_gradient(const core::index n, F f, const bool replay = false) {
+        return ReverseGradient<T, F>(n, std::move(f), replay);
+    }
+}
+
+#endif //AXIOM_TAPE_HPP
\ No newline at end of file
@@ -1,12 +1,18 @@
 #ifndef AXIOM_CORE_HPP
 #define AXIOM_CORE_HPP
 
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
 #include <limits>
+#include <stdexcept>
 #include <string>
 
 namespace axiom::core {
 
-    enum class ErrorCode { kInvalidArgument, kShapeMismatch, kOutOfBounds, kDivideByZero };
+    enum class ErrorCode { kInvalidArgument, kShapeMismatch, kOutOfBounds, kDivideByZero, kSingularMatrix,
+                           kNotPositiveDefinite, kIoError };
 
     class Error final : public std::runtime_error {
     public:
@@ -22,6 +28,9 @@ namespace axiom::core {
     using real = double;
     using index = std::size_t;
 
+    // extent of a runtime-sized Vec / Mat dimension, compile-time sizes are any other value
+    inline constexpr index dynamic = std::numeric_limits<index>::max();
+
     template <typename T>
     constexpr T sq(T x) {
         return x * x;
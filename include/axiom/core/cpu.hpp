@@ -0,0 +1,23 @@
+#ifndef AXIOM_CPU_HPP
+#define AXIOM_CPU_HPP
+
+namespace axiom::core {
+
+    // instruction set levels the SIMD kernels are compiled for, ordered by capability
+    enum class Isa { kScalar, kSse2, kAvx2, kAvx512 };
+
+    // best level supported by both this build and the running cpu (cpuid, checked once)
+    [[nodiscard]] Isa detected_isa() noexcept;
+
+    // level used by kernel dispatch, defaults to detected_isa() capped by the AXIOM_ISA
+    // environment variable (scalar, sse2, avx2, avx512)
+    [[nodiscard]] Isa active_isa() noexcept;
+
+    // overrides the dispatch level, e.g. to compare kernels; throws if isa > detected_isa()
+    void set_active_isa(Isa isa);
+
+    [[nodiscard]] const char* isa_name(Isa isa) noexcept;
+
+}
+
+#endif //AXIOM_CPU_HPP
\ No newline at end of file
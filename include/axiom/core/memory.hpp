@@ -0,0 +1,146 @@
+#ifndef AXIOM_MEMORY_HPP
+#define AXIOM_MEMORY_HPP
+
+#include <cstddef>
+#include <memory_resource>
+#include <type_traits>
+#include <vector>
+
+#include "axiom/core/profile.hpp"
+
+namespace axiom::core {
+/*
+ * storage for Vec / Mat:
+ * - every buffer is 64-byte aligned (one cache line, one AVX-512 register)
+ * - buffers come from a std::pmr::memory_resource, the aligned heap by default or the thread's
+ *   arena inside an ArenaScope, so Vec<T> / Mat<T> stay the same type whatever backs them
+ * - heap and arena traffic is counted, a steady-state loop can check it did not touch the heap
+ *   (profiling builds also charge every buffer to the open profile scope, see profile.hpp)
+ */
+
+    inline constexpr std::size_t kAlignment = 64;
+
+    struct MemoryStats {
+        std::size_t heap_allocations = 0;
+        std::size_t heap_deallocations = 0;
+        std::size_t heap_bytes = 0;         // total bytes handed out by the heap resource
+        std::size_t arena_allocations = 0;
+        std::size_t arena_bytes = 0;
+    };
+
+    // process-wide counters (relaxed atomics)
+    MemoryStats memory_stats() noexcept;
+    void reset_memory_stats() noexcept;
+
+    // 64-byte aligned operator new / delete, the default resource for Vec / Mat
+    std::pmr::memory_resource* aligned_resource() noexcept;
+
+    // bump allocator over a list of chunks taken from aligned_resource(), deallocate is a no-op
+    // and memory is given back in bulk with rewind(), chunks are kept for reuse until release()
+    // not thread-safe, each thread has its own (thread_arena())
+    class Arena final : public std::pmr::memory_resource {
+    public:
+        struct Mark {
+            void* chunk;
+            std::byte* ptr;
+        };
+
+        explicit Arena(std::size_t chunk_bytes = std::size_t{1} << 16) noexcept;
+        ~Arena() override;
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        [[nodiscard]] Mark mark() const noexcept { return {cur_, ptr_}; }
+        // frees everything allocated after m in one go
+        void rewind(Mark m) noexcept;
+        // rewind to empty and give every chunk back to the heap, not inside an ArenaScope
+        void release() noexcept;
+
+        // bytes reserved from the heap across all chunks
+        [[nodiscard]] std::size_t capacity() const noexcept { return capacity_; }
+
+    private:
+        struct Chunk;
+
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+        void do_deallocate(void*, std::size_t, std::size_t) override {}
+        bool do_is_equal(const memory_resource& other) const noexcept override { return this == &other; }
+
+        std::byte* next_chunk(std::size_t bytes, std::size_t alignment);
+
+        Chunk* head_ = nullptr;
+        Chunk* cur_ = nullptr;
+        std::byte* ptr_ = nullptr;
+        std::byte* end_ = nullptr;
+        std::size_t chunk_bytes_;
+        std::size_t capacity_ = 0;
+    };
+
+    // this thread's arena, lives until the thread exits
+    Arena& thread_arena() noexcept;
+
+    // resource new Vec / Mat storage is drawn from on this thread
+    std::pmr::memory_resource* current_resource() noexcept;
+
+    // makes arena the current resource for the enclosing block and rewinds it on exit, so every
+    // Vec / Mat built inside is released in bulk, they must not outlive the scope
+    // copies of them (and move-assignment into older objects) land back on the outer resource
+    class ArenaScope {
+    public:
+        explicit ArenaScope(Arena& arena = thread_arena()) noexcept;
+        ~ArenaScope();
+        ArenaScope(const ArenaScope&) = delete;
+        ArenaScope& operator=(const ArenaScope&) = delete;
+
+    private:
+        Arena& arena_;
+        Arena::Mark mark_;
+        std::pmr::memory_resource* prev_;
+    };
+
+    // std allocator over a memory_resource with kAlignment, binds current_resource() when
+    // default-constructed, copies of a container re-bind instead of inheriting it
+    template <typename T>
+    class Allocator {
+        std::pmr::memory_resource* res_;
+
+        template <typename U> friend class Allocator;
+
+        static constexpr std::size_t kAlign = alignof(T) > kAlignment ? alignof(T) : kAlignment;
+
+    public:
+        using value_type = T;
+        using propagate_on_container_copy_assignment = std::false_type;
+        using propagate_on_container_move_assignment = std::false_type;
+        using propagate_on_container_swap = std::false_type;
+        using is_always_equal = std::false_type;
+
+        Allocator() noexcept : res_(current_resource()) {}
+        explicit Allocator(std::pmr::memory_resource* res) noexcept : res_(res) {}
+        template <typename U>
+        Allocator(const Allocator<U>& other) noexcept : res_(other.res_) {}
+
+        T* allocate(const std::size_t n) {
+            AXIOM_PROFILE_ALLOC(n * sizeof(T));
+            return static_cast<T*>(res_->allocate(n * sizeof(T), kAlign));
+        }
+        void deallocate(T* p, const std::size_t n) noexcept {
+            res_->deallocate(p, n * sizeof(T), kAlign);
+        }
+
+        Allocator select_on_container_copy_construction() const noexcept { return Allocator{}; }
+
+        [[nodiscard]] std::pmr::memory_resource* resource() const noexcept { return res_; }
+
+        template <typename U>
+        bool operator==(const Allocator<U>& other) const noexcept {
+            return res_ == other.res_ || res_->is_equal(*other.res_);
+        }
+    };
+
+    template <typename T>
+    using aligned_vector = std::vector<T, Allocator<T>>;
+
+}
+
+#endif //AXIOM_MEMORY_HPP
\ No newline at end of file
@@ -0,0 +1,18 @@
+#ifndef AXIOM_PARALLEL_HPP
+#define AXIOM_PARALLEL_HPP
+
+#include <thread>
+
+#include "axiom/core/core.hpp"
+
+namespace axiom::core {
+
+    // number of hardware threads, at least 1
+    inline index hardware_threads() noexcept {
+        const unsigned n = std::thread::hardware_concurrency();
+        return n == 0 ? 1 : n;
+    }
+
+}
+
+#endif //AXIOM_PARALLEL_HPP
\ No newline at end of file
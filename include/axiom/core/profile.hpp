@@ -0,0 +1,104 @@
+#ifndef AXIOM_PROFILE_HPP
+#define AXIOM_PROFILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "axiom/core/core.hpp"
+
+// can override w/ AXIOM_ENABLE_PROFILING=1/0 in CMake (option AXIOM_PROFILING), off by default
+#ifndef AXIOM_ENABLE_PROFILING
+  #define AXIOM_ENABLE_PROFILING 0
+#endif
+
+namespace axiom::core::profile {
+/*
+ * hot-path instrumentation, compiled out unless AXIOM_ENABLE_PROFILING=1:
+ * - AXIOM_PROFILE_SCOPE(name) times the enclosing scope, AXIOM_PROFILE_KERNEL(name, flops, bytes)
+ *   also counts the work of one call; name must be a string literal (or outlive the profile)
+ * - every Vec / Mat buffer (core::Allocator) is counted against the innermost open scope and,
+ *   when the scope closes, against its parents, so allocation counts are inclusive like times
+ * - each thread records into its own buffer (calls, times, counters and up to
+ *   kMaxEventsPerThread trace events), buffers outlive their threads and are merged by name
+ *   only when snapshot() / summary() / write_chrome_trace() are called
+ * - disabled, the macros expand to nothing (their arguments are not evaluated) and the functions
+ *   below return empty results
+ */
+
+    inline constexpr std::size_t kMaxEventsPerThread = std::size_t{1} << 20;
+
+    [[nodiscard]] constexpr bool enabled() noexcept { return AXIOM_ENABLE_PROFILING != 0; }
+
+    // totals of one scope name over all threads
+    struct Stats {
+        std::string name;
+        index calls = 0;
+        double seconds = 0.0;               // inclusive
+        double min_seconds = 0.0;
+        double max_seconds = 0.0;
+        double flops = 0.0;
+        double bytes = 0.0;
+        index allocations = 0;              // inclusive
+        std::size_t alloc_bytes = 0;
+        index threads = 0;                  // threads that ran the scope
+    };
+
+    // sorted by inclusive time, largest first
+    [[nodiscard]] std::vector<Stats> snapshot();
+
+    // fixed-width table of snapshot(), plus allocations made outside any scope and dropped events
+    [[nodiscard]] std::string summary();
+
+    // writes every recorded scope as a complete ("X") event of the Chrome trace format, for
+    // chrome://tracing or Perfetto, times in microseconds since the first event of the process
+    void write_chrome_trace(const std::string& path);
+
+    // forgets everything recorded so far on every thread
+    void reset();
+
+#if AXIOM_ENABLE_PROFILING
+    namespace detail {
+        class Scope {
+        public:
+            explicit Scope(const char* name, double flops = 0.0, double bytes = 0.0) noexcept;
+            ~Scope();
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            friend void record_alloc(std::size_t bytes);
+
+            const char* name_;
+            std::uint64_t begin_;
+            double flops_;
+            double bytes_;
+            index allocations_ = 0;
+            std::size_t alloc_bytes_ = 0;
+            Scope* parent_;
+        };
+
+        // may throw std::bad_alloc the first time a thread records, like the allocation it counts
+        void record_alloc(std::size_t bytes);
+    }
+#endif
+
+}
+
+#if AXIOM_ENABLE_PROFILING
+  #define AXIOM_PROFILE_CAT_(a, b) a##b
+  #define AXIOM_PROFILE_CAT(a, b) AXIOM_PROFILE_CAT_(a, b)
+  #define AXIOM_PROFILE_SCOPE(name) \
+    const ::axiom::core::profile::detail::Scope AXIOM_PROFILE_CAT(axiom_profile_scope_, __LINE__)(name)
+  #define AXIOM_PROFILE_KERNEL(name, flops, bytes) \
+    const ::axiom::core::profile::detail::Scope AXIOM_PROFILE_CAT(axiom_profile_scope_, __LINE__)( \
+        name, static_cast<double>(flops), static_cast<double>(bytes))
+  #define AXIOM_PROFILE_ALLOC(bytes) ::axiom::core::profile::detail::record_alloc(bytes)
+#else
+  #define AXIOM_PROFILE_SCOPE(name) ((void)0)
+  #define AXIOM_PROFILE_KERNEL(name, flops, bytes) ((void)0)
+  #define AXIOM_PROFILE_ALLOC(bytes) ((void)0)
+#endif
+
+#endif //AXIOM_PROFILE_HPP
\ No newline at end of file
@@ -0,0 +1,168 @@
+#ifndef AXIOM_EXEC_HPP
+#define AXIOM_EXEC_HPP
+
+#include <algorithm>
+#include <concepts>
+#include <type_traits>
+
+#include "axiom/core/core.hpp"
+#include "axiom/core/memory.hpp"
+#include "axiom/core/parallel.hpp"
+#include "axiom/exec/pool.hpp"
+
+namespace axiom::exec {
+/*
+ * execution policies and parallel algorithms on top of ThreadPool::global():
+ * - seq runs on the calling thread, par on the pool, e.g.
+ *   exec::Parallel{.threads = 4, .reproducible = true}
+ * - inputs below Parallel::min_size stay serial, grain 0 picks one that gives every thread
+ *   about 8 chunks and leaves the rest to work stealing
+ * - parallel_for(policy, n, body) calls body(lo, hi) on disjoint ranges covering [0, n)
+ * - in_units(policy, elements) adapts a policy to a loop over blocks (tiles, bands of rows) of
+ *   that many elements, so min_size / grain keep meaning elements
+ * - concurrency(policy, n) is the thread count a policy gives n elements, for code that cuts its
+ *   own slabs (kernels, factorizations); on_threads(t) is what a plain thread count meant before
+ *   policies (t threads, 0 = all, whatever the size) and backs the `threads` overloads
+ * - parallel_reduce(policy, n, identity, body, combine): body(lo, hi) returns the partial of a
+ *   range, partials are folded with combine, which has to be associative
+ * - reproducible = true cuts [0, n) into kReproducibleBlock sized blocks whatever the policy and
+ *   thread count, and folds the block partials in a fixed pairwise tree, so seq and par give
+ *   bitwise identical results on any number of threads; otherwise the partials of each thread
+ *   are folded in the order the work happened to be split
+ */
+
+    inline constexpr core::index kSerialCutoff = core::index{1} << 15;
+    inline constexpr core::index kReproducibleBlock = core::index{1} << 12;
+
+    struct Sequential {
+        bool reproducible = false;
+    };
+
+    struct Parallel {
+        core::index threads = 0;                // 0 = all threads of the pool
+        core::index grain = 0;                  // 0 = adaptive
+        core::index min_size = kSerialCutoff;   // smaller inputs run on the calling thread
+        bool reproducible = false;
+    };
+
+    inline constexpr Sequential seq{};
+    inline constexpr Parallel par{};
+
+    template <typename P>
+    concept ExecutionPolicy = std::same_as<std::remove_cvref_t<P>, Sequential> ||
+                              std::same_as<std::remove_cvref_t<P>, Parallel>;
+
+    namespace detail {
+        // threads a policy would use on n elements, 1 means serial
+        inline core::index resolve_threads(const Sequential&, core::index) noexcept { return 1; }
+        inline core::index resolve_threads(const Parallel& p, const core::index n) {
+            if (n < std::max<core::index>(p.min_size, 2) || ThreadPool::in_job()) return 1;
+            const core::index threads = p.threads == 0 ? ThreadPool::global().size() : p.threads;
+            return std::min(threads, n);
+        }
+
+        inline core::index resolve_grain(const Parallel& p, const core::index n, const core::index threads) noexcept {
+            return p.grain != 0 ? p.grain : std::max<core::index>(1, n / (threads * 8));
+        }
+
+        template <typename T>
+        struct alignas(64) Padded {
+            T value;
+        };
+
+        // folds p[0, n) pairwise: (p0 + p1) + (p2 + p3), ...
+        template <typename T, typename C>
+        T tree_fold(T* p, const core::index n, C& combine) {
+            for (core::index stride = 1; stride < n; stride *= 2) {
+                for (core::index i = 0; i + stride < n; i += 2 * stride) p[i] = combine(p[i], p[i + stride]);
+            }
+            return p[0];
+        }
+    }
+
+    // the policy for a loop over units of `elements` elements each (tiles, bands, blocks of rows),
+    // min_size and grain are given in elements and rescaled to units
+    template <ExecutionPolicy P>
+    [[nodiscard]] P in_units(const P& policy, const core::index elements) {
+        P units = policy;
+        if constexpr (std::same_as<P, Parallel>) {
+            const core::index e = std::max<core::index>(elements, 1);
+            units.min_size = (units.min_size + e - 1) / e;
+            units.grain = (units.grain + e - 1) / e;
+        }
+        return units;
+    }
+
+    // threads a policy puts on n elements, 1 means the calling thread alone
+    template <ExecutionPolicy P>
+    [[nodiscard]] core::index concurrency(const P& policy, const core::index n) {
+        return detail::resolve_threads(policy, n);
+    }
+
+    // up to `threads` threads (0 = all threads of the pool) on any input of two or more indices,
+    // one index per chunk
+    [[nodiscard]] constexpr Parallel on_threads(const core::index threads) noexcept {
+        return Parallel{.threads = threads, .grain = 1, .min_size = 2};
+    }
+
+    template <ExecutionPolicy P, typename F>
+        requires std::invocable<F&, core::index, core::index>
+    void parallel_for(const P& policy, const core::index n, F&& body) {
+        if (n == 0) return;
+        const core::index threads = detail::resolve_threads(policy, n);
+        if (threads <= 1) {
+            body(core::index{0}, n);
+            return;
+        }
+        if constexpr (std::same_as<P, Parallel>) {
+            ThreadPool::global().run(n, detail::resolve_grain(policy, n, threads), threads,
+                                     [&](const core::index lo, const core::index hi, core::index) { body(lo, hi); });
+        }
+    }
+
+    template <ExecutionPolicy P, typename T, typename F, typename C>
+        requires std::convertible_to<std::invoke_result_t<F&, core::index, core::index>, T> &&
+                 std::convertible_to<std::invoke_result_t<C&, T, T>, T>
+    T parallel_reduce(const P& policy, const core::index n, const T identity, F&& body, C&& combine) {
+        if (n == 0) return identity;
+        const core::index threads = detail::resolve_threads(policy, n);
+
+        if (policy.reproducible) {
+            const core::index blocks = (n + kReproducibleBlock - 1) / kReproducibleBlock;
+            if (blocks == 1) return combine(identity, static_cast<T>(body(core::index{0}, n)));
+            const core::ArenaScope scope;
+            core::aligned_vector<T> partial(blocks, identity);
+            const auto block = [&](const core::index b) {
+                const core::index lo = b * kReproducibleBlock;
+                partial[b] = static_cast<T>(body(lo, std::min(n, lo + kReproducibleBlock)));
+            };
+            if (threads <= 1) {
+                for (core::index b = 0; b < blocks; ++b) block(b);
+            } else {
+                ThreadPool::global().run(blocks, 1, std::min(threads, blocks),
+                                         [&](const core::index lo, const core::index hi, core::index) {
+                                             for (core::index b = lo; b < hi; ++b) block(b);
+                                         });
+            }
+            return combine(identity, detail::tree_fold(partial.data(), blocks, combine));
+        }
+
+        if (threads <= 1) return combine(identity, static_cast<T>(body(core::index{0}, n)));
+        if constexpr (std::same_as<P, Parallel>) {
+            const core::ArenaScope scope;
+            core::aligned_vector<detail::Padded<T>> acc(threads, detail::Padded<T>{identity});
+            ThreadPool::global().run(n, detail::resolve_grain(policy, n, threads), threads,
+                                     [&](const core::index lo, const core::index hi, const core::index id) {
+                                         acc[id].value = combine(acc[id].value, static_cast<T>(body(lo, hi)));
+                                     });
+            T result = identity;
+            for (const auto& a : acc) result = combine(result, a.value);
+            return result;
+        } else {
+            return identity;
+        }
+    }
+
+}
+
+#endif //AXIOM_EXEC_HPP
\ No newline at end of file
@@ -0,0 +1,67 @@
+#ifndef AXIOM_POOL_HPP
+#define AXIOM_POOL_HPP
+
+#include <memory>
+#include <type_traits>
+
+#include "axiom/core/core.hpp"
+
+namespace axiom::exec {
+/*
+ * work-stealing thread pool:
+ * - worker threads are started once and sleep between jobs, the calling thread always takes
+ *   part as participant 0
+ * - run() hands every participant an equal share of [0, n), a participant works through its
+ *   range `grain` indices at a time and, whenever its stealable slot is empty, splits off the
+ *   upper half of what is left (lazy binary splitting), idle participants steal those halves,
+ *   so chunks only get small when the load is uneven
+ * - one job at a time, calls from inside a job run serially on the calling participant
+ * - the pool grows on demand to the number of threads a caller asks for, nothing is allocated
+ *   per job, the first exception thrown by the body is rethrown once the job has drained
+ */
+
+    class ThreadPool {
+    public:
+        // threads counts the calling thread, 0 = core::hardware_threads()
+        explicit ThreadPool(core::index threads = 0);
+        ~ThreadPool();
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        // participants available to a job, including the calling thread
+        [[nodiscard]] core::index size() const noexcept;
+
+        // grows the pool to at least `threads` participants
+        void reserve(core::index threads);
+
+        // calls fn(lo, hi, participant) over disjoint ranges covering [0, n) with hi - lo <= grain,
+        // on up to `threads` participants (0 = size()), participant is in [0, threads)
+        template <typename F>
+        void run(const core::index n, const core::index grain, const core::index threads, F&& fn) {
+            using Fn = std::remove_reference_t<F>;
+            run_ranges(n, grain, threads, [](void* ctx, const core::index lo, const core::index hi,
+                                             const core::index participant) {
+                (*static_cast<Fn*>(ctx))(lo, hi, participant);
+            }, const_cast<void*>(static_cast<const void*>(&fn)));
+        }
+
+        // number of ranges taken from another participant since construction
+        [[nodiscard]] core::index steals() const noexcept;
+
+        // process-wide pool, started with core::hardware_threads() participants on first use
+        static ThreadPool& global();
+
+        // true on a thread that is currently running a job's body
+        [[nodiscard]] static bool in_job() noexcept;
+
+    private:
+        using RangeFn = void (*)(void*, core::index, core::index, core::index);
+        struct Impl;
+        std::unique_ptr<Impl> impl_;
+
+        void run_ranges(core::index n, core::index grain, core::index threads, RangeFn fn, void* ctx);
+    };
+
+}
+
+#endif //AXIOM_POOL_HPP
\ No newline at end of file
@@ -0,0 +1,208 @@
+#ifndef AXIOM_BINARY_HPP
+#define AXIOM_BINARY_HPP
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include "axiom/core/core.hpp"
+#include "axiom/core/memory.hpp"
+#include "axiom/linalg/mat.hpp"
+#include "axiom/linalg/vec.hpp"
+#include "axiom/linalg/view.hpp"
+
+namespace axiom::io {
+/*
+ * binary matrix files, loaded without parsing or copying:
+ * - MappedFile maps a whole file read-only (mmap / MapViewOfFile), pages are read lazily by the
+ *   OS on first touch, so opening a multi-GB file costs a few syscalls
+ * - MappedMat<T> is a read-only matrix over a mapping, view() is a MatView<const T> straight into
+ *   the file, copies share the mapping and keep it alive
+ * - the .axm format is a 64-byte little-endian header followed by the row-major data at a
+ *   64-byte aligned offset:
+ *     0  "AXIOMMAT"   8  u32 version   12 u32 dtype   16 u64 rows   24 u64 cols
+ *     32 u64 data offset   40 u64 alignment   48..63 zero
+ * - map_* needs the file dtype to be T, load_* copies into a Mat<T> and converts f32 <-> f64
+ * - .npy files (NumPy's format) go through the same types, see npy.hpp
+ */
+
+    enum class DType : std::uint32_t { kFloat32 = 1, kFloat64 = 2 };
+
+    [[nodiscard]] std::size_t dtype_size(DType dtype);
+    [[nodiscard]] const char* dtype_name(DType dtype);
+
+    template <std::floating_point T>
+    constexpr DType dtype_of() {
+        static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "dtype_of(): float or double only");
+        return std::is_same_v<T, float> ? DType::kFloat32 : DType::kFloat64;
+    }
+
+    // where a matrix sits in a file, strides are in elements
+    struct ArrayInfo {
+        DType dtype = DType::kFloat64;
+        core::index rows = 0;
+        core::index cols = 0;
+        core::index row_stride = 0;
+        core::index col_stride = 1;
+        std::size_t offset = 0;             // of element (0, 0), in bytes
+        core::index ndim = 2;               // 1 for a vector stored as rows x 1
+
+        [[nodiscard]] std::size_t bytes() const { return rows * cols * dtype_size(dtype); }
+    };
+
+    class MappedFile {
+    public:
+        explicit MappedFile(const std::string& path);
+        ~MappedFile();
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        [[nodiscard]] const std::byte* data() const noexcept { return data_; }
+        [[nodiscard]] std::size_t size() const noexcept { return size_; }
+        [[nodiscard]] const std::string& path() const noexcept { return path_; }
+
+    private:
+        std::string path_;
+        const std::byte* data_ = nullptr;
+        std::size_t size_ = 0;
+        void* handle_ = nullptr;            // mapping object on Windows
+    };
+
+    namespace detail {
+        // throws unless info describes a non-empty array lying inside the file
+        void check_array(const MappedFile& file, const ArrayInfo& info, const char* fn);
+    }
+
+    template <std::floating_point T>
+    class MappedMat {
+    public:
+        MappedMat(std::shared_ptr<const MappedFile> file, const ArrayInfo& info) : file_(std::move(file)), info_(info) {
+            const std::string& path = file_->path();
+            if (info.dtype != dtype_of<T>()) {
+                throw core::Error(core::ErrorCode::kInvalidArgument, "MappedMat(): " + path + " holds "
+                                  + dtype_name(info.dtype) + ", not " + dtype_name(dtype_of<T>()));
+            }
+            detail::check_array(*file_, info, "MappedMat()");
+            if (info.offset % alignof(T) != 0) {
+                throw core::Error(core::ErrorCode::kIoError, "MappedMat(): misaligned data in " + path);
+            }
+        }
+
+        [[nodiscard]] core::index rows() const noexcept { return info_.rows; }
+        [[nodiscard]] core::index cols() const noexcept { return info_.cols; }
+        [[nodiscard]] const ArrayInfo& info() const noexcept { return info_; }
+        [[nodiscard]] const T* data() const noexcept {
+            return reinterpret_cast<const T*>(file_->data() + info_.offset);
+        }
+
+        [[nodiscard]] linalg::MatView<const T> view() const noexcept {
+            return {data(), info_.rows, info_.cols, info_.row_stride, info_.col_stride};
+        }
+        const T& operator()(const core::index r, const core::index c) const noexcept {
+            return data()[r * info_.row_stride + c * info_.col_stride];
+        }
+
+    private:
+        std::shared_ptr<const MappedFile> file_;
+        ArrayInfo info_;
+    };
+
+    namespace detail {
+        [[nodiscard]] std::string axm_header(DType dtype, core::index rows, core::index cols);
+        [[nodiscard]] ArrayInfo parse_axm(const MappedFile& file);
+
+        template <std::floating_point T, typename S>
+        void copy_elements(T* dst, const std::byte* src, const std::size_t n) {
+            if constexpr (std::is_same_v<T, S>) {
+                std::memcpy(dst, src, n * sizeof(T));
+            } else {
+                for (std::size_t i = 0; i < n; ++i) {
+                    S s;
+                    std::memcpy(&s, src + i * sizeof(S), sizeof(S));
+                    dst[i] = static_cast<T>(s);
+                }
+            }
+        }
+
+        // copies a mapped array of either dtype into fresh row-major storage
+        template <std::floating_point T>
+        core::aligned_vector<T> copy_values(const MappedFile& file, const ArrayInfo& info, const char* fn) {
+            check_array(file, info, fn);
+            core::aligned_vector<T> out(info.rows * info.cols);
+            const std::size_t elem = dtype_size(info.dtype);
+            const std::byte* base = file.data() + info.offset;
+            const bool f32 = info.dtype == DType::kFloat32;
+            if (info.col_stride == 1 && info.row_stride == info.cols) {
+                if (f32) copy_elements<T, float>(out.data(), base, out.size());
+                else copy_elements<T, double>(out.data(), base, out.size());
+            } else {
+                for (core::index r = 0; r < info.rows; ++r) {
+                    for (core::index c = 0; c < info.cols; ++c) {
+                        const std::byte* src = base + (r * info.row_stride + c * info.col_stride) * elem;
+                        if (f32) copy_elements<T, float>(&out[r * info.cols + c], src, 1);
+                        else copy_elements<T, double>(&out[r * info.cols + c], src, 1);
+                    }
+                }
+            }
+            return out;
+        }
+
+        // streams a view to `out` row by row, contiguous rows in one write
+        template <typename T>
+        void write_rows(std::ofstream& out, const linalg::MatView<const T>& m) {
+            std::unique_ptr<T[]> row;
+            for (core::index r = 0; r < m.rows(); ++r) {
+                const T* src = &m(r, 0);
+                if (m.cols() > 1 && m.col_stride() != 1) {
+                    if (!row) row = std::make_unique<T[]>(m.cols());
+                    for (core::index c = 0; c < m.cols(); ++c) row[c] = m(r, c);
+                    src = row.get();
+                }
+                out.write(reinterpret_cast<const char*>(src), static_cast<std::streamsize>(m.cols() * sizeof(T)));
+            }
+        }
+
+        std::ofstream open_for_write(const std::string& path, const char* fn);
+        void finish_write(std::ofstream& out, const std::string& path, const char* fn);
+    }
+
+    [[nodiscard]] ArrayInfo read_matrix_info(const std::string& path);
+
+    template <typename T>
+        requires std::floating_point<std::remove_const_t<T>>
+    void save_matrix(const std::string& path, const linalg::MatView<T>& m) {
+        using V = std::remove_const_t<T>;
+        std::ofstream out = detail::open_for_write(path, "save_matrix()");
+        const std::string header = detail::axm_header(dtype_of<V>(), m.rows(), m.cols());
+        out.write(header.data(), static_cast<std::streamsize>(header.size()));
+        detail::write_rows(out, linalg::MatView<const V>(m));
+        detail::finish_write(out, path, "save_matrix()");
+    }
+
+    template <std::floating_point T>
+    void save_matrix(const std::string& path, const linalg::Mat<T>& m) {
+        save_matrix(path, m.view());
+    }
+
+    template <std::floating_point T>
+    MappedMat<T> map_matrix(const std::string& path) {
+        auto file = std::make_shared<const MappedFile>(path);
+        const ArrayInfo info = detail::parse_axm(*file);
+        return MappedMat<T>(std::move(file), info);
+    }
+
+    template <std::floating_point T>
+    linalg::Mat<T> load_matrix(const std::string& path) {
+        const MappedFile file(path);
+        const ArrayInfo info = detail::parse_axm(file);
+        return linalg::Mat<T>(detail::copy_values<T>(file, info, "load_matrix()"), info.cols);
+    }
+
+}
+
+#endif //AXIOM_BINARY_HPP
\ No newline at end of file
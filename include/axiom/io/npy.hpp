@@ -0,0 +1,94 @@
+#ifndef AXIOM_NPY_HPP
+#define AXIOM_NPY_HPP
+
+#include <concepts>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include "axiom/core/core.hpp"
+#include "axiom/io/binary.hpp"
+#include "axiom/linalg/mat.hpp"
+#include "axiom/linalg/vec.hpp"
+#include "axiom/linalg/view.hpp"
+
+namespace axiom::io {
+/*
+ * NumPy .npy files (format 1.0 - 3.0), for exchanging arrays with Python:
+ * - little-endian float32 / float64 arrays of 1 or 2 dimensions, C or Fortran order; a 1-D
+ *   array of n is read as an n x 1 matrix (or a Vec with load_npy_vec)
+ * - map_npy maps the file and views the data in place, a Fortran-order file becomes a
+ *   column-major MatView, nothing is copied
+ * - files are written as version 1.0, C order, with the header padded so the data starts at a
+ *   64-byte offset, like numpy.save does
+ */
+
+    namespace detail {
+        [[nodiscard]] std::string npy_header(DType dtype, core::index rows, core::index cols, core::index ndim);
+        [[nodiscard]] ArrayInfo parse_npy(const MappedFile& file);
+    }
+
+    [[nodiscard]] ArrayInfo read_npy_info(const std::string& path);
+
+    template <typename T>
+        requires std::floating_point<std::remove_const_t<T>>
+    void save_npy(const std::string& path, const linalg::MatView<T>& m) {
+        using V = std::remove_const_t<T>;
+        std::ofstream out = detail::open_for_write(path, "save_npy()");
+        const std::string header = detail::npy_header(dtype_of<V>(), m.rows(), m.cols(), 2);
+        out.write(header.data(), static_cast<std::streamsize>(header.size()));
+        detail::write_rows(out, linalg::MatView<const V>(m));
+        detail::finish_write(out, path, "save_npy()");
+    }
+
+    template <std::floating_point T>
+    void save_npy(const std::string& path, const linalg::Mat<T>& m) {
+        save_npy(path, m.view());
+    }
+
+    // written as a 1-D array
+    template <typename T>
+        requires std::floating_point<std::remove_const_t<T>>
+    void save_npy(const std::string& path, const linalg::VecView<T>& v) {
+        using V = std::remove_const_t<T>;
+        std::ofstream out = detail::open_for_write(path, "save_npy()");
+        const std::string header = detail::npy_header(dtype_of<V>(), v.size(), 1, 1);
+        out.write(header.data(), static_cast<std::streamsize>(header.size()));
+        detail::write_rows(out, linalg::MatView<const V>(v.data(), 1, v.size(), v.size() * v.stride(), v.stride()));
+        detail::finish_write(out, path, "save_npy()");
+    }
+
+    template <std::floating_point T>
+    void save_npy(const std::string& path, const linalg::Vec<T>& v) {
+        save_npy(path, v.view());
+    }
+
+    template <std::floating_point T>
+    MappedMat<T> map_npy(const std::string& path) {
+        auto file = std::make_shared<const MappedFile>(path);
+        const ArrayInfo info = detail::parse_npy(*file);
+        return MappedMat<T>(std::move(file), info);
+    }
+
+    template <std::floating_point T>
+    linalg::Mat<T> load_npy(const std::string& path) {
+        const MappedFile file(path);
+        const ArrayInfo info = detail::parse_npy(file);
+        return linalg::Mat<T>(detail::copy_values<T>(file, info, "load_npy()"), info.cols);
+    }
+
+    // any array with a single row or column
+    template <std::floating_point T>
+    linalg::Vec<T> load_npy_vec(const std::string& path) {
+        const MappedFile file(path);
+        const ArrayInfo info = detail::parse_npy(file);
+        if (info.rows != 1 && info.cols != 1) {
+            throw core::Error(core::ErrorCode::kShapeMismatch, "load_npy_vec(): " + path + " is not a vector");
+        }
+        return linalg::Vec<T>(detail::copy_values<T>(file, info, "load_npy_vec()"));
+    }
+
+}
+
+#endif //AXIOM_NPY_HPP
\ No newline at end of file
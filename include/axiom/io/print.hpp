@@ -1,4 +1,93 @@
 #ifndef AXIOM_PRINT_HPP
 #define AXIOM_PRINT_HPP
 
+#include <charconv>
+#include <ostream>
+#include <string>
+
+#include "axiom/core/core.hpp"
+#include "axiom/exec/exec.hpp"
+#include "axiom/linalg/mat.hpp"
+#include "axiom/linalg/vec.hpp"
+#include "axiom/linalg/view.hpp"
+
+namespace axiom::io {
+/*
+ * text formatting of vectors and matrices with std::to_chars:
+ * - no locale, no streams, no per-element allocation; the default precision prints the
+ *   shortest text that reads back to the same value
+ * - a vector is one line, a matrix one line per row, fields separated by `delimiter`
+ * - edge_items > 0 abbreviates larger matrices to their first and last edge_items rows and
+ *   columns with "..." in between, for debug dumps of big operands
+ * - an exec policy first argument formats blocks of 64 rows on the pool and joins them in order,
+ *   min_size / grain count elements; without one large matrices use exec::par
+ */
+
+    struct PrintOptions {
+        int precision = -1;                                 // digits, -1 = shortest round-trip form
+        std::chars_format format = std::chars_format::general;
+        char delimiter = ' ';
+        core::index edge_items = 0;                         // 0 prints everything
+    };
+
+    // appends one value
+    void append(std::string& out, double value, const PrintOptions& options = {});
+    void append(std::string& out, float value, const PrintOptions& options = {});
+
+    // appends the rows of m, each terminated by '\n'
+    template <exec::ExecutionPolicy P>
+    void append(const P& policy, std::string& out, const linalg::MatView<const double>& m,
+                const PrintOptions& options = {});
+    template <exec::ExecutionPolicy P>
+    void append(const P& policy, std::string& out, const linalg::MatView<const float>& m,
+                const PrintOptions& options = {});
+
+    inline void append(std::string& out, const linalg::MatView<const double>& m, const PrintOptions& options = {}) {
+        append(exec::par, out, m, options);
+    }
+
+    inline void append(std::string& out, const linalg::MatView<const float>& m, const PrintOptions& options = {}) {
+        append(exec::par, out, m, options);
+    }
+
+    template <linalg::VecLike V>
+    std::string to_string(const V& v, const PrintOptions& options = {}) {
+        const auto x = linalg::detail::cview(v);
+        std::string out;
+        append(out, linalg::MatView<const linalg::scalar_t<V>>(x.data(), 1, x.size(), 0, x.stride()), options);
+        out.pop_back();
+        return out;
+    }
+
+    template <exec::ExecutionPolicy P, linalg::MatLike M>
+    std::string to_string(const P& policy, const M& m, const PrintOptions& options = {}) {
+        std::string out;
+        append(policy, out, linalg::detail::cview(m), options);
+        return out;
+    }
+
+    template <linalg::MatLike M>
+    std::string to_string(const M& m, const PrintOptions& options = {}) {
+        return to_string(exec::par, m, options);
+    }
+
+    template <typename X>
+        requires linalg::VecLike<X> || linalg::MatLike<X>
+    void print(std::ostream& os, const X& x, const PrintOptions& options = {}) {
+        const std::string s = to_string(x, options);
+        os.write(s.data(), static_cast<std::streamsize>(s.size()));
+        if constexpr (linalg::VecLike<X>) os.put('\n');
+    }
+
+}
+
+namespace axiom::linalg {
+    template <typename X>
+        requires VecLike<X> || MatLike<X>
+    std::ostream& operator<<(std::ostream& os, const X& x) {
+        const std::string s = io::to_string(x);
+        return os.write(s.data(), static_cast<std::streamsize>(s.size()));
+    }
+}
+
 #endif //AXIOM_PRINT_HPP
\ No newline at end of file
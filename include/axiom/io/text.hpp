@@ -0,0 +1,105 @@
+#ifndef AXIOM_TEXT_HPP
+#define AXIOM_TEXT_HPP
+
+#include <concepts>
+#include <string>
+#include <string_view>
+
+#include "axiom/core/core.hpp"
+#include "axiom/exec/exec.hpp"
+#include "axiom/io/print.hpp"
+#include "axiom/linalg/mat.hpp"
+#include "axiom/linalg/sparse.hpp"
+#include "axiom/linalg/view.hpp"
+
+namespace axiom::io {
+/*
+ * CSV and Matrix Market text, parsed with std::from_chars:
+ * - the input is split into chunks of about 64 KiB at line boundaries, a first parallel pass
+ *   counts the rows of every chunk, a second parses each chunk straight into its rows of the
+ *   result, so nothing is allocated per line or per field
+ * - an exec policy first argument runs the chunks on the pool, min_size / grain count bytes of
+ *   text; without one the readers use exec::par, small inputs still stay on the calling thread
+ * - files are read through MappedFile (binary.hpp), the text is never copied
+ * - CSV holds numbers only (no quoting), blank lines are skipped, every row must have the same
+ *   number of fields; ' ' or '\t' as the delimiter accepts any run of blanks
+ * - Matrix Market: coordinate and array, real / integer / pattern, general / symmetric /
+ *   skew-symmetric; coordinate entries go through CsrMat::from_triplets, so duplicates are summed
+ * - errors throw ErrorCode::kIoError naming the line
+ * - the templates are instantiated for float / double and both policies in text.cpp
+ */
+
+    struct CsvOptions {
+        char delimiter = ',';
+        bool header = false;                // skip the first line
+        core::index cols = 0;               // 0 = fields on the first row
+    };
+
+    template <std::floating_point T, exec::ExecutionPolicy P>
+    linalg::Mat<T> parse_csv(const P& policy, std::string_view text, const CsvOptions& options = {});
+
+    template <std::floating_point T>
+    linalg::Mat<T> parse_csv(const std::string_view text, const CsvOptions& options = {}) {
+        return parse_csv<T>(exec::par, text, options);
+    }
+
+    template <std::floating_point T, exec::ExecutionPolicy P>
+    linalg::Mat<T> read_csv(const P& policy, const std::string& path, const CsvOptions& options = {});
+
+    template <std::floating_point T>
+    linalg::Mat<T> read_csv(const std::string& path, const CsvOptions& options = {}) {
+        return read_csv<T>(exec::par, path, options);
+    }
+
+    // coordinate files, an array file is converted
+    template <std::floating_point T, exec::ExecutionPolicy P>
+    linalg::CsrMat<T> parse_matrix_market(const P& policy, std::string_view text);
+
+    template <std::floating_point T>
+    linalg::CsrMat<T> parse_matrix_market(const std::string_view text) {
+        return parse_matrix_market<T>(exec::par, text);
+    }
+
+    template <std::floating_point T, exec::ExecutionPolicy P>
+    linalg::CsrMat<T> read_matrix_market(const P& policy, const std::string& path);
+
+    template <std::floating_point T>
+    linalg::CsrMat<T> read_matrix_market(const std::string& path) {
+        return read_matrix_market<T>(exec::par, path);
+    }
+
+    // array files, a coordinate file is expanded
+    template <std::floating_point T, exec::ExecutionPolicy P>
+    linalg::Mat<T> parse_matrix_market_dense(const P& policy, std::string_view text);
+
+    template <std::floating_point T>
+    linalg::Mat<T> parse_matrix_market_dense(const std::string_view text) {
+        return parse_matrix_market_dense<T>(exec::par, text);
+    }
+
+    template <std::floating_point T, exec::ExecutionPolicy P>
+    linalg::Mat<T> read_matrix_market_dense(const P& policy, const std::string& path);
+
+    template <std::floating_point T>
+    linalg::Mat<T> read_matrix_market_dense(const std::string& path) {
+        return read_matrix_market_dense<T>(exec::par, path);
+    }
+
+    // fields separated by options.delimiter, every row and column is written (edge_items is ignored)
+    void write_csv(const std::string& path, const linalg::MatView<const double>& m,
+                   const PrintOptions& options = {.delimiter = ','});
+    void write_csv(const std::string& path, const linalg::MatView<const float>& m,
+                   const PrintOptions& options = {.delimiter = ','});
+
+    template <linalg::MatLike M>
+    void write_csv(const std::string& path, const M& m, const PrintOptions& options = {.delimiter = ','}) {
+        write_csv(path, linalg::detail::cview(m), options);
+    }
+
+    // coordinate real general, 1-based indices, options.delimiter is ignored
+    template <std::floating_point T>
+    void write_matrix_market(const std::string& path, const linalg::CsrMat<T>& m, const PrintOptions& options = {});
+
+}
+
+#endif //AXIOM_TEXT_HPP
\ No newline at end of file
@@ -0,0 +1,228 @@
+#ifndef AXIOM_BATCH_HPP
+#define AXIOM_BATCH_HPP
+
+#include <algorithm>
+#include <concepts>
+#include <span>
+
+#include "axiom/core/core.hpp"
+#include "axiom/core/memory.hpp"
+#include "axiom/exec/exec.hpp"
+#include "axiom/linalg/fixed.hpp"
+#include "axiom/linalg/kernels.hpp"
+#include "axiom/linalg/mat.hpp"
+#include "axiom/linalg/view.hpp"
+
+namespace axiom::linalg {
+/*
+ * batches of 3-vectors in structure-of-arrays layout:
+ * - Batch3<T> keeps the x, y and z components in three 64-byte aligned lanes of one
+ *   allocation, x() / y() / z() view them as contiguous vectors
+ * - dot / cross / normalize / reflect over whole batches check the sizes once and write into an
+ *   existing output, then run one SIMD kernel (kernels.hpp) over the lanes, nothing is allocated
+ * - outputs may be one of the inputs (in place)
+ * - unlike normalize() on a single vector, a zero vector in a batch is written as zero rather
+ *   than throwing, so one bad element does not stop the batch
+ * - an exec policy first argument splits the batch into ranges run on the thread pool, ranges
+ *   start on whole cache lines so no two threads write the same line and the results match the
+ *   sequential run bit for bit
+ */
+
+    template <std::floating_point T>
+    class Batch3 {
+    public:
+        using value_type = T;
+
+        Batch3() = default;
+
+        // n zero vectors
+        explicit Batch3(const core::index n) : data_(3 * padded(n), T{}), size_(n), stride_(padded(n)) {}
+
+        // from the rows of an n x 3 matrix or view
+        template <MatLike M>
+            requires std::same_as<scalar_t<M>, T>
+        static Batch3 from_rows(const M& m) {
+            const auto a = detail::cview(m);
+            if (a.cols() != 3) {
+                throw core::Error(core::ErrorCode::kShapeMismatch, "Batch3::from_rows(): matrix must have 3 columns");
+            }
+            Batch3 b(a.rows());
+            for (core::index i = 0; i < a.rows(); ++i) b.set(i, Vec<T, 3>(a(i, 0), a(i, 1), a(i, 2)));
+            return b;
+        }
+
+        static Batch3 from_vectors(std::span<const Vec<T, 3>> vectors) {
+            Batch3 b(vectors.size());
+            for (core::index i = 0; i < vectors.size(); ++i) b.set(i, vectors[i]);
+            return b;
+        }
+
+        [[nodiscard]] core::index size() const noexcept { return size_; }
+        [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+        // component lanes
+        VecView<T> x() noexcept { return {lane(0), size_}; }
+        VecView<T> y() noexcept { return {lane(1), size_}; }
+        VecView<T> z() noexcept { return {lane(2), size_}; }
+        VecView<const T> x() const noexcept { return {lane(0), size_}; }
+        VecView<const T> y() const noexcept { return {lane(1), size_}; }
+        VecView<const T> z() const noexcept { return {lane(2), size_}; }
+
+        kernels::Lanes3<T> lanes() noexcept { return {lane(0), lane(1), lane(2)}; }
+        kernels::Lanes3<const T> lanes() const noexcept { return {lane(0), lane(1), lane(2)}; }
+
+        // element i gathered from the lanes
+        Vec<T, 3> operator[](const core::index i) const noexcept {
+            return {lane(0)[i], lane(1)[i], lane(2)[i]};
+        }
+
+        Vec<T, 3> at(const core::index i) const {
+            check_index(i);
+            return (*this)[i];
+        }
+
+        void set(const core::index i, const Vec<T, 3>& v) {
+            check_index(i);
+            lane(0)[i] = v[0];
+            lane(1)[i] = v[1];
+            lane(2)[i] = v[2];
+        }
+
+        // keeps the first min(n, size()) vectors, new ones are zero
+        void resize(const core::index n) {
+            if (n == size_) return;
+            Batch3 b(n);
+            const core::index keep = std::min(n, size_);
+            for (core::index c = 0; c < 3; ++c) std::copy(lane(c), lane(c) + keep, b.lane(c));
+            *this = std::move(b);
+        }
+
+        // n x 3, one vector per row
+        [[nodiscard]] Mat<T> to_rows() const {
+            Mat<T> m(size_, 3);
+            for (core::index i = 0; i < size_; ++i) {
+                for (core::index c = 0; c < 3; ++c) m(i, c) = lane(c)[i];
+            }
+            return m;
+        }
+
+    private:
+        core::aligned_vector<T> data_;
+        core::index size_ = 0;
+        core::index stride_ = 0;
+
+        // lane length rounded up to whole 64-byte lines, so every lane starts aligned
+        static core::index padded(const core::index n) noexcept {
+            constexpr core::index per_line = core::kAlignment / sizeof(T);
+            return (n + per_line - 1) / per_line * per_line;
+        }
+
+        T* lane(const core::index c) noexcept { return data_.data() + c * stride_; }
+        const T* lane(const core::index c) const noexcept { return data_.data() + c * stride_; }
+
+        void check_index(const core::index i) const {
+            if (i >= size_) throw core::Error(core::ErrorCode::kOutOfBounds, "Batch3: index out of bounds");
+        }
+    };
+
+    namespace detail {
+        template <typename T>
+        kernels::Lanes3<T> advance(const kernels::Lanes3<T> l, const core::index i) noexcept {
+            return {l.x + i, l.y + i, l.z + i};
+        }
+
+        inline void check_batch(const bool same, const char* msg) {
+            if (!same) throw core::Error(core::ErrorCode::kShapeMismatch, msg);
+        }
+
+        // parallel_for over ranges of whole 64-byte lines, min_size and grain stay in elements
+        template <typename T, exec::ExecutionPolicy P, typename F>
+        void for_each_range(const P& policy, const core::index n, F&& body) {
+            constexpr core::index per_line = core::kAlignment / sizeof(T);
+            P lines = policy;
+            if constexpr (std::same_as<P, exec::Parallel>) {
+                lines.min_size = (lines.min_size + per_line - 1) / per_line;
+                lines.grain = (lines.grain + per_line - 1) / per_line;
+            }
+            exec::parallel_for(lines, (n + per_line - 1) / per_line, [&](const core::index lo, const core::index hi) {
+                body(lo * per_line, std::min(hi * per_line, n));
+            });
+        }
+
+        template <typename T, typename V>
+        T* batch_out(V& out, const core::index n, const char* msg) {
+            auto o = detail::mview(out);
+            check_batch(o.size() == n, msg);
+            if (!o.contiguous()) throw core::Error(core::ErrorCode::kInvalidArgument, msg);
+            return o.data();
+        }
+    }
+
+    // out[i] = a_i . b_i
+    template <exec::ExecutionPolicy P, std::floating_point T, WritableVec O>
+        requires std::same_as<scalar_t<O>, T>
+    void dot(const P& policy, const Batch3<T>& a, const Batch3<T>& b, O&& out) {
+        const core::index n = a.size();
+        detail::check_batch(b.size() == n, "dot(batch): batches must be of same size");
+        T* o = detail::batch_out<T>(out, n, "dot(batch): out must be a contiguous vector of the batch size");
+        detail::for_each_range<T>(policy, n, [&](const core::index lo, const core::index hi) {
+            kernels::dot3(hi - lo, detail::advance(a.lanes(), lo), detail::advance(b.lanes(), lo), o + lo);
+        });
+    }
+
+    template <std::floating_point T, WritableVec O>
+        requires std::same_as<scalar_t<O>, T>
+    void dot(const Batch3<T>& a, const Batch3<T>& b, O&& out) {
+        dot(exec::seq, a, b, std::forward<O>(out));
+    }
+
+    // out_i = a_i x b_i
+    template <exec::ExecutionPolicy P, std::floating_point T>
+    void cross(const P& policy, const Batch3<T>& a, const Batch3<T>& b, Batch3<T>& out) {
+        const core::index n = a.size();
+        detail::check_batch(b.size() == n && out.size() == n, "cross(batch): batches must be of same size");
+        detail::for_each_range<T>(policy, n, [&](const core::index lo, const core::index hi) {
+            kernels::cross3(hi - lo, detail::advance(a.lanes(), lo), detail::advance(b.lanes(), lo),
+                            detail::advance(out.lanes(), lo));
+        });
+    }
+
+    template <std::floating_point T>
+    void cross(const Batch3<T>& a, const Batch3<T>& b, Batch3<T>& out) {
+        cross(exec::seq, a, b, out);
+    }
+
+    // out_i = a_i / |a_i|, zero vectors stay zero
+    template <exec::ExecutionPolicy P, std::floating_point T>
+    void normalize(const P& policy, const Batch3<T>& a, Batch3<T>& out) {
+        const core::index n = a.size();
+        detail::check_batch(out.size() == n, "normalize(batch): batches must be of same size");
+        detail::for_each_range<T>(policy, n, [&](const core::index lo, const core::index hi) {
+            kernels::normalize3(hi - lo, detail::advance(a.lanes(), lo), detail::advance(out.lanes(), lo));
+        });
+    }
+
+    template <std::floating_point T>
+    void normalize(const Batch3<T>& a, Batch3<T>& out) {
+        normalize(exec::seq, a, out);
+    }
+
+    // out_i = v_i - 2 (v_i . n_i) n_i, n_i should be unit length
+    template <exec::ExecutionPolicy P, std::floating_point T>
+    void reflect(const P& policy, const Batch3<T>& v, const Batch3<T>& n, Batch3<T>& out) {
+        const core::index size = v.size();
+        detail::check_batch(n.size() == size && out.size() == size, "reflect(batch): batches must be of same size");
+        detail::for_each_range<T>(policy, size, [&](const core::index lo, const core::index hi) {
+            kernels::reflect3(hi - lo, detail::advance(v.lanes(), lo), detail::advance(n.lanes(), lo),
+                              detail::advance(out.lanes(), lo));
+        });
+    }
+
+    template <std::floating_point T>
+    void reflect(const Batch3<T>& v, const Batch3<T>& n, Batch3<T>& out) {
+        reflect(exec::seq, v, n, out);
+    }
+
+}
+
+#endif //AXIOM_BATCH_HPP
\ No newline at end of file
@@ -1,4 +1,863 @@
 #ifndef AXIOM_DECOMPOSITION_HPP
 #define AXIOM_DECOMPOSITION_HPP
 
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "axiom/core/core.hpp"
+#include "axiom/core/profile.hpp"
+#include "axiom/exec/exec.hpp"
+#include "axiom/linalg/kernels.hpp"
+#include "axiom/linalg/mat.hpp"
+#include "axiom/linalg/ops.hpp"
+#include "axiom/linalg/vec.hpp"
+#include "axiom/linalg/view.hpp"
+
+namespace axiom::linalg {
+/*
+ * dense factorizations over row-major Mat<T>
+ *
+ * LU (P A = L U, partial pivoting):
+ * - right-looking and blocked: a panel of `block` columns is factored unblocked, the matching
+ *   rows of U are formed with a unit-lower triangular solve, and the trailing submatrix is
+ *   updated with one gemm (A22 -= L21 U12), so almost all flops run on the packed SIMD kernel
+ * - L (unit diagonal, not stored) and U share the storage of the factored matrix, pivots are
+ *   kept LAPACK style: row i was swapped with row pivots()[i], in order
+ * - an exactly zero pivot marks the factorization singular, determinant() is then 0 and
+ *   solve() / inverse() throw ErrorCode::kSingularMatrix
+ * - a factorization is reusable: every solve() costs O(n^2 k) for k right-hand sides, and the
+ *   triangular solves are blocked the same way
+ *
+ * Cholesky (A = L L^T, A symmetric positive definite):
+ * - same blocked right-looking shape at half the flops of LU: the diagonal block is factored
+ *   unblocked, L21 = A21 L11^-T row by row, and the trailing update only touches the lower
+ *   triangle (one gemm per block row), a parallel policy splits the L21 rows and the block rows
+ * - the first pivot that is not positive (or not finite) throws ErrorCode::kNotPositiveDefinite
+ *   naming the column, before any work on the rest of the matrix
+ * - pass an rvalue to factor in place, only the lower triangle of A is read
+ *
+ * QR (A = Q R, m x n with m >= n, Householder):
+ * - reflectors are stored below the diagonal of R with their tau, every `block` columns are
+ *   combined into a compact WY block reflector I - V T V^T, so the trailing update and every
+ *   application of Q / Q^T is two gemms plus small triangular work
+ * - the panel itself is factored row by row, which keeps a tall-skinny A streaming through
+ *   cache in storage order
+ * - lstsq(A, b) solves min |A x - b| through R x = Q^T b, never forming A^T A, very tall
+ *   inputs can take a parallel TSQR reduction instead
+ *
+ * every factorization takes an execution policy first (min_size counts the multiply-adds of the
+ * factorization), the thread count it resolves to also splits later solves; the forms ending
+ * in `threads` map to exec::on_threads(threads)
+ */
+
+    namespace detail {
+        // C += alpha A B on raw blocks (A m x k and B k x n strided, C row-major), the blocks never overlap
+        template <typename T>
+        void gemm_acc(const core::index m, const core::index n, const core::index k, const T alpha,
+                      const T* a, const core::index rsa, const core::index csa,
+                      const T* b, const core::index rsb, const core::index csb,
+                      T* c, const core::index ldc, const core::index threads) {
+            if (m == 0 || n == 0 || k == 0) return;
+            if constexpr (kernels::has_simd<T>) {
+                kernels::gemm(m, n, k, alpha, a, rsa, csa, b, rsb, csb, T{1}, c, ldc, 1, threads);
+            } else {
+                for (core::index i = 0; i < m; ++i) {
+                    for (core::index p = 0; p < k; ++p) {
+                        const T aip = alpha * a[i * rsa + p * csa];
+                        for (core::index j = 0; j < n; ++j) c[i * ldc + j] += aip * b[p * rsb + j * csb];
+                    }
+                }
+            }
+        }
+
+        // C -= A B
+        template <typename T>
+        void gemm_sub(const core::index m, const core::index n, const core::index k,
+                      const T* a, const core::index rsa, const core::index csa,
+                      const T* b, const core::index rsb, const core::index csb,
+                      T* c, const core::index ldc, const core::index threads) {
+            gemm_acc(m, n, k, T{-1}, a, rsa, csa, b, rsb, csb, c, ldc, threads);
+        }
+
+        // row i of C -= sum over p < i of L(i, p) row p of C, for the rows of one diagonal block
+        template <typename T>
+        void unit_lower_rows(const core::index rows, const core::index n, const T* l, const core::index ldl,
+                             T* c, const core::index ldc) {
+            for (core::index i = 1; i < rows; ++i) {
+                T* ci = c + i * ldc;
+                for (core::index p = 0; p < i; ++p) {
+                    const T lip = l[i * ldl + p];
+                    if (lip == T{}) continue;
+                    const T* cp = c + p * ldc;
+                    for (core::index j = 0; j < n; ++j) ci[j] -= lip * cp[j];
+                }
+            }
+        }
+    }
+
+    template <typename T>
+        requires std::floating_point<T>
+    class LU {
+    public:
+        static constexpr core::index kDefaultBlock = 64;
+
+        // factors A in place, pass an rvalue to reuse its storage
+        template <exec::ExecutionPolicy P>
+        explicit LU(const P& policy, Mat<T> A, const core::index block = kDefaultBlock)
+            : lu_(std::move(A)), pivots_(lu_.rows()),
+              threads_(exec::concurrency(policy, lu_.rows() * lu_.rows() * lu_.cols())) {
+            if (lu_.rows() != lu_.cols()) {
+                throw core::Error(core::ErrorCode::kShapeMismatch, "LU(): matrix must be square");
+            }
+            if (block == 0) {
+                throw core::Error(core::ErrorCode::kInvalidArgument, "LU(): block size must be positive");
+            }
+            block_ = block;
+            factor();
+        }
+
+        explicit LU(Mat<T> A, const core::index block = kDefaultBlock, const core::index threads = 1)
+            : LU(exec::on_threads(threads), std::move(A), block) {}
+
+        [[nodiscard]] core::index size() const noexcept { return lu_.rows(); }
+        [[nodiscard]] bool is_singular() const noexcept { return singular_; }
+
+        // L below the diagonal (unit diagonal implied) and U on and above it
+        [[nodiscard]] const Mat<T>& packed() const noexcept { return lu_; }
+        [[nodiscard]] const std::vector<core::index>& pivots() const noexcept { return pivots_; }
+
+        [[nodiscard]] Mat<T> lower() const {
+            const core::index n = size();
+            Mat<T> L(n, n);
+            for (core::index i = 0; i < n; ++i) {
+                for (core::index j = 0; j < i; ++j) L(i, j) = lu_(i, j);
+                L(i, i) = T{1};
+            }
+            return L;
+        }
+
+        [[nodiscard]] Mat<T> upper() const {
+            const core::index n = size();
+            Mat<T> U(n, n);
+            for (core::index i = 0; i < n; ++i) {
+                for (core::index j = i; j < n; ++j) U(i, j) = lu_(i, j);
+            }
+            return U;
+        }
+
+        [[nodiscard]] T determinant() const noexcept {
+            if (singular_) return T{};
+            T det = sign_;
+            for (core::index i = 0; i < size(); ++i) det *= lu_(i, i);
+            return det;
+        }
+
+        // solves A x = b / A X = B, right-hand sides may be any vector / matrix or view
+        template <VecLike V>
+            requires std::same_as<scalar_t<V>, T>
+        [[nodiscard]] Vec<T> solve(const V& b) const {
+            Vec<T> x(detail::cview(b));
+            solve_in_place(x);
+            return x;
+        }
+
+        template <MatLike M>
+            requires std::same_as<scalar_t<M>, T>
+        [[nodiscard]] Mat<T> solve(const M& B) const {
+            Mat<T> X(detail::cview(B));
+            solve_in_place(X);
+            return X;
+        }
+
+        void solve_in_place(Vec<T>& b) const {
+            if (b.size() != size()) {
+                throw core::Error(core::ErrorCode::kShapeMismatch, "LU::solve(): b must have A.rows() elements");
+            }
+            substitute(b.data(), 1, 1);
+        }
+
+        void solve_in_place(Mat<T>& B) const {
+            if (B.rows() != size()) {
+                throw core::Error(core::ErrorCode::kShapeMismatch, "LU::solve(): B must have A.rows() rows");
+            }
+            substitute(B.data(), B.cols(), B.cols());
+        }
+
+        [[nodiscard]] Mat<T> inverse() const {
+            Mat<T> X = Mat<T>::identity(size());
+            solve_in_place(X);
+            return X;
+        }
+
+    private:
+        Mat<T> lu_;
+        std::vector<core::index> pivots_;
+        core::index block_ = kDefaultBlock;
+        core::index threads_ = 1;
+        T sign_{1};
+        bool singular_ = false;
+
+        void swap_rows(T* a, const core::index lda, const core::index r0, const core::index r1,
+                       const core::index n) const {
+            if (r0 != r1) std::swap_ranges(a + r0 * lda, a + r0 * lda + n, a + r1 * lda);
+        }
+
+        void factor() {
+            const core::index n = size();
+            AXIOM_PROFILE_KERNEL("linalg::LU::factor", 2 * n * n * n / 3, 2 * sizeof(T) * n * n);
+            T* a = lu_.data();
+            for (core::index k0 = 0; k0 < n; k0 += block_) {
+                const core::index kb = std::min(block_, n - k0);
+                const core::index k1 = k0 + kb;
+
+                // unblocked panel: columns [k0, k1), rows [k0, n), swaps move whole rows
+                for (core::index j = k0; j < k1; ++j) {
+                    core::index p = j;
+                    T best = std::abs(a[j * n + j]);
+                    for (core::index i = j + 1; i < n; ++i) {
+                        const T v = std::abs(a[i * n + j]);
+                        if (v > best) {
+                            best = v;
+                            p = i;
+                        }
+                    }
+                    pivots_[j] = p;
+                    if (p != j) {
+                        swap_rows(a, n, j, p, n);
+                        sign_ = -sign_;
+                    }
+                    const T pivot = a[j * n + j];
+                    if (pivot == T{}) {
+                        singular_ = true;
+                        continue;
+                    }
+                    for (core::index i = j + 1; i < n; ++i) {
+                        T* ai = a + i * n;
+                        const T lij = ai[j] / pivot;
+                        ai[j] = lij;
+                        if (lij == T{}) continue;
+                        const T* aj = a + j * n;
+                        for (core::index c = j + 1; c < k1; ++c) ai[c] -= lij * aj[c];
+                    }
+                }
+                if (k1 == n) break;
+
+                // U12 = L11^-1 A12, then the level-3 trailing update A22 -= L21 U12
+                detail::unit_lower_rows(kb, n - k1, a + k0 * n + k0, n, a + k0 * n + k1, n);
+                detail::gemm_sub(n - k1, n - k1, kb, a + k1 * n + k0, n, 1, a + k0 * n + k1, n, 1,
+                                 a + k1 * n + k1, n, threads_);
+            }
+        }
+
+        // B = U^-1 L^-1 P B for a contiguous n x nrhs block with leading dimension ldb
+        void substitute(T* b, const core::index nrhs, const core::index ldb) const {
+            if (singular_) {
+                throw core::Error(core::ErrorCode::kSingularMatrix, "LU::solve(): matrix is singular");
+            }
+            const core::index n = size();
+            AXIOM_PROFILE_KERNEL("linalg::LU::solve", 2 * n * n * nrhs, sizeof(T) * (n * n + 2 * n * nrhs));
+            const T* a = lu_.data();
+            for (core::index i = 0; i < n; ++i) swap_rows(b, ldb, i, pivots_[i], nrhs);
+
+            // forward, L y = P b: rows of a block first take the gemm update from all solved rows
+            for (core::index i0 = 0; i0 < n; i0 += block_) {
+                const core::index ib = std::min(block_, n - i0);
+                detail::gemm_sub(ib, nrhs, i0, a + i0 * n, n, 1, b, ldb, 1, b + i0 * ldb, ldb, threads_);
+                detail::unit_lower_rows(ib, nrhs, a + i0 * n + i0, n, b + i0 * ldb, ldb);
+            }
+
+            // backward, U x = y, blocks from the bottom up
+            for (core::index i1 = n; i1 > 0;) {
+                const core::index ib = std::min(block_, i1);
+                const core::index i0 = i1 - ib;
+                detail::gemm_sub(ib, nrhs, n - i1, a + i0 * n + i1, n, 1, b + i1 * ldb, ldb, 1, b + i0 * ldb, ldb,
+                                 threads_);
+                for (core::index i = i1; i-- > i0;) {
+                    T* bi = b + i * ldb;
+                    for (core::index p = i + 1; p < i1; ++p) {
+                        const T uip = a[i * n + p];
+                        const T* bp = b + p * ldb;
+                        for (core::index j = 0; j < nrhs; ++j) bi[j] -= uip * bp[j];
+                    }
+                    const T inv = T{1} / a[i * n + i];
+                    for (core::index j = 0; j < nrhs; ++j) bi[j] *= inv;
+                }
+                i1 = i0;
+            }
+        }
+    };
+
+    // A = L L^T for symmetric positive definite A, only the lower triangle of A is read
+    template <typename T>
+        requires std::floating_point<T>
+    class Cholesky {
+    public:
+        static constexpr core::index kDefaultBlock = 64;
+
+        // factors A in place, pass an rvalue to reuse its storage
+        template <exec::ExecutionPolicy P>
+        explicit Cholesky(const P& policy, Mat<T> A, const core::index block = kDefaultBlock)
+            : l_(std::move(A)), threads_(exec::concurrency(policy, l_.rows() * l_.rows() * l_.cols())) {
+            if (l_.rows() != l_.cols()) {
+                throw core::Error(core::ErrorCode::kShapeMismatch, "Cholesky(): matrix must be square");
+            }
+            if (block == 0) {
+                throw core::Error(core::ErrorCode::kInvalidArgument, "Cholesky(): block size must be positive");
+            }
+            block_ = block;
+            factor();
+        }
+
+        explicit Cholesky(Mat<T> A, const core::index block = kDefaultBlock, const core::index threads = 1)
+            : Cholesky(exec::on_threads(threads), std::move(A), block) {}
+
+        [[nodiscard]] core::index size() const noexcept { return l_.rows(); }
+
+        // L, the strict upper triangle is zero
+        [[nodiscard]] const Mat<T>& lower() const noexcept { return l_; }
+
+        [[nodiscard]] T determinant() const noexcept {
+            T det{1};
+            for (core::index i = 0; i < size(); ++i) det *= core::sq(l_(i, i));
+            return det;
+        }
+
+        // log det(A), does not overflow where determinant() would
+        [[nodiscard]] T log_determinant() const noexcept {
+            T sum{};
+            for (core::index i = 0; i < size(); ++i) sum += std::log(l_(i, i));
+            return T{2} * sum;
+        }
+
+        // solves A x = b / A X = B, right-hand sides may be any vector / matrix or view
+        template <VecLike V>
+            requires std::same_as<scalar_t<V>, T>
+        [[nodiscard]] Vec<T> solve(const V& b) const {
+            Vec<T> x(detail::cview(b));
+            solve_in_place(x);
+            return x;
+        }
+
+        template <MatLike M>
+            requires std::same_as<scalar_t<M>, T>
+        [[nodiscard]] Mat<T> solve(const M& B) const {
+            Mat<T> X(detail::cview(B));
+            solve_in_place(X);
+            return X;
+        }
+
+        void solve_in_place(Vec<T>& b) const {
+            if (b.size() != size()) {
+                throw core::Error(core::ErrorCode::kShapeMismatch, "Cholesky::solve(): b must have A.rows() elements");
+            }
+            substitute(b.data(), 1, 1);
+        }
+
+        void solve_in_place(Mat<T>& B) const {
+            if (B.rows() != size()) {
+                throw core::Error(core::ErrorCode::kShapeMismatch, "Cholesky::solve(): B must have A.rows() rows");
+            }
+            substitute(B.data(), B.cols(), B.cols());
+        }
+
+        [[nodiscard]] Mat<T> inverse() const {
+            Mat<T> X = Mat<T>::identity(size());
+            solve_in_place(X);
+            return X;
+        }
+
+    private:
+        Mat<T> l_;
+        core::index block_ = kDefaultBlock;
+        core::index threads_ = 1;
+
+        void factor() {
+            const core::index n = size();
+            AXIOM_PROFILE_KERNEL("linalg::Cholesky::factor", n * n * n / 3, 2 * sizeof(T) * n * n);
+            T* a = l_.data();
+            for (core::index k0 = 0; k0 < n; k0 += block_) {
+                const core::index kb = std::min(block_, n - k0);
+                const core::index k1 = k0 + kb;
+
+                // unblocked diagonal block, stops at the first pivot that is not positive
+                for (core::index j = k0; j < k1; ++j) {
+                    T* aj = a + j * n;
+                    T d = aj[j];
+                    for (core::index p = k0; p < j; ++p) d -= core::sq(aj[p]);
+                    if (!(d > T{}) || !std::isfinite(d)) {
+                        throw core::Error(core::ErrorCode::kNotPositiveDefinite,
+                            "Cholesky(): matrix is not positive definite (pivot " + std::to_string(j) + ")");
+                    }
+                    const T ljj = std::sqrt(d);
+                    aj[j] = ljj;
+                    for (core::index i = j + 1; i < k1; ++i) {
+                        T* ai = a + i * n;
+                        T s = ai[j];
+                        for (core::index p = k0; p < j; ++p) s -= ai[p] * aj[p];
+                        ai[j] = s / ljj;
+                    }
+                }
+                if (k1 == n) break;
+
+                // L21 = A21 L11^-T, every row is an independent forward substitution
+                const core::index rows = n - k1;
+                const core::index tasks = (rows + block_ - 1) / block_;
+                exec::parallel_for(exec::on_threads(threads_), tasks, [&](const core::index lo, const core::index hi) {
+                    const core::index r1 = std::min(n, k1 + hi * block_);
+                    for (core::index i = k1 + lo * block_; i < r1; ++i) {
+                        T* ai = a + i * n;
+                        for (core::index j = k0; j < k1; ++j) {
+                            const T* aj = a + j * n;
+                            T s = ai[j];
+                            for (core::index p = k0; p < j; ++p) s -= ai[p] * aj[p];
+                            ai[j] = s / aj[j];
+                        }
+                    }
+                });
+
+                // A22 -= L21 L21^T on the lower triangle only, one gemm per block row (the row
+                // blocks are independent and split across threads)
+                exec::parallel_for(exec::on_threads(threads_), tasks, [&](const core::index lo, const core::index hi) {
+                    for (core::index t = lo; t < hi; ++t) {
+                        const core::index r0 = k1 + t * block_;
+                        const core::index rb = std::min(block_, n - r0);
+                        const core::index cols = r0 + rb - k1;
+                        detail::gemm_sub(rb, cols, kb, a + r0 * n + k0, n, 1, a + k1 * n + k0, 1, n,
+                                         a + r0 * n + k1, n, 1);
+                    }
+                });
+            }
+            for (core::index i = 0; i < n; ++i) std::fill(a + i * n + i + 1, a + (i + 1) * n, T{});
+        }
+
+        // B = L^-T L^-1 B for a contiguous n x nrhs block with leading dimension ldb
+        void substitute(T* b, const core::index nrhs, const core::index ldb) const {
+            const core::index n = size();
+            AXIOM_PROFILE_KERNEL("linalg::Cholesky::solve", 2 * n * n * nrhs, sizeof(T) * (n * n + 2 * n * nrhs));
+            const T* a = l_.data();
+
+            // forward, L y = b
+            for (core::index i0 = 0; i0 < n; i0 += block_) {
+                const core::index i1 = std::min(n, i0 + block_);
+                detail::gemm_sub(i1 - i0, nrhs, i0, a + i0 * n, n, 1, b, ldb, 1, b + i0 * ldb, ldb, threads_);
+                for (core::index i = i0; i < i1; ++i) {
+                    T* bi = b + i * ldb;
+                    for (core::index p = i0; p < i; ++p) {
+                        const T lip = a[i * n + p];
+                        const T* bp = b + p * ldb;
+                        for (core::index j = 0; j < nrhs; ++j) bi[j] -= lip * bp[j];
+                    }
+                    const T inv = T{1} / a[i * n + i];
+                    for (core::index j = 0; j < nrhs; ++j) bi[j] *= inv;
+                }
+            }
+
+            // backward, L^T x = y, L^T is read as a column-major view of L
+            for (core::index i1 = n; i1 > 0;) {
+                const core::index i0 = i1 - std::min(block_, i1);
+                detail::gemm_sub(i1 - i0, nrhs, n - i1, a + i1 * n + i0, 1, n, b + i1 * ldb, ldb, 1,
+                                 b + i0 * ldb, ldb, threads_);
+                for (core::index i = i1; i-- > i0;) {
+                    T* bi = b + i * ldb;
+                    const T inv = T{1} / a[i * n + i];
+                    for (core::index j = 0; j < nrhs; ++j) bi[j] *= inv;
+                    for (core::index q = i0; q < i; ++q) {
+                        const T liq = a[i * n + q];
+                        T* bq = b + q * ldb;
+                        for (core::index j = 0; j < nrhs; ++j) bq[j] -= liq * bi[j];
+                    }
+                }
+                i1 = i0;
+            }
+        }
+    };
+
+    // A = Q R for m x n A with m >= n, Householder reflectors applied in blocks (compact WY)
+    template <typename T>
+        requires std::floating_point<T>
+    class QR {
+    public:
+        static constexpr core::index kDefaultBlock = 16;
+
+        // factors A in place, pass an rvalue to reuse its storage
+        template <exec::ExecutionPolicy P>
+        explicit QR(const P& policy, Mat<T> A, const core::index block = kDefaultBlock)
+            : qr_(std::move(A)), tau_(qr_.cols()),
+              threads_(exec::concurrency(policy, qr_.rows() * qr_.cols() * qr_.cols())) {
+            if (qr_.rows() < qr_.cols()) {
+                throw core::Error(core::ErrorCode::kShapeMismatch, "QR(): matrix must have rows >= cols");
+            }
+            if (block == 0) {
+                throw core::Error(core::ErrorCode::kInvalidArgument, "QR(): block size must be positive");
+            }
+            block_ = std::min(block, qr_.cols());
+            t_ = Mat<T>(qr_.cols(), block_);
+            factor();
+        }
+
+        explicit QR(Mat<T> A, const core::index block = kDefaultBlock, const core::index threads = 1)
+            : QR(exec::on_threads(threads), std::move(A), block) {}
+
+        [[nodiscard]] core::index rows() const noexcept { return qr_.rows(); }
+        [[nodiscard]] core::index cols() const noexcept { return qr_.cols(); }
+
+        // R above and on the diagonal, reflectors v (v_j = 1 implied) below it
+        [[nodiscard]] const Mat<T>& packed() const noexcept { return qr_; }
+        [[nodiscard]] const Vec<T>& tau() const noexcept { return tau_; }
+
+        // the n x n upper triangular factor
+        [[nodiscard]] Mat<T> r() const {
+            const core::index n = cols();
+            Mat<T> R(n, n);
+            for (core::index i = 0; i < n; ++i) {
+                for (core::index j = i; j < n; ++j) R(i, j) = qr_(i, j);
+            }
+            return R;
+        }
+
+        // the m x n thin factor with orthonormal columns
+        [[nodiscard]] Mat<T> q() const {
+            Mat<T> Q(rows(), cols());
+            for (core::index i = 0; i < cols(); ++i) Q(i, i) = T{1};
+            apply_q(Q);
+            return Q;
+        }
+
+        // B = Q^T B / B = Q B for B with rows() rows
+        void apply_qt(Mat<T>& B) const {
+            check_rows(B.rows());
+            apply_qt(B.data(), B.cols(), B.cols());
+        }
+
+        void apply_q(Mat<T>& B) const {
+            check_rows(B.rows());
+            for (core::index k0 = (cols() - 1) / block_ * block_ + block_; k0 > 0;) {
+                k0 -= block_;
+                apply_block(k0, std::min(block_, cols() - k0), B.data() + k0 * B.cols(), B.cols(), B.cols(), false);
+            }
+        }
+
+        // least-squares solution of min |A x - b|, throws kSingularMatrix if R has a zero pivot
+        template <VecLike V>
+            requires std::same_as<scalar_t<V>, T>
+        [[nodiscard]] Vec<T> solve(const V& b) const {
+            Vec<T> y(detail::cview(b));
+            check_rows(y.size());
+            apply_qt(y.data(), 1, 1);
+            back_substitute(y.data(), 1, 1);
+            Vec<T> x(cols());
+            std::copy_n(y.data(), cols(), x.data());
+            return x;
+        }
+
+        template <MatLike M>
+            requires std::same_as<scalar_t<M>, T>
+        [[nodiscard]] Mat<T> solve(const M& B) const {
+            Mat<T> Y(detail::cview(B));
+            check_rows(Y.rows());
+            const core::index k = Y.cols();
+            apply_qt(Y.data(), k, k);
+            back_substitute(Y.data(), k, k);
+            Mat<T> X(cols(), k);
+            std::copy_n(Y.data(), cols() * k, X.data());
+            return X;
+        }
+
+    private:
+        Mat<T> qr_;
+        Vec<T> tau_;
+        // triangular factor T of every block, rows [k0, k0 + kb) hold the block starting at k0
+        Mat<T> t_{1};
+        core::index block_ = kDefaultBlock;
+        core::index threads_ = 1;
+
+        void check_rows(const core::index m) const {
+            if (m != rows()) {
+                throw core::Error(core::ErrorCode::kShapeMismatch, "QR: right-hand side must have A.rows() rows");
+            }
+        }
+
+        void factor() {
+            const core::index n = cols();
+            AXIOM_PROFILE_KERNEL("linalg::QR::factor", 2 * rows() * n * n - 2 * n * n * n / 3,
+                                 2 * sizeof(T) * rows() * n);
+            for (core::index k0 = 0; k0 < n; k0 += block_) {
+                const core::index kb = std::min(block_, n - k0);
+                panel(k0, kb);
+                form_t(k0, kb);
+                if (k0 + kb < n) apply_block(k0, kb, qr_.data() + k0 * n + k0 + kb, n - k0 - kb, n, true);
+            }
+        }
+
+        // unblocked Householder QR of columns [k0, k0 + kb), rows [k0, m)
+        void panel(const core::index k0, const core::index kb) {
+            const core::index m = rows(), n = cols(), k1 = k0 + kb;
+            T* a = qr_.data();
+            Vec<T> w(kb);
+            for (core::index j = k0; j < k1; ++j) {
+                const T alpha = a[j * n + j];
+                T sigma{};
+                for (core::index i = j + 1; i < m; ++i) sigma += core::sq(a[i * n + j]);
+                if (sigma == T{}) {
+                    tau_[j] = T{};
+                    continue;
+                }
+                const T norm = std::sqrt(alpha * alpha + sigma);
+                const T beta = alpha > T{} ? -norm : norm;
+                const T tau = (beta - alpha) / beta;
+                const T scale = T{1} / (alpha - beta);
+                for (core::index i = j + 1; i < m; ++i) a[i * n + j] *= scale;
+                a[j * n + j] = beta;
+                tau_[j] = tau;
+
+                // rest of the panel, w = A^T v then A -= tau v w^T, both row by row
+                const core::index nc = k1 - j - 1;
+                if (nc == 0) continue;
+                std::copy_n(a + j * n + j + 1, nc, w.data());
+                for (core::index i = j + 1; i < m; ++i) {
+                    const T vi = a[i * n + j];
+                    const T* ai = a + i * n + j + 1;
+                    for (core::index c = 0; c < nc; ++c) w[c] += vi * ai[c];
+                }
+                for (core::index c = 0; c < nc; ++c) a[j * n + j + 1 + c] -= tau * w[c];
+                for (core::index i = j + 1; i < m; ++i) {
+                    const T tvi = tau * a[i * n + j];
+                    T* ai = a + i * n + j + 1;
+                    for (core::index c = 0; c < nc; ++c) ai[c] -= tvi * w[c];
+                }
+            }
+        }
+
+        // upper triangular T with H_k0 ... H_k1-1 = I - V T V^T (LAPACK larft, forward columnwise)
+        void form_t(const core::index k0, const core::index kb) {
+            const core::index m = rows(), n = cols(), k1 = k0 + kb;
+            const T* a = qr_.data();
+            // G = V^T V, the unit lower kb x kb top of V by hand and the rest with one gemm
+            Mat<T> G(kb, kb);
+            for (core::index p = 0; p < kb; ++p) {
+                for (core::index q = p; q < kb; ++q) {
+                    T s = p == q ? T{1} : a[(k0 + q) * n + k0 + p];
+                    for (core::index i = q + 1; i < kb; ++i) s += a[(k0 + i) * n + k0 + p] * a[(k0 + i) * n + k0 + q];
+                    G(p, q) = s;
+                }
+            }
+            detail::gemm_acc(kb, kb, m - k1, T{1}, a + k1 * n + k0, 1, n, a + k1 * n + k0, n, 1,
+                             G.data(), kb, threads_);
+
+            T* t = t_.data() + k0 * block_;
+            for (core::index j = 0; j < kb; ++j) {
+                const T tau = tau_[k0 + j];
+                for (core::index i = 0; i < j; ++i) {
+                    T s{};
+                    for (core::index p = i; p < j; ++p) s += t[i * block_ + p] * G(p, j);
+                    t[i * block_ + j] = -tau * s;
+                }
+                t[j * block_ + j] = tau;
+            }
+        }
+
+        // C = H^T C (trans) or H C for the block reflector H = I - V T V^T starting at column k0,
+        // c points at row k0 of C (nc columns, leading dimension ldc)
+        void apply_block(const core::index k0, const core::index kb, T* c, const core::index nc,
+                         const core::index ldc, const bool trans) const {
+            const core::index m = rows(), n = cols(), k1 = k0 + kb;
+            const T* a = qr_.data();
+            const T* t = t_.data() + k0 * block_;
+
+            // W = V^T C
+            Mat<T> W(kb, nc);
+            T* w = W.data();
+            std::copy_n(c, nc, w);
+            for (core::index i = 1; i < kb; ++i) {
+                const T* ci = c + i * ldc;
+                std::copy_n(ci, nc, w + i * nc);
+                for (core::index p = 0; p < i; ++p) {
+                    const T vip = a[(k0 + i) * n + k0 + p];
+                    for (core::index j = 0; j < nc; ++j) w[p * nc + j] += vip * ci[j];
+                }
+            }
+            detail::gemm_acc(kb, nc, m - k1, T{1}, a + k1 * n + k0, 1, n, c + kb * ldc, ldc, 1, w, nc, threads_);
+
+            // W = T^T W or T W, in place
+            if (trans) {
+                for (core::index p = kb; p-- > 0;) {
+                    T* wp = w + p * nc;
+                    for (core::index j = 0; j < nc; ++j) wp[j] *= t[p * block_ + p];
+                    for (core::index q = 0; q < p; ++q) {
+                        const T tqp = t[q * block_ + p];
+                        for (core::index j = 0; j < nc; ++j) wp[j] += tqp * w[q * nc + j];
+                    }
+                }
+            } else {
+                for (core::index p = 0; p < kb; ++p) {
+                    T* wp = w + p * nc;
+                    for (core::index j = 0; j < nc; ++j) wp[j] *= t[p * block_ + p];
+                    for (core::index q = p + 1; q < kb; ++q) {
+                        const T tpq = t[p * block_ + q];
+                        for (core::index j = 0; j < nc; ++j) wp[j] += tpq * w[q * nc + j];
+                    }
+                }
+            }
+
+            // C -= V W
+            for (core::index i = 0; i < kb; ++i) {
+                T* ci = c + i * ldc;
+                for (core::index j = 0; j < nc; ++j) ci[j] -= w[i * nc + j];
+                for (core::index p = 0; p < i; ++p) {
+                    const T vip = a[(k0 + i) * n + k0 + p];
+                    for (core::index j = 0; j < nc; ++j) ci[j] -= vip * w[p * nc + j];
+                }
+            }
+            detail::gemm_sub(m - k1, nc, kb, a + k1 * n + k0, n, 1, w, nc, 1, c + kb * ldc, ldc, threads_);
+        }
+
+        void apply_qt(T* b, const core::index nrhs, const core::index ldb) const {
+            for (core::index k0 = 0; k0 < cols(); k0 += block_) {
+                apply_block(k0, std::min(block_, cols() - k0), b + k0 * ldb, nrhs, ldb, true);
+            }
+        }
+
+        // rows [0, n) of B = R^-1 rows [0, n) of B
+        void back_substitute(T* b, const core::index nrhs, const core::index ldb) const {
+            const core::index n = cols();
+            const T* a = qr_.data();
+            for (core::index i = n; i-- > 0;) {
+                const T rii = a[i * n + i];
+                if (rii == T{}) {
+                    throw core::Error(core::ErrorCode::kSingularMatrix, "QR::solve(): matrix is rank deficient");
+                }
+                T* bi = b + i * ldb;
+                for (core::index p = i + 1; p < n; ++p) {
+                    const T rip = a[i * n + p];
+                    const T* bp = b + p * ldb;
+                    for (core::index j = 0; j < nrhs; ++j) bi[j] -= rip * bp[j];
+                }
+                for (core::index j = 0; j < nrhs; ++j) bi[j] /= rii;
+            }
+        }
+    };
+
+    template <exec::ExecutionPolicy P, MatLike M>
+    [[nodiscard]] LU<scalar_t<M>> lu(const P& policy, const M& A,
+                                     const core::index block = LU<scalar_t<M>>::kDefaultBlock) {
+        return LU<scalar_t<M>>(policy, Mat<scalar_t<M>>(detail::cview(A)), block);
+    }
+
+    template <MatLike M>
+    [[nodiscard]] LU<scalar_t<M>> lu(const M& A, const core::index block = LU<scalar_t<M>>::kDefaultBlock,
+                                     const core::index threads = 1) {
+        return lu(exec::on_threads(threads), A, block);
+    }
+
+    template <exec::ExecutionPolicy P, MatLike M>
+    [[nodiscard]] QR<scalar_t<M>> qr(const P& policy, const M& A,
+                                     const core::index block = QR<scalar_t<M>>::kDefaultBlock) {
+        return QR<scalar_t<M>>(policy, Mat<scalar_t<M>>(detail::cview(A)), block);
+    }
+
+    template <MatLike M>
+    [[nodiscard]] QR<scalar_t<M>> qr(const M& A, const core::index block = QR<scalar_t<M>>::kDefaultBlock,
+                                     const core::index threads = 1) {
+        return qr(exec::on_threads(threads), A, block);
+    }
+
+    namespace detail {
+        // TSQR: A is cut into `chunks` row blocks that are factored independently, their R factors
+        // are stacked and factored once more, Q^T b follows the same tree
+        template <typename M, typename B>
+        auto tsqr_lstsq(const M& A, const B& b, const core::index chunks, const core::index threads) {
+            using T = scalar_t<M>;
+            constexpr bool is_vec = VecLike<B>;
+            const auto a = cview(A);
+            const auto rhs = cview(b);
+            const core::index m = a.rows(), n = a.cols();
+            core::index k = 1, rhs_rows = 0;
+            if constexpr (is_vec) {
+                rhs_rows = rhs.size();
+            } else {
+                k = rhs.cols();
+                rhs_rows = rhs.rows();
+            }
+            if (rhs_rows != m) {
+                throw core::Error(core::ErrorCode::kShapeMismatch, "lstsq(): b must have A.rows() rows");
+            }
+
+            Mat<T> R(chunks * n, n);
+            Mat<T> Y(chunks * n, k);
+            exec::parallel_for(exec::on_threads(threads), chunks, [&](const core::index lo, const core::index hi) {
+                for (core::index c = lo; c < hi; ++c) {
+                    const core::index r0 = m * c / chunks, r1 = m * (c + 1) / chunks;
+                    const QR<T> local(Mat<T>(a.row_range(r0, r1 - r0)));
+                    Mat<T> bc(r1 - r0, k);
+                    for (core::index i = r0; i < r1; ++i) {
+                        for (core::index j = 0; j < k; ++j) {
+                            if constexpr (is_vec) bc(i - r0, j) = rhs[i];
+                            else bc(i - r0, j) = rhs(i, j);
+                        }
+                    }
+                    local.apply_qt(bc);
+                    for (core::index i = 0; i < n; ++i) {
+                        for (core::index j = i; j < n; ++j) R(c * n + i, j) = local.packed()(i, j);
+                        for (core::index j = 0; j < k; ++j) Y(c * n + i, j) = bc(i, j);
+                    }
+                }
+            });
+            const Mat<T> X = QR<T>(std::move(R)).solve(Y);
+            if constexpr (is_vec) return Vec<T>(X.col(0));
+            else return X;
+        }
+    }
+
+    // least-squares solution of min |A x - b| for m x n A with m >= n, b a vector or an m x k
+    // matrix; a parallel policy on a very tall A (m >= 8 n per thread) reduces row blocks with
+    // TSQR, otherwise the blocked QR splits its gemm updates
+    template <exec::ExecutionPolicy P, MatLike M, typename B>
+        requires (VecLike<B> || MatLike<B>) && SameScalar<M, B>
+    [[nodiscard]] auto lstsq(const P& policy, const M& A, const B& b) {
+        const core::index m = A.rows(), n = A.cols();
+        const core::index threads = exec::concurrency(policy, m * n * n);
+        if (threads > 1 && m >= 8 * n * threads) return detail::tsqr_lstsq(A, b, threads, threads);
+        return qr(policy, A).solve(b);
+    }
+
+    template <MatLike M, typename B>
+        requires (VecLike<B> || MatLike<B>) && SameScalar<M, B>
+    [[nodiscard]] auto lstsq(const M& A, const B& b, const core::index threads = 1) {
+        return lstsq(exec::on_threads(threads), A, b);
+    }
+
+    // one-shot helpers, factor once with lu() when solving against the same A repeatedly
+    template <MatLike M, typename B>
+        requires (VecLike<B> || MatLike<B>) && SameScalar<M, B>
+    [[nodiscard]] auto solve(const M& A, const B& b) {
+        return lu(A).solve(b);
+    }
+
+    template <exec::ExecutionPolicy P, MatLike M>
+    [[nodiscard]] Cholesky<scalar_t<M>> cholesky(const P& policy, const M& A,
+                                                 const core::index block = Cholesky<scalar_t<M>>::kDefaultBlock) {
+        return Cholesky<scalar_t<M>>(policy, Mat<scalar_t<M>>(detail::cview(A)), block);
+    }
+
+    template <MatLike M>
+    [[nodiscard]] Cholesky<scalar_t<M>> cholesky(const M& A,
+                                                 const core::index block = Cholesky<scalar_t<M>>::kDefaultBlock,
+                                                 const core::index threads = 1) {
+        return cholesky(exec::on_threads(threads), A, block);
+    }
+
+    template <MatLike M>
+    [[nodiscard]] scalar_t<M> det(const M& A) {
+        return lu(A).determinant();
+    }
+
+    template <MatLike M>
+    [[nodiscard]] Mat<scalar_t<M>> inverse(const M& A) {
+        return lu(A).inverse();
+    }
+}
+
 #endif //AXIOM_DECOMPOSITION_HPP
\ No newline at end of file
@@ -0,0 +1,194 @@
+#ifndef AXIOM_DISTANCE_HPP
+#define AXIOM_DISTANCE_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <limits>
+#include <utility>
+
+#include "axiom/core/core.hpp"
+#include "axiom/core/memory.hpp"
+#include "axiom/exec/exec.hpp"
+#include "axiom/linalg/mat.hpp"
+#include "axiom/linalg/ops.hpp"
+#include "axiom/linalg/vec.hpp"
+#include "axiom/linalg/view.hpp"
+
+namespace axiom::linalg {
+/*
+ * distances between the rows of two point sets X (N x d) and Y (M x d):
+ * - pairwise_sq_distances(X, Y) gives the N x M matrix D(i, j) = |x_i - y_j|^2 through
+ *   |x_i|^2 + |y_j|^2 - 2 x_i . y_j, the cross terms are one blocked gemm(-2, X, Y^T) per tile
+ *   and the row norms are computed once, instead of N * M calls to distanceSquared()
+ * - knn(X, Y, k) gives the k nearest rows of Y for every row of X, indices and squared
+ *   distances in ascending order: queries go in blocks of kQueryBlock, the references in tiles of
+ *   kReferenceBlock, each tile's distances land in a small buffer and are merged into one
+ *   bounded max-heap per query, so only kQueryBlock x kReferenceBlock distances exist at a time
+ *   and a candidate not better than the current k-th is dropped with one compare
+ * - an exec policy first argument splits the queries over the pool, every thread works in its
+ *   own arena (tile buffer and heaps, no heap allocation) and writes only its own rows, the
+ *   result does not depend on the policy; ties are broken by the smaller index
+ * - the expansion cancels when the points are far from the origin compared to their
+ *   separation, small negative results are clamped to 0 and D(i, i) of X against itself is only
+ *   0 up to round-off; center the data first if that matters
+ * - a NaN coordinate gives a NaN distance like distanceSquared(), knn() ranks NaN distances
+ *   after every number (as +inf) and reports them as NaN
+ */
+
+    inline constexpr core::index kQueryBlock = 64;
+    inline constexpr core::index kReferenceBlock = 256;
+
+    // knn() result, row i holds the neighbours of query i, nearest first
+    template <typename T>
+    struct KnnResult {
+        Mat<core::index> indices;
+        Mat<T> distances;       // squared
+    };
+
+    namespace detail {
+        template <typename T>
+        Vec<T> row_sq_norms(const MatView<const T>& a) {
+            Vec<T> n(a.rows());
+            for (core::index i = 0; i < a.rows(); ++i) n[i] = dot(a.row(i), a.row(i));
+            return n;
+        }
+
+        // knn() heap order: by distance, NaN ranked as +inf, ties by the smaller index
+        template <typename T>
+        bool knn_less(const std::pair<T, core::index>& a, const std::pair<T, core::index>& b) noexcept {
+            const T inf = std::numeric_limits<T>::infinity();
+            const T da = std::isnan(a.first) ? inf : a.first, db = std::isnan(b.first) ? inf : b.first;
+            return da < db || (da == db && a.second < b.second);
+        }
+
+        template <typename T>
+        void check_points(const MatView<const T>& x, const MatView<const T>& y, const char* msg) {
+            if (x.cols() != y.cols()) throw core::Error(core::ErrorCode::kShapeMismatch, msg);
+        }
+
+        // d(i, j) = xn_i + yn_j - 2 x_i . y_j for query rows [q0, q0 + d.rows()) and reference rows
+        // [r0, r0 + d.cols()), d is overwritten
+        template <typename T>
+        void sq_distance_tile(const MatView<const T>& x, const MatView<const T>& y, const Vec<T>& xn,
+                              const Vec<T>& yn, const core::index q0, const core::index r0, const MatView<T>& d) {
+            const core::index qn = d.rows(), rn = d.cols();
+            gemm(T{-2}, x.row_range(q0, qn), y.row_range(r0, rn).transposed(), T{}, d);
+            for (core::index i = 0; i < qn; ++i) {
+                const T xi = xn[q0 + i];
+                for (core::index j = 0; j < rn; ++j) {
+                    const T v = d(i, j) + xi + yn[r0 + j];
+                    d(i, j) = v < T{} ? T{} : v;       // NaN passes through
+                }
+            }
+        }
+    }
+
+    // D = squared distances between the rows of X and Y into a caller-owned N x M matrix
+    template <exec::ExecutionPolicy P, MatLike MX, MatLike MY, WritableMat MD>
+        requires std::floating_point<scalar_t<MX>> && SameScalar<MX, MY> && SameScalar<MX, MD>
+    void pairwise_sq_distances(const P& policy, const MX& X, const MY& Y, MD&& D) {
+        using T = scalar_t<MX>;
+        const MatView<const T> x = detail::cview(X), y = detail::cview(Y);
+        const MatView<T> d = detail::mview(D);
+        detail::check_points(x, y, "pairwise_sq_distances(): X and Y must have the same number of columns");
+        if (d.rows() != x.rows() || d.cols() != y.rows()) {
+            throw core::Error(core::ErrorCode::kShapeMismatch, "pairwise_sq_distances(): D must be N x M");
+        }
+        if (detail::overlaps(d, x) || detail::overlaps(d, y)) {
+            throw core::Error(core::ErrorCode::kInvalidArgument, "pairwise_sq_distances(): D must not alias X or Y");
+        }
+        const Vec<T> xn = detail::row_sq_norms(x), yn = detail::row_sq_norms(y);
+        const core::index n = x.rows(), m = y.rows();
+        const core::index blocks = (n + kQueryBlock - 1) / kQueryBlock;
+        exec::parallel_for(exec::in_units(policy, kQueryBlock * m), blocks, [&](const core::index lo, const core::index hi) {
+            for (core::index b = lo; b < hi; ++b) {
+                const core::index q0 = b * kQueryBlock, qn = std::min(kQueryBlock, n - q0);
+                detail::sq_distance_tile(x, y, xn, yn, q0, 0, d.block(q0, 0, qn, m));
+            }
+        });
+    }
+
+    template <MatLike MX, MatLike MY, WritableMat MD>
+        requires std::floating_point<scalar_t<MX>> && SameScalar<MX, MY> && SameScalar<MX, MD>
+    void pairwise_sq_distances(const MX& X, const MY& Y, MD&& D) {
+        pairwise_sq_distances(exec::seq, X, Y, std::forward<MD>(D));
+    }
+
+    template <exec::ExecutionPolicy P, MatLike MX, MatLike MY>
+        requires std::floating_point<scalar_t<MX>> && SameScalar<MX, MY>
+    [[nodiscard]] Mat<scalar_t<MX>> pairwise_sq_distances(const P& policy, const MX& X, const MY& Y) {
+        Mat<scalar_t<MX>> D(X.rows(), Y.rows());
+        pairwise_sq_distances(policy, X, Y, D);
+        return D;
+    }
+
+    template <MatLike MX, MatLike MY>
+        requires std::floating_point<scalar_t<MX>> && SameScalar<MX, MY>
+    [[nodiscard]] Mat<scalar_t<MX>> pairwise_sq_distances(const MX& X, const MY& Y) {
+        return pairwise_sq_distances(exec::seq, X, Y);
+    }
+
+    // the k nearest rows of Y for every row of X, 1 <= k <= M
+    template <exec::ExecutionPolicy P, MatLike MX, MatLike MY>
+        requires std::floating_point<scalar_t<MX>> && SameScalar<MX, MY>
+    [[nodiscard]] KnnResult<scalar_t<MX>> knn(const P& policy, const MX& X, const MY& Y, const core::index k) {
+        using T = scalar_t<MX>;
+        using Entry = std::pair<T, core::index>;      // (squared distance, index), max-heap by knn_less
+        const MatView<const T> x = detail::cview(X), y = detail::cview(Y);
+        detail::check_points(x, y, "knn(): X and Y must have the same number of columns");
+        const core::index n = x.rows(), m = y.rows();
+        if (k == 0 || k > m) throw core::Error(core::ErrorCode::kInvalidArgument, "knn(): k must be in [1, rows of Y]");
+
+        KnnResult<T> result{Mat<core::index>(n, k), Mat<T>(n, k)};
+        const Vec<T> xn = detail::row_sq_norms(x), yn = detail::row_sq_norms(y);
+        const core::index blocks = (n + kQueryBlock - 1) / kQueryBlock;
+        exec::parallel_for(exec::in_units(policy, kQueryBlock * m), blocks, [&](const core::index lo, const core::index hi) {
+            const core::ArenaScope scope;
+            core::aligned_vector<T> tile(kQueryBlock * kReferenceBlock);
+            core::aligned_vector<Entry> heaps(kQueryBlock * k);
+            core::aligned_vector<core::index> sizes(kQueryBlock);
+            for (core::index b = lo; b < hi; ++b) {
+                const core::index q0 = b * kQueryBlock, qn = std::min(kQueryBlock, n - q0);
+                std::fill_n(sizes.begin(), qn, core::index{0});
+                for (core::index r0 = 0; r0 < m; r0 += kReferenceBlock) {
+                    const core::index rn = std::min(kReferenceBlock, m - r0);
+                    const MatView<T> d(tile.data(), qn, rn, rn);
+                    detail::sq_distance_tile(x, y, xn, yn, q0, r0, d);
+                    for (core::index i = 0; i < qn; ++i) {
+                        Entry* heap = heaps.data() + i * k;
+                        core::index& size = sizes[i];
+                        for (core::index j = 0; j < rn; ++j) {
+                            const Entry e{d(i, j), r0 + j};
+                            if (size < k) {
+                                heap[size++] = e;
+                                std::push_heap(heap, heap + size, detail::knn_less<T>);
+                            } else if (detail::knn_less(e, heap[0])) {
+                                std::pop_heap(heap, heap + k, detail::knn_less<T>);
+                                heap[k - 1] = e;
+                                std::push_heap(heap, heap + k, detail::knn_less<T>);
+                            }
+                        }
+                    }
+                }
+                for (core::index i = 0; i < qn; ++i) {
+                    Entry* heap = heaps.data() + i * k;
+                    std::sort_heap(heap, heap + k, detail::knn_less<T>);
+                    for (core::index j = 0; j < k; ++j) {
+                        result.distances(q0 + i, j) = heap[j].first;
+                        result.indices(q0 + i, j) = heap[j].second;
+                    }
+                }
+            }
+        });
+        return result;
+    }
+
+    template <MatLike MX, MatLike MY>
+        requires std::floating_point<scalar_t<MX>> && SameScalar<MX, MY>
+    [[nodiscard]] KnnResult<scalar_t<MX>> knn(const MX& X, const MY& Y, const core::index k) {
+        return knn(exec::seq, X, Y, k);
+    }
+}
+
+#endif //AXIOM_DISTANCE_HPP
\ No newline at end of file
@@ -0,0 +1,273 @@
+#ifndef AXIOM_EXPR_HPP
+#define AXIOM_EXPR_HPP
+
+#include <concepts>
+#include <functional>
+#include <type_traits>
+
+#include "axiom/core/core.hpp"
+
+namespace axiom::linalg {
+/*
+ * lazy expression templates for Vec and Mat:
+ * - a + b, a - b, -a, s * a, a * s, a / s build lightweight nodes instead of temporaries
+ * - nodes are evaluated element by element into the destination in a single pass
+ *   (Vec/Mat construction, assignment and compound assignment from an expression)
+ * - containers are captured by reference, nodes and views by value, so an expression must not
+ *   outlive the containers it refers to (avoid `auto e = a + b;` on temporaries)
+ * - detail::for_each_leaf(e, f) visits the containers and views at the leaves of an expression,
+ *   which is how Mat and the views find operands that alias them in a different order
+ * - every node carries the static size of its operands (core::dynamic if only known at run
+ *   time), mixing two fixed-size operands of different sizes does not compile
+ */
+
+    // storage order of a heap-backed Mat, fixed-size matrices are always row-major
+    struct RowMajor {};
+    struct ColMajor {};
+
+    // N / R, C == core::dynamic is the heap-backed container, anything else is fixed-size
+    template <typename T, core::index N = core::dynamic> class Vec;
+    template <typename T, core::index R = core::dynamic, core::index C = R, typename L = RowMajor> class Mat;
+
+    template <typename E>
+    struct VecExpr {
+        [[nodiscard]] constexpr const E& derived() const noexcept { return static_cast<const E&>(*this); }
+    };
+
+    template <typename E>
+    struct MatExpr {
+        [[nodiscard]] constexpr const E& derived() const noexcept { return static_cast<const E&>(*this); }
+    };
+
+    namespace detail {
+        // owning containers are referenced, expression nodes are cheap to copy
+        template <typename E> struct expr_ref { using type = const E; };
+        template <typename T, core::index N> struct expr_ref<Vec<T, N>> { using type = const Vec<T, N>&; };
+        template <typename T, core::index R, core::index C, typename L> struct expr_ref<Mat<T, R, C, L>> {
+            using type = const Mat<T, R, C, L>&;
+        };
+
+        template <typename E>
+        using expr_ref_t = typename expr_ref<E>::type;
+
+        template <typename T>
+        struct scale {
+            T s;
+            constexpr T operator()(const T& x) const { return s * x; }
+        };
+
+        template <typename T>
+        struct divide {
+            T s;
+            constexpr T operator()(const T& x) const { return x / s; }
+        };
+
+        struct negate {
+            template <typename T>
+            constexpr T operator()(const T& x) const { return -x; }
+        };
+
+        template <typename T>
+        constexpr void check_divisor(const T& s, const char* msg) {
+            if (s == T{}) throw core::Error(core::ErrorCode::kDivideByZero, msg);
+        }
+
+        // static sizes agree unless both are fixed and differ
+        constexpr bool sizes_agree(const core::index a, const core::index b) noexcept {
+            return a == core::dynamic || b == core::dynamic || a == b;
+        }
+
+        constexpr core::index common_size(const core::index a, const core::index b) noexcept {
+            return a != core::dynamic ? a : b;
+        }
+
+        template <typename L, typename R>
+        concept same_vec_size = sizes_agree(L::static_size, R::static_size);
+
+        template <typename L, typename R>
+        concept same_mat_shape = sizes_agree(L::static_rows, R::static_rows) && sizes_agree(L::static_cols, R::static_cols);
+
+        // calls f on every operand of e that is not itself an expression node (containers, views)
+        template <typename E, typename F>
+        constexpr void for_each_leaf(const E& e, F&& f) {
+            if constexpr (requires { e.visit_operands(f); }) e.visit_operands(f);
+            else f(e);
+        }
+    }
+
+    // vector expression nodes
+    template <typename L, typename R, typename Op>
+    class VecBinary : public VecExpr<VecBinary<L, R, Op>> {
+        detail::expr_ref_t<L> lhs_;
+        detail::expr_ref_t<R> rhs_;
+
+    public:
+        using value_type = typename L::value_type;
+        static constexpr core::index static_size = detail::common_size(L::static_size, R::static_size);
+
+        constexpr VecBinary(const L& lhs, const R& rhs) : lhs_(lhs), rhs_(rhs) {
+            if (lhs.size() != rhs.size()) {
+                throw core::Error(core::ErrorCode::kShapeMismatch,
+                    "vec expression: vectors must be of same size");
+            }
+        }
+
+        [[nodiscard]] constexpr std::size_t size() const noexcept { return lhs_.size(); }
+        constexpr value_type operator[](const core::index i) const { return Op{}(lhs_[i], rhs_[i]); }
+
+        template <typename F>
+        constexpr void visit_operands(F& f) const {
+            detail::for_each_leaf(lhs_, f);
+            detail::for_each_leaf(rhs_, f);
+        }
+    };
+
+    template <typename E, typename Op>
+    class VecUnary : public VecExpr<VecUnary<E, Op>> {
+        detail::expr_ref_t<E> expr_;
+        Op op_;
+
+    public:
+        using value_type = typename E::value_type;
+        static constexpr core::index static_size = E::static_size;
+
+        constexpr VecUnary(const E& expr, Op op) : expr_(expr), op_(op) {}
+
+        [[nodiscard]] constexpr std::size_t size() const noexcept { return expr_.size(); }
+        constexpr value_type operator[](const core::index i) const { return op_(expr_[i]); }
+
+        template <typename F>
+        constexpr void visit_operands(F& f) const { detail::for_each_leaf(expr_, f); }
+    };
+
+    // matrix expression nodes, evaluated through operator()(row, col) so strided views can be leaves
+    template <typename L, typename R, typename Op>
+    class MatBinary : public MatExpr<MatBinary<L, R, Op>> {
+        detail::expr_ref_t<L> lhs_;
+        detail::expr_ref_t<R> rhs_;
+
+    public:
+        using value_type = typename L::value_type;
+        static constexpr core::index static_rows = detail::common_size(L::static_rows, R::static_rows);
+        static constexpr core::index static_cols = detail::common_size(L::static_cols, R::static_cols);
+
+        constexpr MatBinary(const L& lhs, const R& rhs) : lhs_(lhs), rhs_(rhs) {
+            if (lhs.rows() != rhs.rows() || lhs.cols() != rhs.cols()) {
+                throw core::Error(core::ErrorCode::kShapeMismatch,
+                    "mat expression: matrices must be of same shape");
+            }
+        }
+
+        [[nodiscard]] constexpr core::index rows() const { return lhs_.rows(); }
+        [[nodiscard]] constexpr core::index cols() const { return lhs_.cols(); }
+        [[nodiscard]] constexpr std::size_t size() const noexcept { return lhs_.size(); }
+        constexpr value_type operator()(const core::index row, const core::index col) const {
+            return Op{}(lhs_(row, col), rhs_(row, col));
+        }
+
+        template <typename F>
+        constexpr void visit_operands(F& f) const {
+            detail::for_each_leaf(lhs_, f);
+            detail::for_each_leaf(rhs_, f);
+        }
+    };
+
+    template <typename E, typename Op>
+    class MatUnary : public MatExpr<MatUnary<E, Op>> {
+        detail::expr_ref_t<E> expr_;
+        Op op_;
+
+    public:
+        using value_type = typename E::value_type;
+        static constexpr core::index static_rows = E::static_rows;
+        static constexpr core::index static_cols = E::static_cols;
+
+        constexpr MatUnary(const E& expr, Op op) : expr_(expr), op_(op) {}
+
+        [[nodiscard]] constexpr core::index rows() const { return expr_.rows(); }
+        [[nodiscard]] constexpr core::index cols() const { return expr_.cols(); }
+        [[nodiscard]] constexpr std::size_t size() const noexcept { return expr_.size(); }
+        constexpr value_type operator()(const core::index row, const core::index col) const {
+            return op_(expr_(row, col));
+        }
+
+        template <typename F>
+        constexpr void visit_operands(F& f) const { detail::for_each_leaf(expr_, f); }
+    };
+
+    // vector operators
+    template <typename L, typename R>
+        requires std::same_as<typename L::value_type, typename R::value_type> && detail::same_vec_size<L, R>
+    constexpr auto operator+(const VecExpr<L>& lhs, const VecExpr<R>& rhs) {
+        return VecBinary<L, R, std::plus<>>(lhs.derived(), rhs.derived());
+    }
+
+    template <typename L, typename R>
+        requires std::same_as<typename L::value_type, typename R::value_type> && detail::same_vec_size<L, R>
+    constexpr auto operator-(const VecExpr<L>& lhs, const VecExpr<R>& rhs) {
+        return VecBinary<L, R, std::minus<>>(lhs.derived(), rhs.derived());
+    }
+
+    template <typename E>
+    constexpr auto operator-(const VecExpr<E>& v) {
+        return VecUnary<E, detail::negate>(v.derived(), {});
+    }
+
+    template <typename E>
+    constexpr auto operator*(const VecExpr<E>& v, const typename E::value_type& val) {
+        using T = typename E::value_type;
+        return VecUnary<E, detail::scale<T>>(v.derived(), {val});
+    }
+
+    template <typename E>
+    constexpr auto operator*(const typename E::value_type& val, const VecExpr<E>& v) {
+        using T = typename E::value_type;
+        return VecUnary<E, detail::scale<T>>(v.derived(), {val});
+    }
+
+    template <typename E>
+    constexpr auto operator/(const VecExpr<E>& v, const typename E::value_type& val) {
+        using T = typename E::value_type;
+        detail::check_divisor(val, "vec operator /: cannot divide by 0");
+        return VecUnary<E, detail::divide<T>>(v.derived(), {val});
+    }
+
+    // matrix operators
+    template <typename L, typename R>
+        requires std::same_as<typename L::value_type, typename R::value_type> && detail::same_mat_shape<L, R>
+    constexpr auto operator+(const MatExpr<L>& lhs, const MatExpr<R>& rhs) {
+        return MatBinary<L, R, std::plus<>>(lhs.derived(), rhs.derived());
+    }
+
+    template <typename L, typename R>
+        requires std::same_as<typename L::value_type, typename R::value_type> && detail::same_mat_shape<L, R>
+    constexpr auto operator-(const MatExpr<L>& lhs, const MatExpr<R>& rhs) {
+        return MatBinary<L, R, std::minus<>>(lhs.derived(), rhs.derived());
+    }
+
+    template <typename E>
+    constexpr auto operator-(const MatExpr<E>& m) {
+        return MatUnary<E, detail::negate>(m.derived(), {});
+    }
+
+    template <typename E>
+    constexpr auto operator*(const MatExpr<E>& m, const typename E::value_type& val) {
+        using T = typename E::value_type;
+        return MatUnary<E, detail::scale<T>>(m.derived(), {val});
+    }
+
+    template <typename E>
+    constexpr auto operator*(const typename E::value_type& val, const MatExpr<E>& m) {
+        using T = typename E::value_type;
+        return MatUnary<E, detail::scale<T>>(m.derived(), {val});
+    }
+
+    template <typename E>
+    constexpr auto operator/(const MatExpr<E>& m, const typename E::value_type& val) {
+        using T = typename E::value_type;
+        detail::check_divisor(val, "mat operator /: cannot divide by 0");
+        return MatUnary<E, detail::divide<T>>(m.derived(), {val});
+    }
+}
+
+#endif //AXIOM_EXPR_HPP
\ No newline at end of file
@@ -0,0 +1,343 @@
+#ifndef AXIOM_FIXED_HPP
+#define AXIOM_FIXED_HPP
+
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <type_traits>
+#include <utility>
+
+#include "axiom/core/core.hpp"
+#include "axiom/linalg/expr.hpp"
+#include "axiom/linalg/view.hpp"
+
+namespace axiom::linalg {
+/*
+ * fixed-size Vec<T, N> / Mat<T, R, C> (row-major) for small vectors and matrices:
+ * - inline storage (no allocation), constexpr construction and elementwise ops
+ * - loops over up to kUnrollLimit elements are unrolled at compile time
+ * - combining two fixed operands of different sizes does not compile, a dynamic Vec / Mat or
+ *   view converts explicitly with a runtime size check, the other direction is implicit
+ * - view() / row() / col() / block() hand out the same VecView / MatView as the dynamic
+ *   containers, so every op in ops.hpp accepts fixed-size arguments too
+ */
+
+    using Vec2f = Vec<float, 2>;
+    using Vec3f = Vec<float, 3>;
+    using Vec4f = Vec<float, 4>;
+    using Vec2d = Vec<double, 2>;
+    using Vec3d = Vec<double, 3>;
+    using Vec4d = Vec<double, 4>;
+    using Mat2f = Mat<float, 2>;
+    using Mat3f = Mat<float, 3>;
+    using Mat4f = Mat<float, 4>;
+    using Mat2d = Mat<double, 2>;
+    using Mat3d = Mat<double, 3>;
+    using Mat4d = Mat<double, 4>;
+
+    namespace detail {
+        inline constexpr core::index kUnrollLimit = 16;
+
+        // f(i) for i in [0, N), as a fold over an index_sequence when N is small
+        template <core::index N, typename F>
+        constexpr void unroll(F&& f) {
+            if constexpr (N <= kUnrollLimit) {
+                [&]<core::index... I>(std::index_sequence<I...>) {
+                    (f(I), ...);
+                }(std::make_index_sequence<N>{});
+            } else {
+                for (core::index i = 0; i < N; ++i) f(i);
+            }
+        }
+
+        // sum of f(i) for i in [0, N), left to right
+        template <typename T, core::index N, typename F>
+        constexpr T unrolled_sum(F&& f) {
+            T acc{};
+            unroll<N>([&](const core::index i) { acc += f(i); });
+            return acc;
+        }
+
+        constexpr void check_static_size(const bool ok, const char* msg) {
+            if (!ok) throw core::Error(core::ErrorCode::kShapeMismatch, msg);
+        }
+    }
+
+    template <typename T, core::index N>
+    class Vec : public VecExpr<Vec<T, N>> {
+        static_assert(N >= 1, "Vec<T, N>: N must be >= 1");
+
+        std::array<T, N> data_{};
+
+        template <typename E>
+        constexpr void assign(const E& e) {
+            detail::check_static_size(e.size() == N, "Vec<T, N>: expression size must be N");
+            detail::unroll<N>([&](const core::index i) { data_[i] = e[i]; });
+        }
+
+    public:
+        using value_type = T;
+        using iterator = T*;
+        using const_iterator = const T*;
+        static constexpr core::index static_size = N;
+
+        // Constructors
+        constexpr Vec() noexcept = default;
+
+        // one value per element, e.g. Vec<double, 3> v{1.0, 2.0, 3.0};
+        template <typename... Args>
+            requires (sizeof...(Args) == N && (std::convertible_to<const Args&, T> && ...))
+        constexpr explicit(N == 1) Vec(const Args&... args) noexcept : data_{static_cast<T>(args)...} {}
+
+        // from an expression of the same static size (implicit) or a dynamic one (checked)
+        template <typename E>
+            requires (!std::same_as<E, Vec> && detail::sizes_agree(E::static_size, N))
+        constexpr explicit(E::static_size == core::dynamic) Vec(const VecExpr<E>& expr) {
+            assign(expr.derived());
+        }
+
+        static constexpr Vec zeros() noexcept { return Vec{}; }
+        static constexpr Vec ones() noexcept {
+            Vec v;
+            v.fill(T{1});
+            return v;
+        }
+
+        // Getters
+        [[nodiscard]] static constexpr std::size_t size() noexcept { return N; }
+        constexpr T* data() noexcept { return data_.data(); }
+        constexpr const T* data() const noexcept { return data_.data(); }
+
+        constexpr T& operator[](const core::index i) noexcept { return data_[i]; }
+        constexpr const T& operator[](const core::index i) const noexcept { return data_[i]; }
+        constexpr T& at(const core::index i) {
+            if (i >= N) throw core::Error(core::ErrorCode::kOutOfBounds, "Vec::at: index out of bounds");
+            return data_[i];
+        }
+        constexpr const T& at(const core::index i) const {
+            if (i >= N) throw core::Error(core::ErrorCode::kOutOfBounds, "Vec::at: index out of bounds");
+            return data_[i];
+        }
+
+        constexpr iterator begin() noexcept { return data(); }
+        constexpr iterator end() noexcept { return data() + N; }
+        constexpr const_iterator begin() const noexcept { return data(); }
+        constexpr const_iterator end() const noexcept { return data() + N; }
+
+        // Ops
+        constexpr void fill(const T& val) noexcept {
+            detail::unroll<N>([&](const core::index i) { data_[i] = val; });
+        }
+
+        constexpr T l1_norm() const {
+            return detail::unrolled_sum<T, N>([&](const core::index i) {
+                return data_[i] < T{} ? -data_[i] : data_[i];
+            });
+        }
+
+        [[nodiscard]] double l2_norm() const {
+            return std::sqrt(detail::unrolled_sum<double, N>([&](const core::index i) {
+                return core::sq(static_cast<double>(data_[i]));
+            }));
+        }
+
+        constexpr T infty_norm() const {
+            T res{};
+            detail::unroll<N>([&](const core::index i) {
+                const T a = data_[i] < T{} ? -data_[i] : data_[i];
+                if (a > res) res = a;
+            });
+            return res;
+        }
+
+        // Views
+        VecView<T> view() noexcept { return {data(), N}; }
+        VecView<const T> view() const noexcept { return {data(), N}; }
+        VecView<T> segment(const core::index start, const core::index len) { return view().segment(start, len); }
+        VecView<const T> segment(const core::index start, const core::index len) const {
+            return view().segment(start, len);
+        }
+
+        // Overload Operations
+        template <typename E>
+            requires (!std::same_as<E, Vec> && detail::sizes_agree(E::static_size, N))
+        constexpr Vec& operator=(const VecExpr<E>& expr) {
+            // evaluate first, the expression may refer to this vector
+            const Vec tmp(expr.derived());
+            return *this = tmp;
+        }
+
+        template <typename E>
+            requires (detail::sizes_agree(E::static_size, N))
+        constexpr Vec& operator+=(const VecExpr<E>& expr) {
+            const E& e = expr.derived();
+            detail::check_static_size(e.size() == N, "vec operator +: vectors must be of same size");
+            detail::unroll<N>([&](const core::index i) { data_[i] += e[i]; });
+            return *this;
+        }
+
+        template <typename E>
+            requires (detail::sizes_agree(E::static_size, N))
+        constexpr Vec& operator-=(const VecExpr<E>& expr) {
+            const E& e = expr.derived();
+            detail::check_static_size(e.size() == N, "vec operator -: vectors must be of same size");
+            detail::unroll<N>([&](const core::index i) { data_[i] -= e[i]; });
+            return *this;
+        }
+
+        constexpr Vec& operator*=(const T& val) noexcept {
+            detail::unroll<N>([&](const core::index i) { data_[i] *= val; });
+            return *this;
+        }
+
+        constexpr Vec& operator/=(const T& val) {
+            detail::check_divisor(val, "vec operator /: cannot divide by 0");
+            detail::unroll<N>([&](const core::index i) { data_[i] /= val; });
+            return *this;
+        }
+
+        friend constexpr bool operator==(const Vec& a, const Vec& b) noexcept { return a.data_ == b.data_; }
+    };
+
+    template <typename T, core::index R, core::index C, typename L>
+    class Mat : public MatExpr<Mat<T, R, C, L>> {
+        static_assert(R >= 1 && C >= 1 && R != core::dynamic && C != core::dynamic,
+                      "Mat<T, R, C>: both dimensions must be fixed and >= 1");
+        static_assert(std::same_as<L, RowMajor>, "Mat<T, R, C>: fixed-size matrices are row-major");
+
+        // row-major layout w/ indexing by data_[r * C + c]
+        std::array<T, R * C> data_{};
+
+        template <typename E>
+        constexpr void assign(const E& e) {
+            detail::check_static_size(e.rows() == R && e.cols() == C, "Mat<T, R, C>: expression shape must be R x C");
+            detail::unroll<R * C>([&](const core::index i) { data_[i] = e(i / C, i % C); });
+        }
+
+    public:
+        using value_type = T;
+        using layout = L;
+        using iterator = T*;
+        using const_iterator = const T*;
+        static constexpr core::index static_rows = R;
+        static constexpr core::index static_cols = C;
+
+        // Constructors
+        constexpr Mat() noexcept = default;
+
+        // R * C values in row-major order
+        template <typename... Args>
+            requires (sizeof...(Args) == R * C && (std::convertible_to<const Args&, T> && ...))
+        constexpr explicit(R * C == 1) Mat(const Args&... args) noexcept : data_{static_cast<T>(args)...} {}
+
+        template <typename E>
+            requires (!std::same_as<E, Mat> && detail::sizes_agree(E::static_rows, R) &&
+                      detail::sizes_agree(E::static_cols, C))
+        constexpr explicit(E::static_rows == core::dynamic || E::static_cols == core::dynamic)
+        Mat(const MatExpr<E>& expr) {
+            assign(expr.derived());
+        }
+
+        static constexpr Mat identity() noexcept requires (R == C) {
+            Mat m;
+            detail::unroll<R>([&](const core::index i) { m(i, i) = T{1}; });
+            return m;
+        }
+        static constexpr Mat zeros() noexcept { return Mat{}; }
+        static constexpr Mat ones() noexcept {
+            Mat m;
+            m.fill(T{1});
+            return m;
+        }
+
+        // Getters
+        [[nodiscard]] static constexpr core::index rows() noexcept { return R; }
+        [[nodiscard]] static constexpr core::index cols() noexcept { return C; }
+        [[nodiscard]] static constexpr std::size_t size() noexcept { return R * C; }
+        constexpr T* data() noexcept { return data_.data(); }
+        constexpr const T* data() const noexcept { return data_.data(); }
+
+        constexpr T& operator()(const core::index row, const core::index col) noexcept { return data_[row * C + col]; }
+        constexpr const T& operator()(const core::index row, const core::index col) const noexcept {
+            return data_[row * C + col];
+        }
+        constexpr T& at(const core::index row, const core::index col) {
+            if (row >= R || col >= C) throw core::Error(core::ErrorCode::kOutOfBounds, "Mat index out of bounds");
+            return (*this)(row, col);
+        }
+        constexpr const T& at(const core::index row, const core::index col) const {
+            if (row >= R || col >= C) throw core::Error(core::ErrorCode::kOutOfBounds, "Mat index out of bounds");
+            return (*this)(row, col);
+        }
+
+        constexpr iterator begin() noexcept { return data(); }
+        constexpr iterator end() noexcept { return data() + R * C; }
+        constexpr const_iterator begin() const noexcept { return data(); }
+        constexpr const_iterator end() const noexcept { return data() + R * C; }
+
+        constexpr void fill(const T& val) noexcept {
+            detail::unroll<R * C>([&](const core::index i) { data_[i] = val; });
+        }
+
+        // Views
+        MatView<T> view() noexcept { return {data(), R, C, C}; }
+        MatView<const T> view() const noexcept { return {data(), R, C, C}; }
+        MatView<T> transposed() noexcept { return view().transposed(); }
+        MatView<const T> transposed() const noexcept { return view().transposed(); }
+        VecView<T> row(const core::index i) { return view().row(i); }
+        VecView<const T> row(const core::index i) const { return view().row(i); }
+        VecView<T> col(const core::index j) { return view().col(j); }
+        VecView<const T> col(const core::index j) const { return view().col(j); }
+        MatView<T> block(const core::index row, const core::index col, const core::index rows, const core::index cols) {
+            return view().block(row, col, rows, cols);
+        }
+        MatView<const T> block(const core::index row, const core::index col, const core::index rows,
+                               const core::index cols) const {
+            return view().block(row, col, rows, cols);
+        }
+
+        // Overload operations
+        template <typename E>
+            requires (!std::same_as<E, Mat> && detail::sizes_agree(E::static_rows, R) &&
+                      detail::sizes_agree(E::static_cols, C))
+        constexpr Mat& operator=(const MatExpr<E>& expr) {
+            const Mat tmp(expr.derived());
+            return *this = tmp;
+        }
+
+        template <typename E>
+            requires (detail::sizes_agree(E::static_rows, R) && detail::sizes_agree(E::static_cols, C))
+        constexpr Mat& operator+=(const MatExpr<E>& expr) {
+            const E& e = expr.derived();
+            detail::check_static_size(e.rows() == R && e.cols() == C, "mat operator +: matrices must be of same shape");
+            if (!std::is_constant_evaluated() && detail::reorders<T>(view(), e)) return *this += Mat(e);
+            detail::unroll<R * C>([&](const core::index i) { data_[i] += e(i / C, i % C); });
+            return *this;
+        }
+
+        template <typename E>
+            requires (detail::sizes_agree(E::static_rows, R) && detail::sizes_agree(E::static_cols, C))
+        constexpr Mat& operator-=(const MatExpr<E>& expr) {
+            const E& e = expr.derived();
+            detail::check_static_size(e.rows() == R && e.cols() == C, "mat operator -: matrices must be of same shape");
+            if (!std::is_constant_evaluated() && detail::reorders<T>(view(), e)) return *this -= Mat(e);
+            detail::unroll<R * C>([&](const core::index i) { data_[i] -= e(i / C, i % C); });
+            return *this;
+        }
+
+        constexpr Mat& operator*=(const T& val) noexcept {
+            detail::unroll<R * C>([&](const core::index i) { data_[i] *= val; });
+            return *this;
+        }
+
+        constexpr Mat& operator/=(const T& val) {
+            detail::check_divisor(val, "mat operator /: cannot divide by 0");
+            detail::unroll<R * C>([&](const core::index i) { data_[i] /= val; });
+            return *this;
+        }
+
+        friend constexpr bool operator==(const Mat& a, const Mat& b) noexcept { return a.data_ == b.data_; }
+    };
+}
+
+#endif //AXIOM_FIXED_HPP
\ No newline at end of file
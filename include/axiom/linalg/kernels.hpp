@@ -0,0 +1,135 @@
+#ifndef AXIOM_KERNELS_HPP
+#define AXIOM_KERNELS_HPP
+
+#include <cmath>
+#include <type_traits>
+
+#include "axiom/core/core.hpp"
+
+namespace axiom::linalg::kernels {
+/*
+ * float / double kernels over raw buffers, implemented per ISA in src/axiom/linalg
+ * and selected at runtime from core::active_isa()
+ *
+ * reductions:
+ * - accumulate with 4 independent SIMD accumulators over fixed-size blocks and combine
+ *   the block partials in double with Neumaier compensation
+ * - sum_sq always accumulates in double (floats are widened), replacing long double
+ * - min/max ignore NaN the same way the std::min / std::max based loops did
+ *
+ * gemm:
+ * - operands are strided, element (i, j) of X lives at x[i * rs_x + j * cs_x], so row-major,
+ *   column-major and transposed operands all go through the same routine
+ * - B panels (kc x nc) and A blocks (mc x kc) are packed once per cache block and fed to a
+ *   register-tiled micro-kernel, threads > 1 splits the M (or N) dimension across threads
+ *
+ * gemv:
+ * - A is row-major (m x n, leading dimension lda), four rows are processed together so
+ *   loads of x (A x) or of y (A^T x) are shared, A^T is never formed
+ * - threads > 1 splits rows for A x and column slabs for A^T x, neither allocates
+ *
+ * batched 3-vectors:
+ * - structure-of-arrays operands (separate x / y / z lanes), one SIMD register holds the same
+ *   component of W consecutive vectors, so there are no shuffles or horizontal sums
+ * - an output may be the same lanes as an input (in place), partial overlap is not allowed
+ */
+
+    template <typename T>
+    inline constexpr bool has_simd = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+    double dot(const double* a, const double* b, core::index n);
+    float dot(const float* a, const float* b, core::index n);
+
+    double sum(const double* a, core::index n);
+    float sum(const float* a, core::index n);
+
+    // sum of |a_i| and max |a_i| (L1 / infinity norms)
+    double sum_abs(const double* a, core::index n);
+    float sum_abs(const float* a, core::index n);
+    double max_abs(const double* a, core::index n);
+    float max_abs(const float* a, core::index n);
+
+    // sum of a_i^2 in double precision (squared L2 norm)
+    double sum_sq(const double* a, core::index n);
+    double sum_sq(const float* a, core::index n);
+
+    // sum of (a_i - b_i)^2
+    double dist_sq(const double* a, const double* b, core::index n);
+    float dist_sq(const float* a, const float* b, core::index n);
+
+    // min / max starting from numeric_limits max() / lowest(), argmin / argmax return the
+    // first index of the extreme value and 0 if there is none
+    double min(const double* a, core::index n);
+    float min(const float* a, core::index n);
+    double max(const double* a, core::index n);
+    float max(const float* a, core::index n);
+    core::index argmin(const double* a, core::index n);
+    core::index argmin(const float* a, core::index n);
+    core::index argmax(const double* a, core::index n);
+    core::index argmax(const float* a, core::index n);
+
+    // C = alpha * A * B + beta * C with A m x k, B k x n and C m x n (beta == 0 ignores C)
+    void gemm(core::index m, core::index n, core::index k, double alpha,
+              const double* a, core::index rsa, core::index csa,
+              const double* b, core::index rsb, core::index csb,
+              double beta, double* c, core::index rsc, core::index csc, core::index threads = 1);
+    void gemm(core::index m, core::index n, core::index k, float alpha,
+              const float* a, core::index rsa, core::index csa,
+              const float* b, core::index rsb, core::index csb,
+              float beta, float* c, core::index rsc, core::index csc, core::index threads = 1);
+
+    // y[0, m) = alpha * A x + beta * y (beta == 0 ignores y)
+    void gemv(core::index m, core::index n, double alpha, const double* a, core::index lda,
+              const double* x, double beta, double* y, core::index threads = 1);
+    void gemv(core::index m, core::index n, float alpha, const float* a, core::index lda,
+              const float* x, float beta, float* y, core::index threads = 1);
+
+    // y[0, n) = alpha * A^T x + beta * y (beta == 0 ignores y)
+    void gemv_t(core::index m, core::index n, double alpha, const double* a, core::index lda,
+                const double* x, double beta, double* y, core::index threads = 1);
+    void gemv_t(core::index m, core::index n, float alpha, const float* a, core::index lda,
+                const float* x, float beta, float* y, core::index threads = 1);
+
+    // x / y / z lanes of n 3-vectors
+    template <typename T>
+    struct Lanes3 {
+        T* x;
+        T* y;
+        T* z;
+    };
+
+    // out[i] = a_i . b_i
+    void dot3(core::index n, Lanes3<const double> a, Lanes3<const double> b, double* out);
+    void dot3(core::index n, Lanes3<const float> a, Lanes3<const float> b, float* out);
+
+    // out_i = a_i x b_i
+    void cross3(core::index n, Lanes3<const double> a, Lanes3<const double> b, Lanes3<double> out);
+    void cross3(core::index n, Lanes3<const float> a, Lanes3<const float> b, Lanes3<float> out);
+
+    // out_i = a_i / |a_i|, a zero vector (squared length below numeric_limits<T>::min()) gives zero
+    void normalize3(core::index n, Lanes3<const double> a, Lanes3<double> out);
+    void normalize3(core::index n, Lanes3<const float> a, Lanes3<float> out);
+
+    // out_i = v_i - 2 (v_i . n_i) n_i
+    void reflect3(core::index n, Lanes3<const double> v, Lanes3<const double> normal, Lanes3<double> out);
+    void reflect3(core::index n, Lanes3<const float> v, Lanes3<const float> normal, Lanes3<float> out);
+
+    namespace detail {
+        // compensated double accumulation for types without a SIMD kernel
+        template <typename It, typename F>
+        double compensated_sum(It first, It last, F f) {
+            double sum = 0.0, c = 0.0;
+            for (; first != last; ++first) {
+                const double x = f(*first);
+                const double t = sum + x;
+                if (std::abs(sum) >= std::abs(x)) c += (sum - t) + x;
+                else c += (x - t) + sum;
+                sum = t;
+            }
+            return sum + c;
+        }
+    }
+
+}
+
+#endif //AXIOM_KERNELS_HPP
\ No newline at end of file
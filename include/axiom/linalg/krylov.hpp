@@ -0,0 +1,403 @@
+#ifndef AXIOM_KRYLOV_HPP
+#define AXIOM_KRYLOV_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "axiom/core/core.hpp"
+#include "axiom/core/profile.hpp"
+#include "axiom/linalg/mat.hpp"
+#include "axiom/linalg/ops.hpp"
+#include "axiom/linalg/sparse.hpp"
+#include "axiom/linalg/vec.hpp"
+#include "axiom/linalg/view.hpp"
+
+namespace axiom::linalg {
+/*
+ * matrix-free Krylov solvers:
+ * - a LinearOperator<T> is anything with rows() / cols() that applies y = A x into an existing
+ *   Vec<T>, either through a member apply(x, y) or through gemv (Mat, views, CsrMat, CscMat),
+ *   make_operator() wraps a callable
+ * - a Preconditioner<T> applies z = M^-1 r the same way: IdentityPreconditioner, Jacobi (inverse
+ *   diagonal) and Ilu0 (incomplete LU on the sparsity pattern of a CsrMat)
+ * - Cg (preconditioned conjugate gradients, A and M symmetric positive definite) and Gmres
+ *   (restarted, right preconditioned, Givens rotations on the Hessenberg matrix) allocate their
+ *   Krylov workspace in the constructor, solve() does not touch the heap
+ * - x is the initial guess on entry and the solution on exit, convergence is |b - A x|_2 <=
+ *   max(tolerance |b|_2, abs_tolerance) using the vectors' own l2_norm(), the reported residual is
+ *   relative to |b|_2 (Gmres tracks it through the rotations, the true residual is checked at
+ *   every restart), b = 0 returns x = 0
+ * - vector updates are fused: CG moves x and r in one pass, p = z + beta p and the Gram-Schmidt
+ *   steps evaluate as single-pass expressions
+ */
+
+    template <typename Op, typename T>
+    concept LinearOperator = requires(const Op& op) {
+        { op.rows() } -> std::convertible_to<core::index>;
+        { op.cols() } -> std::convertible_to<core::index>;
+    } && (requires(const Op& op, const Vec<T>& x, Vec<T>& y) { op.apply(x, y); } ||
+          requires(const Op& op, const Vec<T>& x, Vec<T>& y) { gemv(T{1}, op, x, T{}, y); });
+
+    template <typename P, typename T>
+    concept Preconditioner = requires(const P& p, const Vec<T>& r, Vec<T>& z) { p.apply(r, z); };
+
+    // y = A x
+    template <typename T, LinearOperator<T> Op>
+    void apply(const Op& A, const Vec<T>& x, Vec<T>& y) {
+        if constexpr (requires { A.apply(x, y); }) A.apply(x, y);
+        else gemv(T{1}, A, x, T{}, y);
+    }
+
+    // a callable f(const Vec<T>& x, Vec<T>& y) as a rows x cols operator
+    template <typename T, typename F>
+        requires std::invocable<const F&, const Vec<T>&, Vec<T>&>
+    class FunctionOperator {
+    public:
+        FunctionOperator(const core::index rows, const core::index cols, F f)
+            : rows_(rows), cols_(cols), f_(std::move(f)) {}
+
+        [[nodiscard]] core::index rows() const noexcept { return rows_; }
+        [[nodiscard]] core::index cols() const noexcept { return cols_; }
+        void apply(const Vec<T>& x, Vec<T>& y) const { f_(x, y); }
+
+    private:
+        core::index rows_;
+        core::index cols_;
+        F f_;
+    };
+
+    template <typename T, typename F>
+    [[nodiscard]] FunctionOperator<T, F> make_operator(const core::index rows, const core::index cols, F f) {
+        return FunctionOperator<T, F>(rows, cols, std::move(f));
+    }
+
+    struct IdentityPreconditioner {
+        template <typename T>
+        void apply(const Vec<T>& r, Vec<T>& z) const { z = r; }
+    };
+
+    // M = diag(A)
+    template <typename T>
+    class Jacobi {
+    public:
+        // A is a dense matrix / view or a CsrMat / CscMat, every diagonal entry must be nonzero
+        template <typename M>
+            requires requires(const M& m, core::index i) { { m(i, i) } -> std::convertible_to<T>; m.rows(); }
+        explicit Jacobi(const M& A) : inv_diag_(A.rows()) {
+            if (A.rows() != A.cols()) throw core::Error(core::ErrorCode::kShapeMismatch, "Jacobi(): matrix must be square");
+            for (core::index i = 0; i < A.rows(); ++i) {
+                const T d = A(i, i);
+                if (d == T{}) {
+                    throw core::Error(core::ErrorCode::kSingularMatrix,
+                        "Jacobi(): zero diagonal entry in row " + std::to_string(i));
+                }
+                inv_diag_[i] = T{1} / d;
+            }
+        }
+
+        [[nodiscard]] core::index size() const noexcept { return inv_diag_.size(); }
+
+        void apply(const Vec<T>& r, Vec<T>& z) const {
+            for (core::index i = 0; i < size(); ++i) z[i] = inv_diag_[i] * r[i];
+        }
+
+    private:
+        Vec<T> inv_diag_;
+    };
+
+    // M = L U with L unit lower and U upper restricted to the sparsity pattern of A, zero fill-in
+    template <typename T>
+    class Ilu0 {
+    public:
+        explicit Ilu0(CsrMat<T> A) : lu_(std::move(A)), diag_(lu_.rows()) {
+            if (lu_.rows() != lu_.cols()) throw core::Error(core::ErrorCode::kShapeMismatch, "Ilu0(): matrix must be square");
+            factor();
+        }
+
+        [[nodiscard]] core::index size() const noexcept { return lu_.rows(); }
+
+        // L below the diagonal (unit diagonal implied) and U on and above it, in the pattern of A
+        [[nodiscard]] const CsrMat<T>& packed() const noexcept { return lu_; }
+
+        void apply(const Vec<T>& r, Vec<T>& z) const {
+            const auto row_ptr = lu_.row_ptr();
+            const auto col = lu_.col_idx();
+            const auto val = lu_.values();
+            const core::index n = size();
+            // L y = r, then U z = y, in place in z
+            for (core::index i = 0; i < n; ++i) {
+                T s = r[i];
+                for (core::index k = row_ptr[i]; k < diag_[i]; ++k) s -= val[k] * z[col[k]];
+                z[i] = s;
+            }
+            for (core::index i = n; i-- > 0;) {
+                T s = z[i];
+                for (core::index k = diag_[i] + 1; k < row_ptr[i + 1]; ++k) s -= val[k] * z[col[k]];
+                z[i] = s / val[diag_[i]];
+            }
+        }
+
+    private:
+        CsrMat<T> lu_;
+        std::vector<core::index> diag_;     // position of (i, i) in the values of row i
+
+        // IKJ elimination, row k of U is final before row i > k uses it
+        void factor() {
+            const core::index n = size();
+            const auto row_ptr = lu_.row_ptr();
+            const auto col = lu_.col_idx();
+            const auto val = lu_.values();
+            constexpr core::index none = core::dynamic;
+            std::vector<core::index> pos(n, none);
+            for (core::index i = 0; i < n; ++i) {
+                const core::index lo = row_ptr[i], hi = row_ptr[i + 1];
+                diag_[i] = none;
+                for (core::index k = lo; k < hi; ++k) {
+                    pos[col[k]] = k;
+                    if (col[k] == i) diag_[i] = k;
+                }
+                if (diag_[i] == none) {
+                    throw core::Error(core::ErrorCode::kSingularMatrix,
+                        "Ilu0(): no diagonal entry in row " + std::to_string(i));
+                }
+                for (core::index k = lo; k < diag_[i]; ++k) {
+                    const core::index p = col[k];
+                    const T lik = val[k] / val[diag_[p]];
+                    val[k] = lik;
+                    for (core::index q = diag_[p] + 1; q < row_ptr[p + 1]; ++q) {
+                        if (pos[col[q]] != none) val[pos[col[q]]] -= lik * val[q];
+                    }
+                }
+                if (val[diag_[i]] == T{}) {
+                    throw core::Error(core::ErrorCode::kSingularMatrix,
+                        "Ilu0(): zero pivot in row " + std::to_string(i));
+                }
+                for (core::index k = lo; k < hi; ++k) pos[col[k]] = none;
+            }
+        }
+    };
+
+    struct KrylovOptions {
+        double tolerance = 1e-8;            // relative to |b|_2
+        double abs_tolerance = 0.0;
+        core::index max_iterations = 1000;  // operator applications (GMRES counts across restarts)
+        core::index restart = 30;           // Gmres only, Krylov basis size
+    };
+
+    struct KrylovResult {
+        core::index iterations = 0;
+        double residual = std::numeric_limits<double>::infinity();     // |b - A x|_2 / |b|_2
+        bool converged = false;
+    };
+
+    namespace detail {
+        template <typename T, typename Op>
+        void check_krylov(const Op& A, const Vec<T>& b, const Vec<T>& x, const core::index n, const char* msg) {
+            if (A.rows() != n || A.cols() != n || b.size() != n || x.size() != n) {
+                throw core::Error(core::ErrorCode::kShapeMismatch, msg);
+            }
+        }
+
+        // b = 0 is solved exactly by x = 0
+        template <typename T>
+        KrylovResult zero_solution(Vec<T>& x) {
+            x.fill(T{});
+            return {.iterations = 0, .residual = 0.0, .converged = true};
+        }
+
+        // stopping threshold on |r|_2
+        inline double krylov_target(const KrylovOptions& opts, const double b_norm) noexcept {
+            return std::max(opts.tolerance * b_norm, opts.abs_tolerance);
+        }
+    }
+
+    // preconditioned conjugate gradients for symmetric positive definite A
+    template <std::floating_point T>
+    class Cg {
+    public:
+        explicit Cg(const core::index n, const KrylovOptions& options = {})
+            : options_(options), r_(n), z_(n), p_(n), q_(n) {}
+
+        [[nodiscard]] core::index size() const noexcept { return r_.size(); }
+        [[nodiscard]] const KrylovOptions& options() const noexcept { return options_; }
+
+        template <LinearOperator<T> Op, Preconditioner<T> P = IdentityPreconditioner>
+        KrylovResult solve(const Op& A, const Vec<T>& b, Vec<T>& x, [[maybe_unused]] const P& M = {}) {
+            AXIOM_PROFILE_SCOPE("linalg::Cg::solve");
+            const core::index n = size();
+            detail::check_krylov(A, b, x, n, "Cg::solve(): A must be n x n and b, x have n elements");
+            constexpr bool identity = std::same_as<P, IdentityPreconditioner>;
+            // without a preconditioner z is r itself
+            const Vec<T>& z = identity ? r_ : z_;
+
+            KrylovResult result;
+            const double b_norm = b.l2_norm();
+            if (b_norm == 0.0) return detail::zero_solution(x);
+            const double target = detail::krylov_target(options_, b_norm);
+            linalg::apply(A, x, q_);
+            r_ = b - q_;
+            double r_norm = r_.l2_norm();
+            result.residual = r_norm / b_norm;
+            if (r_norm <= target) {
+                result.converged = true;
+                return result;
+            }
+            if constexpr (!identity) M.apply(r_, z_);
+            p_ = z;
+            T rz = dot(r_, z);
+
+            while (result.iterations < options_.max_iterations) {
+                linalg::apply(A, p_, q_);
+                const T pq = dot(p_, q_);
+                if (!(pq > T{})) {
+                    throw core::Error(core::ErrorCode::kNotPositiveDefinite,
+                        "Cg::solve(): operator is not positive definite");
+                }
+                const T alpha = rz / pq;
+                for (core::index i = 0; i < n; ++i) {
+                    x[i] += alpha * p_[i];
+                    r_[i] -= alpha * q_[i];
+                }
+                ++result.iterations;
+                r_norm = r_.l2_norm();
+                result.residual = r_norm / b_norm;
+                if (r_norm <= target) {
+                    result.converged = true;
+                    break;
+                }
+                if constexpr (!identity) M.apply(r_, z_);
+                const T rz_next = dot(r_, z);
+                const T beta = rz_next / rz;
+                rz = rz_next;
+                p_ = z + beta * p_;
+            }
+            return result;
+        }
+
+    private:
+        KrylovOptions options_;
+        Vec<T> r_, z_, p_, q_;
+    };
+
+    // restarted GMRES(m) with right preconditioning, A x = b for any nonsingular A
+    template <std::floating_point T>
+    class Gmres {
+    public:
+        explicit Gmres(const core::index n, const KrylovOptions& options = {})
+            : options_(check_restart(options)), basis_(options.restart + 1, Vec<T>(n)), w_(n), z_(n),
+              h_(options.restart + 1, options.restart), cs_(options.restart), sn_(options.restart),
+              g_(options.restart + 1), y_(options.restart) {}
+
+        [[nodiscard]] core::index size() const noexcept { return w_.size(); }
+        [[nodiscard]] const KrylovOptions& options() const noexcept { return options_; }
+
+        template <LinearOperator<T> Op, Preconditioner<T> P = IdentityPreconditioner>
+        KrylovResult solve(const Op& A, const Vec<T>& b, Vec<T>& x, const P& M = {}) {
+            AXIOM_PROFILE_SCOPE("linalg::Gmres::solve");
+            const core::index n = size();
+            detail::check_krylov(A, b, x, n, "Gmres::solve(): A must be n x n and b, x have n elements");
+            const core::index m = options_.restart;
+
+            KrylovResult result;
+            const double b_norm = b.l2_norm();
+            if (b_norm == 0.0) return detail::zero_solution(x);
+            const double target = detail::krylov_target(options_, b_norm);
+            while (true) {
+                // true residual at every restart, r lives in the first basis vector
+                Vec<T>& r = basis_[0];
+                linalg::apply(A, x, w_);
+                r = b - w_;
+                const T beta = static_cast<T>(r.l2_norm());
+                result.residual = beta / b_norm;
+                if (beta <= target) {
+                    result.converged = true;
+                    break;
+                }
+                if (result.iterations >= options_.max_iterations) break;
+                r /= beta;
+                g_.fill(T{});
+                g_[0] = beta;
+
+                core::index k = 0;
+                while (k < m && result.iterations < options_.max_iterations) {
+                    // w = A M^-1 v_k, orthogonalized against the basis (modified Gram-Schmidt)
+                    M.apply(basis_[k], z_);
+                    linalg::apply(A, z_, w_);
+                    for (core::index i = 0; i <= k; ++i) {
+                        const T hik = dot(w_, basis_[i]);
+                        h_(i, k) = hik;
+                        w_ -= hik * basis_[i];
+                    }
+                    const T h_next = static_cast<T>(w_.l2_norm());
+                    h_(k + 1, k) = h_next;
+                    if (h_next != T{}) basis_[k + 1] = w_ / h_next;
+
+                    // earlier rotations, then the one that zeroes h(k + 1, k)
+                    for (core::index i = 0; i < k; ++i) {
+                        const T a = h_(i, k), c = h_(i + 1, k);
+                        h_(i, k) = cs_[i] * a + sn_[i] * c;
+                        h_(i + 1, k) = -sn_[i] * a + cs_[i] * c;
+                    }
+                    const T a = h_(k, k), c = h_(k + 1, k);
+                    const T rho = std::hypot(a, c);
+                    cs_[k] = rho == T{} ? T{1} : a / rho;
+                    sn_[k] = rho == T{} ? T{} : c / rho;
+                    h_(k, k) = rho;
+                    h_(k + 1, k) = T{};
+                    g_[k + 1] = -sn_[k] * g_[k];
+                    g_[k] = cs_[k] * g_[k];
+
+                    ++k;
+                    ++result.iterations;
+                    result.residual = std::abs(g_[k]) / b_norm;
+                    // h_next == 0 is a lucky breakdown, the basis holds the exact solution
+                    if (std::abs(g_[k]) <= target || h_next == T{}) break;
+                }
+
+                // y = H^-1 g on the leading k x k triangle, x += M^-1 V y
+                for (core::index i = k; i-- > 0;) {
+                    T s = g_[i];
+                    for (core::index j = i + 1; j < k; ++j) s -= h_(i, j) * y_[j];
+                    y_[i] = s / h_(i, i);
+                }
+                w_.fill(T{});
+                for (core::index i = 0; i < k; ++i) w_ += y_[i] * basis_[i];
+                M.apply(w_, z_);
+                x += z_;
+            }
+            return result;
+        }
+
+    private:
+        KrylovOptions options_;
+        std::vector<Vec<T>> basis_;
+        Vec<T> w_, z_;
+        Mat<T> h_;
+        Vec<T> cs_, sn_, g_, y_;
+
+        static const KrylovOptions& check_restart(const KrylovOptions& options) {
+            if (options.restart == 0) {
+                throw core::Error(core::ErrorCode::kInvalidArgument, "Gmres(): restart must be positive");
+            }
+            return options;
+        }
+    };
+
+    // one-shot helpers, keep a Cg / Gmres to reuse the workspace
+    template <std::floating_point T, LinearOperator<T> Op, Preconditioner<T> P = IdentityPreconditioner>
+    KrylovResult cg(const Op& A, const Vec<T>& b, Vec<T>& x, const P& M = {}, const KrylovOptions& options = {}) {
+        return Cg<T>(b.size(), options).solve(A, b, x, M);
+    }
+
+    template <std::floating_point T, LinearOperator<T> Op, Preconditioner<T> P = IdentityPreconditioner>
+    KrylovResult gmres(const Op& A, const Vec<T>& b, Vec<T>& x, const P& M = {}, const KrylovOptions& options = {}) {
+        return Gmres<T>(b.size(), options).solve(A, b, x, M);
+    }
+}
+
+#endif //AXIOM_KRYLOV_HPP
\ No newline at end of file
@@ -3,20 +3,36 @@
 
 #include <vector>
 #include <algorithm>
+#include <concepts>
+#include <iterator>
+#include <type_traits>
 #include <utility>
 
 #include "axiom/core/assert.hpp"
 #include "axiom/core/core.hpp"
+#include "axiom/core/memory.hpp"
+#include "axiom/linalg/expr.hpp"
+#include "axiom/linalg/view.hpp"
 
 namespace axiom::linalg {
-    template <typename T>
-    class Mat {
-        // row-major layout w/ indexing by data_[r * cols + c]
-        std::vector<T> data_;
-        core::index cols_;
+    // heap-backed matrix, Mat<T, R, C> with compile-time R, C lives in fixed.hpp
+    // L picks the storage order, Mat<T> is row-major, Mat<T, core::dynamic, core::dynamic, ColMajor>
+    // keeps columns contiguous (col(j) is a unit-stride view, LAPACK-style data as is)
+    template <typename T, typename L>
+    class Mat<T, core::dynamic, core::dynamic, L> : public MatExpr<Mat<T, core::dynamic, core::dynamic, L>> {
+        static_assert(std::same_as<L, RowMajor> || std::same_as<L, ColMajor>,
+                      "Mat: layout must be RowMajor or ColMajor");
+        static constexpr bool kRowMajor = std::same_as<L, RowMajor>;
+
+        // indexing by data_[r * cols + c] (row-major) or data_[c * rows + r] (column-major),
+        // 64-byte aligned and drawn from core::current_resource() at construction (see core/memory.hpp)
+        using storage = core::aligned_vector<T>;
+        storage data_;
+        core::index ld_;    // leading dimension, cols (row-major) or rows (column-major)
 
         [[nodiscard]] core::index idx(const core::index row_index, const core::index col_index) const {
-            return row_index * cols_ + col_index;
+            if constexpr (kRowMajor) return row_index * ld_ + col_index;
+            else return col_index * ld_ + row_index;
         }
 
         static void validate_dims(const core::index rows, const core::index cols) {
@@ -29,7 +45,8 @@ namespace axiom::linalg {
                 "Mat(n): rows and cols must be >= 1");
         }
 
-        static std::vector<T> check_data(std::vector<T>&& data, core::index cols) {
+        template <typename Alloc>
+        static storage check_data(std::vector<T, Alloc>&& data, core::index cols) {
             if (cols == 0) {
                 throw core::Error(core::ErrorCode::kInvalidArgument,
                                   "Mat(data, cols): cols must be >= 1");
@@ -42,33 +59,79 @@ namespace axiom::linalg {
                 throw core::Error(core::ErrorCode::kShapeMismatch,
                                   "Mat(data, cols): data.size() must be a multiple of cols");
             }
-            return std::move(data);
+            if constexpr (std::is_same_v<Alloc, core::Allocator<T>>) return std::move(data);
+            else return storage(std::make_move_iterator(data.begin()), std::make_move_iterator(data.end()));
         }
 
-        static std::vector<T> make_data(const core::index r, const core::index c, T val = T{}) {
+        static storage make_data(const core::index r, const core::index c, T val = T{}) {
             validate_dims(r, c);
-            return std::vector<T>(r * c, val);
+            return storage(r * c, val);
         }
 
         void check_idx_out_of_range(const core::index row, const core::index col) const {
-            if (idx(row, col) >= size()) {
+            if (row >= rows() || col >= cols()) {
                 throw core::Error(core::ErrorCode::kOutOfBounds, "Mat index out of bounds");
             }
         }
 
+        void check_same_shape(const core::index rows, const core::index cols, const char* msg) const {
+            if (this->rows() != rows || this->cols() != cols) throw core::Error(core::ErrorCode::kShapeMismatch, msg);
+        }
+
+        // f(element, r, c) over the storage in storage order
+        template <typename F>
+        void for_each(F f) {
+            const core::index outer = data_.size() / ld_;
+            for (core::index o = 0; o < outer; ++o) {
+                T* line = data_.data() + o * ld_;
+                for (core::index i = 0; i < ld_; ++i) {
+                    if constexpr (kRowMajor) f(line[i], o, i);
+                    else f(line[i], i, o);
+                }
+            }
+        }
+
+        // storage-order independent copies (views, the other layout) go through the
+        // cache-oblivious copy_blocked(), anything else is evaluated element by element
+        template <typename E>
+        void assign(const E& e) {
+            if constexpr (requires { detail::cview(e); }) {
+                detail::copy_blocked<T>(detail::cview(e), view());
+            } else {
+                for_each([&](T& x, const core::index r, const core::index c) { x = e(r, c); });
+            }
+        }
+
     public:
+        using value_type = T;
+        using layout = L;
+        static constexpr core::index static_rows = core::dynamic;
+        static constexpr core::index static_cols = core::dynamic;
+
         // Constructors
-        explicit Mat(std::vector<T>&& data, const core::index cols)
-            : data_(check_data(std::move(data), cols)), cols_(cols) {}
+        // takes over aligned storage in storage order, any other vector is copied into it
+        template <typename Alloc>
+        explicit Mat(std::vector<T, Alloc>&& data, const core::index cols)
+            : data_(check_data(std::move(data), cols)), ld_(kRowMajor ? cols : data_.size() / cols) {}
 
         explicit Mat(const core::index rows, const core::index cols)
-            : data_(make_data(rows, cols)), cols_(cols) {}
+            : data_(make_data(rows, cols)), ld_(kRowMajor ? cols : rows) {}
 
         explicit Mat(const core::index n) : Mat(n,n) {}
 
+        // evaluates an expression in a single pass, e.g. Mat<T> C = A + 2 * B;
+        // a matrix of the other layout converts with one blocked transpose pass
+        template <typename E>
+            requires (!std::same_as<E, Mat>)
+        Mat(const MatExpr<E>& expr)
+            : data_(make_data(expr.derived().rows(), expr.derived().cols())),
+              ld_(kRowMajor ? expr.derived().cols() : expr.derived().rows()) {
+            assign(expr.derived());
+        }
+
         static Mat identity(core::index n) {
             validate_square(n);
-            std::vector<T> data(n*n);
+            storage data(n*n);
             for (core::index i = 0; i < n; i++) {
                 core::index idx = i * n + i;
                 data[idx] = T{1};
@@ -97,10 +160,22 @@ namespace axiom::linalg {
         T* data() noexcept { return data_.data(); }
         const T* data() const noexcept { return data_.data(); }
         [[nodiscard]] core::index rows() const {
-            AXIOM_ASSERT(cols_ != 0, "cols_ must be non-zero");
-            return data_.size() / cols_;
+            if constexpr (kRowMajor) {
+                AXIOM_ASSERT(ld_ != 0, "ld_ must be non-zero");
+                return data_.size() / ld_;
+            } else {
+                return ld_;
+            }
+        }
+        [[nodiscard]] core::index cols() const {
+            if constexpr (kRowMajor) {
+                return ld_;
+            } else {
+                AXIOM_ASSERT(ld_ != 0, "ld_ must be non-zero");
+                return data_.size() / ld_;
+            }
         }
-        [[nodiscard]] core::index cols() const { return cols_; }
+        [[nodiscard]] core::index leading_dim() const noexcept { return ld_; }
 
         // Overload operations
         T& operator()(const core::index row, const core::index col) {
@@ -121,12 +196,87 @@ namespace axiom::linalg {
             return data_[idx(row, col)];
         }
 
+        // Views
+        MatView<T> view() noexcept {
+            if constexpr (kRowMajor) return {data(), rows(), ld_, ld_};
+            else return {data(), ld_, cols(), 1, ld_};
+        }
+        MatView<const T> view() const noexcept {
+            if constexpr (kRowMajor) return {data(), rows(), ld_, ld_};
+            else return {data(), ld_, cols(), 1, ld_};
+        }
+        // zero-copy transpose
+        MatView<T> transposed() noexcept { return view().transposed(); }
+        MatView<const T> transposed() const noexcept { return view().transposed(); }
+        VecView<T> row(const core::index i) { return view().row(i); }
+        VecView<const T> row(const core::index i) const { return view().row(i); }
+        VecView<T> col(const core::index j) { return view().col(j); }
+        VecView<const T> col(const core::index j) const { return view().col(j); }
+        MatView<T> block(const core::index row, const core::index col, const core::index rows, const core::index cols) {
+            return view().block(row, col, rows, cols);
+        }
+        MatView<const T> block(const core::index row, const core::index col, const core::index rows,
+                               const core::index cols) const {
+            return view().block(row, col, rows, cols);
+        }
+        MatView<T> row_range(const core::index first, const core::index count) {
+            return view().row_range(first, count);
+        }
+        MatView<const T> row_range(const core::index first, const core::index count) const {
+            return view().row_range(first, count);
+        }
+
+        // assignment from an expression, elementwise so A = A + B is alias-safe, a shape change or
+        // an operand anywhere in the expression that reorders this matrix's own elements
+        // (A = A.transposed() + B, also for += / -=) evaluates into fresh storage first
+        template <typename E>
+            requires (!std::same_as<E, Mat>)
+        Mat& operator=(const MatExpr<E>& expr) {
+            const E& e = expr.derived();
+            if (rows() != e.rows() || cols() != e.cols()) return *this = Mat(expr);
+            if (detail::reorders<T>(view(), e)) return *this = Mat(expr);
+            assign(e);
+            return *this;
+        }
+
+        // matrix addition / subtraction
+        template <typename E>
+        Mat& operator+=(const MatExpr<E>& expr) {
+            const E& e = expr.derived();
+            check_same_shape(e.rows(), e.cols(), "mat operator +: matrices must be of same shape");
+            if (detail::reorders<T>(view(), e)) return *this += Mat(e);
+            for_each([&](T& x, const core::index r, const core::index c) { x += e(r, c); });
+            return *this;
+        }
+
+        template <typename E>
+        Mat& operator-=(const MatExpr<E>& expr) {
+            const E& e = expr.derived();
+            check_same_shape(e.rows(), e.cols(), "mat operator -: matrices must be of same shape");
+            if (detail::reorders<T>(view(), e)) return *this -= Mat(e);
+            for_each([&](T& x, const core::index r, const core::index c) { x -= e(r, c); });
+            return *this;
+        }
+
+        // scalar multiplication / division
+        Mat& operator*=(const T& val) {
+            for (auto& x : data_) x *= val;
+            return *this;
+        }
+
+        Mat& operator/=(const T& val) {
+            if (val == T{}) throw core::Error(core::ErrorCode::kDivideByZero,
+                "mat operator /: cannot divide by 0");
+            for (auto& x : data_) x /= val;
+            return *this;
+        }
+
         // Ops
         void fill(const T& val) { std::fill(data_.begin(), data_.end(), val); }
 
-        // Iterators
-        using iterator = std::vector<T>::iterator;
-        using const_iterator = std::vector<T>::const_iterator;
+        // Iterators, in storage order
+        using iterator = typename storage::iterator;
+        using const_iterator = typename storage::const_iterator;
         iterator begin() noexcept { return data_.begin(); }
         iterator end() noexcept { return data_.end(); }
         const_iterator begin() const noexcept { return data_.begin(); }
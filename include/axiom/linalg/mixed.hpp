@@ -0,0 +1,115 @@
+#ifndef AXIOM_MIXED_HPP
+#define AXIOM_MIXED_HPP
+
+#include <limits>
+#include <optional>
+
+#include "axiom/core/core.hpp"
+#include "axiom/exec/exec.hpp"
+#include "axiom/linalg/decomposition.hpp"
+#include "axiom/linalg/mat.hpp"
+#include "axiom/linalg/vec.hpp"
+#include "axiom/linalg/view.hpp"
+
+namespace axiom::linalg {
+/*
+ * mixed-precision dense solves: factor in float, refine in double
+ * - A (double) is rounded to float once and factored with LU or Cholesky, the O(n^3) work runs
+ *   at float SIMD width over half the bytes, A itself is kept in double for the residuals
+ *   (so with kCholesky the whole symmetric A is read, not only its lower triangle)
+ * - every refinement step is r = b - A x in double (one gemv), a float solve for the correction
+ *   and x += d, each step costs O(n^2)
+ * - the residual reported is the normwise backward error |b - A x|_inf / (|A|_inf |x|_inf + |b|_inf),
+ *   refinement stops once it is <= tolerance (default sqrt(n) eps of double, as LAPACK dsgesv)
+ * - refinement that stalls (a step shrinks the residual by less than half), diverges or runs out
+ *   of iterations falls back to a double factorization, as does a float factorization that is
+ *   singular, not positive definite or would overflow float; the double factor is kept, later
+ *   solves go to it directly
+ * - this pays off for condition numbers well below 1 / eps of float (about 1e7), beyond that the
+ *   fallback costs one extra factorization over solving in double in the first place
+ */
+
+    enum class Factorization { kLU, kCholesky };
+
+    // kFallback: the solution came from the double factorization
+    enum class RefineStatus { kConverged, kFallback, kNotConverged };
+
+    struct RefineOptions {
+        Factorization factorization = Factorization::kLU;
+        double tolerance = 0.0;             // 0 = sqrt(n) eps of double
+        core::index max_iterations = 30;
+        bool fallback = true;               // false reports kNotConverged instead of refactoring
+        core::index block = 64;
+        exec::Parallel policy = exec::on_threads(1);    // factorizations and residuals
+    };
+
+    struct RefineResult {
+        core::index iterations = 0;         // refinement steps after the first float solve
+        double residual = std::numeric_limits<double>::infinity();
+        RefineStatus status = RefineStatus::kNotConverged;
+
+        [[nodiscard]] bool converged() const noexcept { return status != RefineStatus::kNotConverged; }
+    };
+
+    struct MixedSolution {
+        Vec<double> x;
+        RefineResult report;
+    };
+
+    class MixedSolver {
+    public:
+        // A is copied, rounded to float and factored
+        template <MatLike M>
+            requires std::same_as<scalar_t<M>, double>
+        explicit MixedSolver(const M& A, const RefineOptions& opts = {})
+            : MixedSolver(Mat<double>(detail::cview(A)), opts) {}
+
+        explicit MixedSolver(Mat<double> A, const RefineOptions& opts = {});
+
+        [[nodiscard]] core::index size() const noexcept { return a_.rows(); }
+        [[nodiscard]] const RefineOptions& options() const noexcept { return opts_; }
+
+        // true once the double factorization has been made
+        [[nodiscard]] bool fell_back() const noexcept { return lu64_.has_value() || chol64_.has_value(); }
+
+        // solves A x = b into x (A.rows() elements), x is only an output
+        template <VecLike V, WritableVec W>
+            requires std::same_as<scalar_t<V>, double> && std::same_as<scalar_t<W>, double>
+        RefineResult solve(const V& b, W&& x) {
+            return solve_view(detail::cview(b), detail::mview(x));
+        }
+
+        template <VecLike V>
+            requires std::same_as<scalar_t<V>, double>
+        [[nodiscard]] MixedSolution solve(const V& b) {
+            MixedSolution s{Vec<double>(size()), {}};
+            s.report = solve_view(detail::cview(b), s.x.view());
+            return s;
+        }
+
+    private:
+        Mat<double> a_;
+        double a_norm_ = 0.0;
+        RefineOptions opts_;
+        std::optional<LU<float>> lu32_;
+        std::optional<Cholesky<float>> chol32_;
+        std::optional<LU<double>> lu64_;
+        std::optional<Cholesky<double>> chol64_;
+
+        RefineResult solve_view(VecView<const double> b, VecView<double> x);
+        void factor_low();
+        void factor_high();
+        void solve_low(Vec<float>& r) const;
+        void solve_high(Vec<double>& r) const;
+        [[nodiscard]] double backward_error(VecView<const double> b, const Vec<double>& x, Vec<double>& r) const;
+    };
+
+    // one-shot helper, keep a MixedSolver to reuse the factorization
+    template <MatLike M, VecLike V>
+        requires std::same_as<scalar_t<M>, double> && std::same_as<scalar_t<V>, double>
+    [[nodiscard]] MixedSolution mixed_solve(const M& A, const V& b, const RefineOptions& opts = {}) {
+        return MixedSolver(A, opts).solve(b);
+    }
+}
+
+#endif //AXIOM_MIXED_HPP
\ No newline at end of file
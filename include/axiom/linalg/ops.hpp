@@ -5,18 +5,24 @@
 #include <algorithm>
 #include <numeric>
 #include <concepts>
+#include <type_traits>
+#include <utility>
 
 #include "axiom/core/core.hpp"
 #include "axiom/core/assert.hpp"
+#include "axiom/exec/exec.hpp"
 #include "axiom/linalg/vec.hpp"
 #include "axiom/linalg/mat.hpp"
+#include "axiom/linalg/fixed.hpp"
+#include "axiom/linalg/kernels.hpp"
+#include "axiom/linalg/view.hpp"
 
 namespace axiom::linalg {
 /*
  * vector ops:
  * Completed:
  * - dot product, isOrthogonal
- * -operator overloading addition / subtraction
+ * -operator overloading addition / subtraction (lazy expression templates, see expr.hpp)
  * -scalar multiplication / division
  * -in place ops +=, -=, *=, /=
  * -unary negation -v
@@ -25,33 +31,95 @@ namespace axiom::linalg {
  * -vector projection
  * -isApprox(v, w, eps)
  * -normalize
- * -distance(a,b) / distanceSquared(a,b)
+ * -distance(a,b) / distanceSquared(a,b), all pairs of two point sets and k-nearest neighbours
+ *  go through pairwise_sq_distances / knn (distance.hpp)
  * -cross product (3 dim)
  * -reflect (v,n) off a normal vector
  * -Component-wise min/max: min(a,b), max(a,b)
  * - abs(), clamp(), floor/ceil()
  * -sum(), minCoeff(), maxCoeff(), argMin/argMax
+ * - sum / dot / norm / minCoeff / maxCoeff and abs / floor / ceil / clamp / min / max also take an
+ *   execution policy first (exec::seq, exec::par, see exec/exec.hpp), chunks of contiguous
+ *   operands still run on the SIMD kernels
  *
+ * float / double reductions run on the SIMD kernels in kernels.hpp, every op takes Vec / Mat
+ * or a strided VecView / MatView (see view.hpp), contiguous views keep the SIMD path
+ * fixed-size Vec<T, N> / Mat<T, R, C> (see fixed.hpp) take unrolled constexpr paths and return
+ * fixed-size results, mismatched fixed sizes are rejected at compile time
+ *
+ * matrix ops:
+ * - gemm(alpha, A, B, beta, C) / matmul(A, B), packed and cache-blocked for float / double
+ * - gemv / gemv_t (y = alpha * A x + beta * y and alpha * A^T x + beta * y into a caller-owned
+ *   y, no allocation), matvec / matvec_t return a new vector
+ * - all of them take an execution policy first, min_size counts multiply-adds; the forms ending
+ *   in `threads` map to exec::on_threads(threads)
  */
 
-    template <typename T>
-    T dot(const Vec<T>& a, const Vec<T>& b) {
-        std::size_t n = a.size();
-        if (b.size() != n) {
-            throw core::Error(core::ErrorCode::kShapeMismatch, "dot(): vectors must be of same size");
+    namespace detail {
+        // result type of an op on v: Vec<T, N> for a fixed-size input, Vec<T> otherwise
+        template <typename V> struct result_vec { using type = Vec<scalar_t<V>>; };
+        template <typename T, core::index N> struct result_vec<Vec<T, N>> { using type = Vec<T, N>; };
+        template <typename V>
+        using result_vec_t = typename result_vec<std::remove_cvref_t<V>>::type;
+
+        template <typename A, typename B> struct result_mat { using type = Mat<scalar_t<A>>; };
+        template <typename T, core::index R, core::index K, core::index C>
+            requires (R != core::dynamic)
+        struct result_mat<Mat<T, R, K>, Mat<T, K, C>> { using type = Mat<T, R, C>; };
+        template <typename A, typename B>
+        using result_mat_t = typename result_mat<std::remove_cvref_t<A>, std::remove_cvref_t<B>>::type;
+
+        // result vector from an argument, moves an rvalue Vec and copies anything else
+        template <typename T>
+        Vec<T> to_vec(Vec<T>&& v) { return std::move(v); }
+        template <typename T, core::index N>
+            requires (N != core::dynamic)
+        constexpr Vec<T, N> to_vec(const Vec<T, N>& v) { return v; }
+        template <VecLike V>
+        Vec<scalar_t<V>> to_vec(const V& v) { return Vec<scalar_t<V>>(cview(v)); }
+
+        template <typename V, typename F>
+        constexpr V transform(V v, F f) {
+            for (auto& x : v) x = f(x);
+            return v;
+        }
+
+        template <typename MA, typename MB, typename MC>
+        concept gemm_shapes = sizes_agree(MA::static_cols, MB::static_rows) &&
+                              sizes_agree(MA::static_rows, MC::static_rows) &&
+                              sizes_agree(MB::static_cols, MC::static_cols);
+    }
+
+    template <VecLike A, VecLike B>
+        requires SameScalar<A, B> && SameSize<A, B>
+    constexpr scalar_t<A> dot(const A& a, const B& b) {
+        using T = scalar_t<A>;
+        if constexpr (detail::all_fixed<A, B>) {
+            return detail::unrolled_sum<T, A::static_size>([&](const core::index i) { return a[i] * b[i]; });
+        } else {
+            const auto x = detail::cview(a);
+            const auto y = detail::cview(b);
+            std::size_t n = x.size();
+            if (y.size() != n) {
+                throw core::Error(core::ErrorCode::kShapeMismatch, "dot(): vectors must be of same size");
+            }
+            if constexpr (kernels::has_simd<T>) {
+                if (x.contiguous() && y.contiguous()) return kernels::dot(x.data(), y.data(), n);
+            }
+            T sum{};
+            for (std::size_t i = 0; i < n; ++i) sum += x[i] * y[i];
+            return sum;
         }
-        T sum{};
-        for (std::size_t i = 0; i < n; ++i) sum += a[i] * b[i];
-        return sum;
     }
 
-    template <typename T>
-    bool is_orthogonal(const Vec<T>& a, const Vec<T>& b) {
-        return core::nearly_equal(dot(a, b), T{});
+    template <VecLike A, VecLike B>
+        requires SameScalar<A, B> && SameSize<A, B>
+    bool is_orthogonal(const A& a, const B& b) {
+        return core::nearly_equal(dot(a, b), scalar_t<A>{});
     }
 
-    template <typename T>
-    [[nodiscard]] double norm(const Vec<T>& v, const std::size_t order = 1) {
+    template <VecLike V>
+    [[nodiscard]] double norm(const V& v, const std::size_t order = 1) {
         // 0 is infinity norm, 1 is L1 norm, 2 is L2 norm
         switch (order) {
             case 0: return static_cast<double>(v.infty_norm());
@@ -63,36 +131,47 @@ namespace axiom::linalg {
         }
     }
 
-    template <typename T>
-    double len(const Vec<T>& v) {
+    template <VecLike V>
+    double len(const V& v) {
         return norm(v,2);
     }
 
-    template <typename T>
-    double len_squared(const Vec<T>& v) {
-        long double sum = 0.0L;
-        for (const auto& x : v) {
-            const auto xx = static_cast<long double>(x);
-            sum += core::sq(xx);
+    template <VecLike V>
+    constexpr double len_squared(const V& v) {
+        using T = scalar_t<V>;
+        if constexpr (detail::all_fixed<V>) {
+            return detail::unrolled_sum<double, V::static_size>([&](const core::index i) {
+                return core::sq(static_cast<double>(v[i]));
+            });
+        } else {
+            const auto x = detail::cview(v);
+            if constexpr (kernels::has_simd<T>) {
+                if (x.contiguous()) return kernels::sum_sq(x.data(), x.size());
+            }
+            return kernels::detail::compensated_sum(x.begin(), x.end(), [](const T& e) {
+                return core::sq(static_cast<double>(e));
+            });
         }
-        return sum;
     }
 
-    template <typename T>
-    Vec<T> proj(const Vec<T>& u, const Vec<T>& v) {
+    template <VecLike U, VecLike V>
+        requires SameScalar<U, V> && SameSize<U, V>
+    detail::result_vec_t<V> proj(const U& u, const V& v) {
         // projects u onto v
+        using T = scalar_t<U>;
         T denom = dot(v, v);
         if (denom == T{}) {
             throw core::Error(core::ErrorCode::kDivideByZero,
                               "proj(u,v): cannot project onto zero vector");
         }
         T scalar = dot(u, v) / denom;
-        return scalar * v;
+        return detail::result_vec_t<V>(scalar * v);
     }
 
-    template <typename T>
-    bool is_approx(const Vec<T>& v, const Vec<T>&w, T epsilon = std::numeric_limits<T>::epsilon()) {
-       const std::size_t n = v.size();
+    template <VecLike V, VecLike W>
+        requires SameScalar<V, W> && SameSize<V, W>
+    bool is_approx(const V& v, const W& w, scalar_t<V> epsilon = std::numeric_limits<scalar_t<V>>::epsilon()) {
+        const std::size_t n = v.size();
         if (n != w.size()) {
             throw core::Error(core::ErrorCode::kShapeMismatch,
                 "is_approx(): vectors should be of same length");
@@ -105,128 +184,193 @@ namespace axiom::linalg {
         return true;
     }
 
-    template <typename T>
-    Vec<T> normalize(Vec<T> v) {
-        double len = len(v);
-        if (len == 0.0) throw core::Error(core::ErrorCode::kDivideByZero, "normalize: zero vector");
-        return v / static_cast<T>(len);
+    template <VecLike V>
+    detail::result_vec_t<V> normalize(V&& v) {
+        const double length = len(v);
+        if (length == 0.0) throw core::Error(core::ErrorCode::kDivideByZero, "normalize: zero vector");
+        detail::result_vec_t<V> out = detail::to_vec(std::forward<V>(v));
+        out /= static_cast<scalar_t<V>>(length);
+        return out;
     }
 
-    template <typename T>
-    T distanceSquared(const Vec<T>& a, const Vec<T>& b) {
-        const std::size_t n = a.size();
-        if (n != b.size()) {
-            throw core::Error(core::ErrorCode::kShapeMismatch,
-                "distance(): vectors should be of same length");
-        }
-        T sum{};
-        for (std::size_t i = 0; i < n; ++i) {
-            T diff = a[i] - b[i];
-            sum += core::sq(diff);
+    template <VecLike A, VecLike B>
+        requires SameScalar<A, B> && SameSize<A, B>
+    constexpr scalar_t<A> distanceSquared(const A& a, const B& b) {
+        using T = scalar_t<A>;
+        if constexpr (detail::all_fixed<A, B>) {
+            return detail::unrolled_sum<T, A::static_size>([&](const core::index i) { return core::sq(a[i] - b[i]); });
+        } else {
+            const auto x = detail::cview(a);
+            const auto y = detail::cview(b);
+            const std::size_t n = x.size();
+            if (n != y.size()) {
+                throw core::Error(core::ErrorCode::kShapeMismatch,
+                    "distance(): vectors should be of same length");
+            }
+            if constexpr (kernels::has_simd<T>) {
+                if (x.contiguous() && y.contiguous()) return kernels::dist_sq(x.data(), y.data(), n);
+            }
+            T sum{};
+            for (std::size_t i = 0; i < n; ++i) {
+                T diff = x[i] - y[i];
+                sum += core::sq(diff);
+            }
+            return sum;
         }
-        return sum;
     }
 
-    template <typename T>
-    double distance(const Vec<T>& a, const Vec<T>& b) {
+    template <VecLike A, VecLike B>
+        requires SameScalar<A, B> && SameSize<A, B>
+    double distance(const A& a, const B& b) {
         return std::sqrt(static_cast<double>(distanceSquared(a, b)));
     }
 
-    template <typename T>
-    Vec<T> cross(const Vec<T>& u, const Vec<T>& v) {
-        if (u.size() != 3 || v.size() != 3) {
-            throw core::Error(core::ErrorCode::kShapeMismatch,
-                "cross(): vectors must be of size 3");
+    // fixed-size operands return a Vec<T, 3> with no allocation and no runtime size check
+    template <VecLike U, VecLike V>
+        requires SameScalar<U, V> && SameSize<U, V> && SameSize<U, Vec<scalar_t<U>, 3>>
+    constexpr detail::result_vec_t<U> cross(const U& u, const V& v) {
+        if constexpr (!detail::all_fixed<U, V>) {
+            if (u.size() != 3 || v.size() != 3) {
+                throw core::Error(core::ErrorCode::kShapeMismatch,
+                    "cross(): vectors must be of size 3");
+            }
         }
-        Vec<T> out(3);
+        using R = detail::result_vec_t<U>;
+        R out = [] {
+            if constexpr (detail::all_fixed<U>) return R{};
+            else return Vec<scalar_t<U>>(3);
+        }();
         out[0] = (u[1] * v[2]) - (u[2] * v[1]);
         out[1] = -((u[0] * v[2]) - (u[2] * v[0]));
         out[2] = (u[0] * v[1]) - (u[1] * v[0]);
         return out;
     }
 
-    template <typename T>
-    Vec<T> reflect(const Vec<T>& v, const Vec<T>& n) {
-        return v - 2 * dot(v, n) * n;
+    template <VecLike V, VecLike N>
+        requires SameScalar<V, N> && SameSize<V, N>
+    detail::result_vec_t<V> reflect(const V& v, const N& n) {
+        // lazy expression, evaluated straight into the result in one pass
+        using T = scalar_t<V>;
+        return detail::result_vec_t<V>(v - T{2} * dot(v, n) * n);
     }
 
     // component-wise min and max
-    template <typename T, typename Op>
-    Vec<T> cwise_binary(Vec<T> a, const Vec<T>& b, Op op) {
-            const std::size_t n = a.size();
+    template <VecLike A, VecLike B, typename Op>
+        requires SameScalar<A, B> && SameSize<A, B>
+    constexpr detail::result_vec_t<A> cwise_binary(A&& a, const B& b, Op op) {
+            detail::result_vec_t<A> out = detail::to_vec(std::forward<A>(a));
+            const std::size_t n = out.size();
             if (n != b.size()) {
                 throw core::Error(core::ErrorCode::kShapeMismatch,
                                   "cwise_binary(): vectors should be of same length");
             }
-            for (std::size_t i = 0; i < n; ++i) a[i] = op(a[i], b[i]);
-            return a;
+            for (std::size_t i = 0; i < n; ++i) out[i] = op(out[i], b[i]);
+            return out;
     }
 
-    template <typename T>
-    Vec<T> min(Vec<T> a, const Vec<T>& b) {
-        return cwise_binary(std::move(a), b, [](const T& x, const T& y) {
+    template <VecLike A, VecLike B>
+        requires SameScalar<A, B> && SameSize<A, B>
+    constexpr detail::result_vec_t<A> min(A&& a, const B& b) {
+        using T = scalar_t<A>;
+        return cwise_binary(std::forward<A>(a), b, [](const T& x, const T& y) {
             return std::min(x, y);
         });
     }
 
-    template <typename T>
-    Vec<T> max(Vec<T> a, const Vec<T>& b) {
-        return cwise_binary(std::move(a), b, [](const T& x, const T& y) {
+    template <VecLike A, VecLike B>
+        requires SameScalar<A, B> && SameSize<A, B>
+    constexpr detail::result_vec_t<A> max(A&& a, const B& b) {
+        using T = scalar_t<A>;
+        return cwise_binary(std::forward<A>(a), b, [](const T& x, const T& y) {
             return std::max(x, y);
         });
     }
 
-    template <typename T>
-    Vec<T> abs(Vec<T> v) {
-        std::transform(v.begin(), v.end(), v.begin(), [](T x) { return std::abs(x); });
-        return v;
+    template <VecLike V>
+    detail::result_vec_t<V> abs(V&& v) {
+        return detail::transform(detail::to_vec(std::forward<V>(v)), [](scalar_t<V> x) { return std::abs(x); });
     }
 
-    template <std::floating_point T>
-    Vec<T> floor(Vec<T> v) {
-        std::transform(v.begin(), v.end(), v.begin(), [](T x) { return std::floor(x); });
-        return v;
+    template <VecLike V>
+        requires std::floating_point<scalar_t<V>>
+    detail::result_vec_t<V> floor(V&& v) {
+        return detail::transform(detail::to_vec(std::forward<V>(v)), [](scalar_t<V> x) { return std::floor(x); });
     }
 
-    template <std::floating_point T>
-    Vec<T> ceil(Vec<T> v) {
-        std::transform(v.begin(), v.end(), v.begin(), [](T x) { return std::ceil(x); });
-        return v;
+    template <VecLike V>
+        requires std::floating_point<scalar_t<V>>
+    detail::result_vec_t<V> ceil(V&& v) {
+        return detail::transform(detail::to_vec(std::forward<V>(v)), [](scalar_t<V> x) { return std::ceil(x); });
     }
 
-    template <typename T>
-    Vec<T> clamp(Vec<T> v, const T& low, const T& high) {
-        std::transform(v.begin(), v.end(), v.begin(), [&](T x) {
+    template <VecLike V>
+    constexpr detail::result_vec_t<V> clamp(V&& v, const scalar_t<V>& low, const scalar_t<V>& high) {
+        return detail::transform(detail::to_vec(std::forward<V>(v)), [&](scalar_t<V> x) {
             return core::clamp(low, high, x);
         });
-        return v;
     }
 
-    template <typename T>
-    T sum(const Vec<T>& v) {
-        T sum = std::accumulate(v.begin(), v.end(), T{});
-        return sum;
+    template <VecLike V>
+    constexpr scalar_t<V> sum(const V& v) {
+        using T = scalar_t<V>;
+        if constexpr (detail::all_fixed<V>) {
+            return detail::unrolled_sum<T, V::static_size>([&](const core::index i) { return v[i]; });
+        } else {
+            const auto x = detail::cview(v);
+            if constexpr (kernels::has_simd<T>) {
+                if (x.contiguous()) return kernels::sum(x.data(), x.size());
+            }
+            T sum = std::accumulate(x.begin(), x.end(), T{});
+            return sum;
+        }
     }
 
-    template <typename T>
-    T minCoeff(const Vec<T>& v) {
-        T min = std::accumulate(v.begin(), v.end(), std::numeric_limits<T>::max(), [](T x, T y) {
-            return std::min(x, y);
-        });
-        return min;
+    template <VecLike V>
+    constexpr scalar_t<V> minCoeff(const V& v) {
+        using T = scalar_t<V>;
+        if constexpr (detail::all_fixed<V>) {
+            T min = std::numeric_limits<T>::max();
+            detail::unroll<V::static_size>([&](const core::index i) { min = std::min(min, v[i]); });
+            return min;
+        } else {
+            const auto x = detail::cview(v);
+            if constexpr (kernels::has_simd<T>) {
+                if (x.contiguous()) return kernels::min(x.data(), x.size());
+            }
+            T min = std::accumulate(x.begin(), x.end(), std::numeric_limits<T>::max(), [](T a, T b) {
+                return std::min(a, b);
+            });
+            return min;
+        }
     }
 
-    template <typename T>
-    T maxCoeff(const Vec<T>& v) {
-        T max = std::accumulate(v.begin(), v.end(), std::numeric_limits<T>::lowest(), [](T x, T y) {
-            return std::max(x, y);
-        });
-        return max;
+    template <VecLike V>
+    constexpr scalar_t<V> maxCoeff(const V& v) {
+        using T = scalar_t<V>;
+        if constexpr (detail::all_fixed<V>) {
+            T max = std::numeric_limits<T>::lowest();
+            detail::unroll<V::static_size>([&](const core::index i) { max = std::max(max, v[i]); });
+            return max;
+        } else {
+            const auto x = detail::cview(v);
+            if constexpr (kernels::has_simd<T>) {
+                if (x.contiguous()) return kernels::max(x.data(), x.size());
+            }
+            T max = std::accumulate(x.begin(), x.end(), std::numeric_limits<T>::lowest(), [](T a, T b) {
+                return std::max(a, b);
+            });
+            return max;
+        }
     }
 
     // argmin and argmax returns first min element event if not unique
-    template <typename T>
-    core::index argMin(const Vec<T>& v) {
+    template <VecLike V>
+    constexpr core::index argMin(const V& v) {
+        using T = scalar_t<V>;
+        if constexpr (kernels::has_simd<T> && !detail::all_fixed<V>) {
+            const auto x = detail::cview(v);
+            if (x.contiguous()) return kernels::argmin(x.data(), x.size());
+        }
         core::index idx = 0;
         T min = std::numeric_limits<T>::max();
         for (std::size_t i = 0; i < v.size(); ++i) {
@@ -238,8 +382,13 @@ namespace axiom::linalg {
         return idx;
     }
 
-    template <typename T>
-    core::index argMax(const Vec<T>& v) {
+    template <VecLike V>
+    constexpr core::index argMax(const V& v) {
+        using T = scalar_t<V>;
+        if constexpr (kernels::has_simd<T> && !detail::all_fixed<V>) {
+            const auto x = detail::cview(v);
+            if (x.contiguous()) return kernels::argmax(x.data(), x.size());
+        }
         core::index idx = 0;
         T max = std::numeric_limits<T>::lowest();
         for (std::size_t i = 0; i < v.size(); ++i) {
@@ -252,5 +401,380 @@ namespace axiom::linalg {
     }
 
 
+    // execution policy overloads, each chunk [lo, hi) runs the serial op on a segment
+    namespace detail {
+        template <typename P, typename V, typename F>
+        V transform(const P& policy, V v, F f) {
+            auto x = mview(v);
+            exec::parallel_for(policy, x.size(), [&](const core::index lo, const core::index hi) {
+                for (core::index i = lo; i < hi; ++i) x[i] = f(x[i]);
+            });
+            return v;
+        }
+    }
+
+    template <exec::ExecutionPolicy P, VecLike V>
+    scalar_t<V> sum(const P& policy, const V& v) {
+        using T = scalar_t<V>;
+        const auto x = detail::cview(v);
+        return exec::parallel_reduce(policy, x.size(), T{}, [&](const core::index lo, const core::index hi) {
+            return sum(x.segment(lo, hi - lo));
+        }, [](const T a, const T b) { return a + b; });
+    }
+
+    template <exec::ExecutionPolicy P, VecLike A, VecLike B>
+        requires SameScalar<A, B> && SameSize<A, B>
+    scalar_t<A> dot(const P& policy, const A& a, const B& b) {
+        using T = scalar_t<A>;
+        const auto x = detail::cview(a);
+        const auto y = detail::cview(b);
+        if (x.size() != y.size()) {
+            throw core::Error(core::ErrorCode::kShapeMismatch, "dot(): vectors must be of same size");
+        }
+        return exec::parallel_reduce(policy, x.size(), T{}, [&](const core::index lo, const core::index hi) {
+            return dot(x.segment(lo, hi - lo), y.segment(lo, hi - lo));
+        }, [](const T p, const T q) { return p + q; });
+    }
+
+    template <exec::ExecutionPolicy P, VecLike V>
+    [[nodiscard]] double norm(const P& policy, const V& v, const std::size_t order = 1) {
+        const auto x = detail::cview(v);
+        const auto add = [](const double a, const double b) { return a + b; };
+        switch (order) {
+            case 0:
+                return exec::parallel_reduce(policy, x.size(), 0.0, [&](const core::index lo, const core::index hi) {
+                    return static_cast<double>(x.segment(lo, hi - lo).infty_norm());
+                }, [](const double a, const double b) { return std::max(a, b); });
+            case 1:
+                return exec::parallel_reduce(policy, x.size(), 0.0, [&](const core::index lo, const core::index hi) {
+                    return static_cast<double>(x.segment(lo, hi - lo).l1_norm());
+                }, add);
+            case 2:
+                return std::sqrt(exec::parallel_reduce(policy, x.size(), 0.0,
+                    [&](const core::index lo, const core::index hi) { return len_squared(x.segment(lo, hi - lo)); },
+                    add));
+            default:
+                throw core::Error(core::ErrorCode::kInvalidArgument,
+                "norm(policy, vec, order): order must be between 0, 1, or 2");
+        }
+    }
+
+    template <exec::ExecutionPolicy P, VecLike V>
+    scalar_t<V> minCoeff(const P& policy, const V& v) {
+        using T = scalar_t<V>;
+        const auto x = detail::cview(v);
+        return exec::parallel_reduce(policy, x.size(), std::numeric_limits<T>::max(),
+            [&](const core::index lo, const core::index hi) { return minCoeff(x.segment(lo, hi - lo)); },
+            [](const T a, const T b) { return std::min(a, b); });
+    }
+
+    template <exec::ExecutionPolicy P, VecLike V>
+    scalar_t<V> maxCoeff(const P& policy, const V& v) {
+        using T = scalar_t<V>;
+        const auto x = detail::cview(v);
+        return exec::parallel_reduce(policy, x.size(), std::numeric_limits<T>::lowest(),
+            [&](const core::index lo, const core::index hi) { return maxCoeff(x.segment(lo, hi - lo)); },
+            [](const T a, const T b) { return std::max(a, b); });
+    }
+
+    template <exec::ExecutionPolicy P, VecLike V>
+    detail::result_vec_t<V> abs(const P& policy, V&& v) {
+        return detail::transform(policy, detail::to_vec(std::forward<V>(v)), [](scalar_t<V> x) { return std::abs(x); });
+    }
+
+    template <exec::ExecutionPolicy P, VecLike V>
+        requires std::floating_point<scalar_t<V>>
+    detail::result_vec_t<V> floor(const P& policy, V&& v) {
+        return detail::transform(policy, detail::to_vec(std::forward<V>(v)), [](scalar_t<V> x) { return std::floor(x); });
+    }
+
+    template <exec::ExecutionPolicy P, VecLike V>
+        requires std::floating_point<scalar_t<V>>
+    detail::result_vec_t<V> ceil(const P& policy, V&& v) {
+        return detail::transform(policy, detail::to_vec(std::forward<V>(v)), [](scalar_t<V> x) { return std::ceil(x); });
+    }
+
+    template <exec::ExecutionPolicy P, VecLike V>
+    detail::result_vec_t<V> clamp(const P& policy, V&& v, const scalar_t<V>& low, const scalar_t<V>& high) {
+        return detail::transform(policy, detail::to_vec(std::forward<V>(v)), [&](scalar_t<V> x) {
+            return core::clamp(low, high, x);
+        });
+    }
+
+    template <exec::ExecutionPolicy P, VecLike A, VecLike B, typename Op>
+        requires SameScalar<A, B> && SameSize<A, B>
+    detail::result_vec_t<A> cwise_binary(const P& policy, A&& a, const B& b, Op op) {
+        detail::result_vec_t<A> out = detail::to_vec(std::forward<A>(a));
+        if (out.size() != b.size()) {
+            throw core::Error(core::ErrorCode::kShapeMismatch, "cwise_binary(): vectors should be of same length");
+        }
+        exec::parallel_for(policy, out.size(), [&](const core::index lo, const core::index hi) {
+            for (core::index i = lo; i < hi; ++i) out[i] = op(out[i], b[i]);
+        });
+        return out;
+    }
+
+    template <exec::ExecutionPolicy P, VecLike A, VecLike B>
+        requires SameScalar<A, B> && SameSize<A, B>
+    detail::result_vec_t<A> min(const P& policy, A&& a, const B& b) {
+        using T = scalar_t<A>;
+        return cwise_binary(policy, std::forward<A>(a), b, [](const T& x, const T& y) { return std::min(x, y); });
+    }
+
+    template <exec::ExecutionPolicy P, VecLike A, VecLike B>
+        requires SameScalar<A, B> && SameSize<A, B>
+    detail::result_vec_t<A> max(const P& policy, A&& a, const B& b) {
+        using T = scalar_t<A>;
+        return cwise_binary(policy, std::forward<A>(a), b, [](const T& x, const T& y) { return std::max(x, y); });
+    }
+
+    // C = alpha * A * B + beta * C, a parallel policy splits the product into slabs of C
+    // any operand may be a strided view (a block, a transposed layout, ...), fixed-size operands
+    // are multiplied with a fully unrolled loop
+    template <exec::ExecutionPolicy P, MatLike MA, MatLike MB, WritableMat MC>
+        requires SameScalar<MA, MB> && SameScalar<MA, MC> &&
+                 detail::gemm_shapes<std::remove_cvref_t<MA>, std::remove_cvref_t<MB>, std::remove_cvref_t<MC>>
+    constexpr void gemm(const P& policy, const scalar_t<MA> alpha, const MA& A, const MB& B, const scalar_t<MA> beta,
+                        MC&& C) {
+        using T = scalar_t<MA>;
+        if constexpr (detail::all_fixed<MA, MB, MC>) {
+            constexpr core::index m = MA::static_rows, k = MA::static_cols, n = MB::static_cols;
+            if (static_cast<const void*>(&C) == &A || static_cast<const void*>(&C) == &B) {
+                throw core::Error(core::ErrorCode::kInvalidArgument,
+                    "gemm(): C must not alias A or B");
+            }
+            detail::unroll<m * n>([&](const core::index idx) {
+                const core::index i = idx / n, j = idx % n;
+                const T s = detail::unrolled_sum<T, k>([&](const core::index p) { return A(i, p) * B(p, j); });
+                C(i, j) = beta == T{} ? alpha * s : alpha * s + beta * C(i, j);
+            });
+        } else {
+            const auto a = detail::cview(A);
+            const auto b = detail::cview(B);
+            auto c = detail::mview(C);
+            const core::index m = a.rows(), k = a.cols(), n = b.cols();
+            if (b.rows() != k || c.rows() != m || c.cols() != n) {
+                throw core::Error(core::ErrorCode::kShapeMismatch,
+                    "gemm(): A (m x k), B (k x n) and C (m x n) shapes do not agree");
+            }
+            if (detail::overlaps(c, a) || detail::overlaps(c, b)) {
+                throw core::Error(core::ErrorCode::kInvalidArgument,
+                    "gemm(): C must not alias A or B");
+            }
+            if constexpr (kernels::has_simd<T>) {
+                kernels::gemm(m, n, k, alpha, a.data(), a.row_stride(), a.col_stride(),
+                              b.data(), b.row_stride(), b.col_stride(),
+                              beta, c.data(), c.row_stride(), c.col_stride(), exec::concurrency(policy, m * n * k));
+            } else {
+                if (beta == T{}) c.fill(T{});
+                else c *= beta;
+                for (core::index i = 0; i < m; ++i) {
+                    for (core::index p = 0; p < k; ++p) {
+                        const T aip = alpha * a(i, p);
+                        for (core::index j = 0; j < n; ++j) c(i, j) += aip * b(p, j);
+                    }
+                }
+            }
+        }
+    }
+
+    template <exec::ExecutionPolicy P, MatLike MA, MatLike MB>
+        requires SameScalar<MA, MB> && (detail::sizes_agree(MA::static_cols, MB::static_rows))
+    constexpr detail::result_mat_t<MA, MB> matmul(const P& policy, const MA& A, const MB& B) {
+        using T = scalar_t<MA>;
+        if constexpr (detail::all_fixed<MA, MB>) {
+            detail::result_mat_t<MA, MB> C;
+            gemm(policy, T{1}, A, B, T{}, C);
+            return C;
+        } else {
+            Mat<T> C(A.rows(), B.cols());
+            gemm(policy, T{1}, A, B, T{}, C);
+            return C;
+        }
+    }
+
+    // thread-count forms, threads > 1 (0 = all threads of the pool) splits any product worth it
+    template <MatLike MA, MatLike MB, WritableMat MC>
+        requires SameScalar<MA, MB> && SameScalar<MA, MC> &&
+                 detail::gemm_shapes<std::remove_cvref_t<MA>, std::remove_cvref_t<MB>, std::remove_cvref_t<MC>>
+    constexpr void gemm(const scalar_t<MA> alpha, const MA& A, const MB& B, const scalar_t<MA> beta, MC&& C,
+                        const core::index threads = 1) {
+        gemm(exec::on_threads(threads), alpha, A, B, beta, std::forward<MC>(C));
+    }
+
+    template <MatLike MA, MatLike MB>
+        requires SameScalar<MA, MB> && (detail::sizes_agree(MA::static_cols, MB::static_rows))
+    constexpr detail::result_mat_t<MA, MB> matmul(const MA& A, const MB& B, const core::index threads = 1) {
+        return matmul(exec::on_threads(threads), A, B);
+    }
+
+    namespace detail {
+        template <typename T>
+        void check_gemv(const MatView<const T>& a, const VecView<const T>& x, const VecView<T>& y,
+                        const core::index x_len, const core::index y_len, const char* msg) {
+            if (x.size() != x_len || y.size() != y_len) {
+                throw core::Error(core::ErrorCode::kShapeMismatch, msg);
+            }
+            if (overlaps(y, x) || overlaps(y, a)) {
+                throw core::Error(core::ErrorCode::kInvalidArgument, "gemv(): y must not alias x or A");
+            }
+        }
+
+        template <typename MA, typename VX, typename VY, bool Trans>
+        concept gemv_shapes = sizes_agree(Trans ? MA::static_rows : MA::static_cols, VX::static_size) &&
+                              sizes_agree(Trans ? MA::static_cols : MA::static_rows, VY::static_size);
+
+        template <typename MA, typename VX, bool Trans>
+        using matvec_result_t = std::conditional_t<all_fixed<MA, VX>,
+            Vec<scalar_t<MA>, (all_fixed<MA> ? (Trans ? std::remove_cvref_t<MA>::static_cols
+                                                      : std::remove_cvref_t<MA>::static_rows) : core::dynamic)>,
+            Vec<scalar_t<MA>>>;
+    }
+
+    // y = alpha * A x + beta * y, A is m x n, x has n and y m elements
+    // row-major and column-major (e.g. transposed) views of A run on the SIMD kernels when
+    // x and y are contiguous, other layouts take the generic loop
+    template <exec::ExecutionPolicy P, MatLike MA, VecLike VX, WritableVec VY>
+        requires SameScalar<MA, VX> && SameScalar<MA, VY> &&
+                 detail::gemv_shapes<std::remove_cvref_t<MA>, std::remove_cvref_t<VX>, std::remove_cvref_t<VY>, false>
+    constexpr void gemv(const P& policy, const scalar_t<MA> alpha, const MA& A, const VX& x, const scalar_t<MA> beta,
+                        VY&& y) {
+        using T = scalar_t<MA>;
+        if constexpr (detail::all_fixed<MA, VX, VY>) {
+            constexpr core::index m = MA::static_rows, n = MA::static_cols;
+            if (static_cast<const void*>(&y) == &x) {
+                throw core::Error(core::ErrorCode::kInvalidArgument, "gemv(): y must not alias x or A");
+            }
+            detail::unroll<m>([&](const core::index i) {
+                const T s = detail::unrolled_sum<T, n>([&](const core::index j) { return A(i, j) * x[j]; });
+                y[i] = beta == T{} ? alpha * s : alpha * s + beta * y[i];
+            });
+        } else {
+            const auto a = detail::cview(A);
+            const auto xv = detail::cview(x);
+            auto yv = detail::mview(y);
+            const core::index m = a.rows(), n = a.cols();
+            detail::check_gemv(a, xv, yv, n, m, "gemv(): x must have A.cols() and y A.rows() elements");
+            if constexpr (kernels::has_simd<T>) {
+                if (xv.contiguous() && yv.contiguous()) {
+                    const core::index threads = exec::concurrency(policy, m * n);
+                    if (a.col_stride() == 1) {
+                        return kernels::gemv(m, n, alpha, a.data(), a.row_stride(), xv.data(), beta, yv.data(), threads);
+                    }
+                    if (a.row_stride() == 1) {
+                        return kernels::gemv_t(n, m, alpha, a.data(), a.col_stride(), xv.data(), beta, yv.data(), threads);
+                    }
+                }
+            }
+            for (core::index i = 0; i < m; ++i) {
+                T s{};
+                for (core::index j = 0; j < n; ++j) s += a(i, j) * xv[j];
+                yv[i] = beta == T{} ? alpha * s : alpha * s + beta * yv[i];
+            }
+        }
+    }
+
+    // y = alpha * A^T x + beta * y without forming A^T, x has m and y n elements
+    template <exec::ExecutionPolicy P, MatLike MA, VecLike VX, WritableVec VY>
+        requires SameScalar<MA, VX> && SameScalar<MA, VY> &&
+                 detail::gemv_shapes<std::remove_cvref_t<MA>, std::remove_cvref_t<VX>, std::remove_cvref_t<VY>, true>
+    constexpr void gemv_t(const P& policy, const scalar_t<MA> alpha, const MA& A, const VX& x, const scalar_t<MA> beta,
+                          VY&& y) {
+        using T = scalar_t<MA>;
+        if constexpr (detail::all_fixed<MA, VX, VY>) {
+            constexpr core::index m = MA::static_rows, n = MA::static_cols;
+            if (static_cast<const void*>(&y) == &x) {
+                throw core::Error(core::ErrorCode::kInvalidArgument, "gemv(): y must not alias x or A");
+            }
+            detail::unroll<n>([&](const core::index j) {
+                const T s = detail::unrolled_sum<T, m>([&](const core::index i) { return A(i, j) * x[i]; });
+                y[j] = beta == T{} ? alpha * s : alpha * s + beta * y[j];
+            });
+        } else {
+            const auto a = detail::cview(A);
+            const auto xv = detail::cview(x);
+            auto yv = detail::mview(y);
+            const core::index m = a.rows(), n = a.cols();
+            detail::check_gemv(a, xv, yv, m, n, "gemv_t(): x must have A.rows() and y A.cols() elements");
+            if constexpr (kernels::has_simd<T>) {
+                if (xv.contiguous() && yv.contiguous()) {
+                    const core::index threads = exec::concurrency(policy, m * n);
+                    if (a.col_stride() == 1) {
+                        return kernels::gemv_t(m, n, alpha, a.data(), a.row_stride(), xv.data(), beta, yv.data(), threads);
+                    }
+                    if (a.row_stride() == 1) {
+                        return kernels::gemv(n, m, alpha, a.data(), a.col_stride(), xv.data(), beta, yv.data(), threads);
+                    }
+                }
+            }
+            if (beta == T{}) yv.fill(T{});
+            else yv *= beta;
+            for (core::index i = 0; i < m; ++i) {
+                const T xi = alpha * xv[i];
+                for (core::index j = 0; j < n; ++j) yv[j] += xi * a(i, j);
+            }
+        }
+    }
+
+    template <exec::ExecutionPolicy P, MatLike MA, VecLike VX>
+        requires SameScalar<MA, VX> && (detail::sizes_agree(MA::static_cols, VX::static_size))
+    constexpr detail::matvec_result_t<MA, VX, false> matvec(const P& policy, const MA& A, const VX& x) {
+        using T = scalar_t<MA>;
+        if constexpr (detail::all_fixed<MA, VX>) {
+            detail::matvec_result_t<MA, VX, false> y;
+            gemv(policy, T{1}, A, x, T{}, y);
+            return y;
+        } else {
+            Vec<T> y(A.rows());
+            gemv(policy, T{1}, A, x, T{}, y);
+            return y;
+        }
+    }
+
+    template <exec::ExecutionPolicy P, MatLike MA, VecLike VX>
+        requires SameScalar<MA, VX> && (detail::sizes_agree(MA::static_rows, VX::static_size))
+    constexpr detail::matvec_result_t<MA, VX, true> matvec_t(const P& policy, const MA& A, const VX& x) {
+        using T = scalar_t<MA>;
+        if constexpr (detail::all_fixed<MA, VX>) {
+            detail::matvec_result_t<MA, VX, true> y;
+            gemv_t(policy, T{1}, A, x, T{}, y);
+            return y;
+        } else {
+            Vec<T> y(A.cols());
+            gemv_t(policy, T{1}, A, x, T{}, y);
+            return y;
+        }
+    }
+
+    // thread-count forms, threads > 1 (0 = all threads of the pool) splits any product worth it
+    template <MatLike MA, VecLike VX, WritableVec VY>
+        requires SameScalar<MA, VX> && SameScalar<MA, VY> &&
+                 detail::gemv_shapes<std::remove_cvref_t<MA>, std::remove_cvref_t<VX>, std::remove_cvref_t<VY>, false>
+    constexpr void gemv(const scalar_t<MA> alpha, const MA& A, const VX& x, const scalar_t<MA> beta, VY&& y,
+                        const core::index threads = 1) {
+        gemv(exec::on_threads(threads), alpha, A, x, beta, std::forward<VY>(y));
+    }
+
+    template <MatLike MA, VecLike VX, WritableVec VY>
+        requires SameScalar<MA, VX> && SameScalar<MA, VY> &&
+                 detail::gemv_shapes<std::remove_cvref_t<MA>, std::remove_cvref_t<VX>, std::remove_cvref_t<VY>, true>
+    constexpr void gemv_t(const scalar_t<MA> alpha, const MA& A, const VX& x, const scalar_t<MA> beta, VY&& y,
+                          const core::index threads = 1) {
+        gemv_t(exec::on_threads(threads), alpha, A, x, beta, std::forward<VY>(y));
+    }
+
+    template <MatLike MA, VecLike VX>
+        requires SameScalar<MA, VX> && (detail::sizes_agree(MA::static_cols, VX::static_size))
+    constexpr detail::matvec_result_t<MA, VX, false> matvec(const MA& A, const VX& x, const core::index threads = 1) {
+        return matvec(exec::on_threads(threads), A, x);
+    }
+
+    template <MatLike MA, VecLike VX>
+        requires SameScalar<MA, VX> && (detail::sizes_agree(MA::static_rows, VX::static_size))
+    constexpr detail::matvec_result_t<MA, VX, true> matvec_t(const MA& A, const VX& x, const core::index threads = 1) {
+        return matvec_t(exec::on_threads(threads), A, x);
+    }
+
+
 }
 #endif //AXIOM_OPS_HPP
\ No newline at end of file
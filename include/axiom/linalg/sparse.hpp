@@ -0,0 +1,506 @@
+#ifndef AXIOM_SPARSE_HPP
+#define AXIOM_SPARSE_HPP
+
+#include <algorithm>
+#include <concepts>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "axiom/core/core.hpp"
+#include "axiom/core/memory.hpp"
+#include "axiom/core/profile.hpp"
+#include "axiom/exec/exec.hpp"
+#include "axiom/linalg/mat.hpp"
+#include "axiom/linalg/ops.hpp"
+#include "axiom/linalg/vec.hpp"
+#include "axiom/linalg/view.hpp"
+
+namespace axiom::linalg {
+/*
+ * compressed sparse matrices:
+ * - CsrMat<T> stores rows (row_ptr / col_idx / values, columns sorted within a row), CscMat<T>
+ *   stores columns the same way and is kept as the CSR form of its transpose
+ * - from_triplets() is linear in nnz: two stable counting sorts (by column, then by row) put the
+ *   entries in order, duplicates are summed, no comparison sort is involved
+ * - gemv / gemv_t / matvec / matvec_t / gemm / matmul overloads mirror the dense ones in ops.hpp,
+ *   y and C are existing outputs, any dense vector / matrix or view works as an operand
+ * - every product takes an execution policy first (exec::seq, exec::par, min_size counts
+ *   nonzeros), the forms ending in `threads` map to exec::on_threads(threads)
+ * - parallel gathers (CSR A x, CSC A^T x) split rows with balanced nnz, scatters (CSR A^T x,
+ *   CSC A x) accumulate into per-thread buffers from the arena and are summed in a fixed order,
+ *   products with a dense matrix split its columns instead
+ */
+
+    template <typename T>
+    struct Triplet {
+        core::index row;
+        core::index col;
+        T value;
+    };
+
+    template <typename T>
+    class CsrMat;
+
+    template <typename T>
+    class CscMat;
+
+    namespace detail {
+        // first row of each of `parts` ranges holding about the same number of nonzeros
+        inline std::vector<core::index> balanced_rows(std::span<const core::index> row_ptr, const core::index parts) {
+            const core::index rows = row_ptr.size() - 1;
+            const core::index nnz = row_ptr.back();
+            std::vector<core::index> bounds(parts + 1, rows);
+            bounds[0] = 0;
+            for (core::index p = 1; p < parts; ++p) {
+                const core::index target = nnz * p / parts;
+                const auto it = std::lower_bound(row_ptr.begin(), row_ptr.end(), target);
+                bounds[p] = std::max(bounds[p - 1], static_cast<core::index>(it - row_ptr.begin()));
+            }
+            return bounds;
+        }
+
+        // below this many nonzeros (times dense columns for gemm) a part is not worth a thread
+        inline constexpr core::index kSpmvUnit = 4096;
+        inline constexpr core::index kSpmmUnit = 65536;
+    }
+
+    template <typename T>
+    class CsrMat {
+    public:
+        using value_type = T;
+
+        CsrMat(const core::index rows, const core::index cols)
+            : rows_(rows), cols_(cols), row_ptr_(rows + 1, 0) {}
+
+        // rows x cols matrix from (row, col, value) entries in any order, duplicates are summed
+        static CsrMat from_triplets(const core::index rows, const core::index cols,
+                                    std::span<const Triplet<T>> entries) {
+            for (const auto& e : entries) {
+                if (e.row >= rows || e.col >= cols) {
+                    throw core::Error(core::ErrorCode::kOutOfBounds,
+                        "CsrMat::from_triplets(): entry outside of the matrix");
+                }
+            }
+            const core::index nnz = entries.size();
+
+            // counting sort by column, then a stable counting sort by row
+            std::vector<core::index> count(std::max(rows, cols) + 1, 0);
+            for (const auto& e : entries) ++count[e.col + 1];
+            for (core::index c = 0; c < cols; ++c) count[c + 1] += count[c];
+            std::vector<core::index> by_col(nnz);
+            for (core::index k = 0; k < nnz; ++k) by_col[count[entries[k].col]++] = k;
+
+            CsrMat m(rows, cols);
+            for (const auto& e : entries) ++m.row_ptr_[e.row + 1];
+            for (core::index r = 0; r < rows; ++r) m.row_ptr_[r + 1] += m.row_ptr_[r];
+            std::copy(m.row_ptr_.begin(), m.row_ptr_.end() - 1, count.begin());
+            m.col_idx_.resize(nnz);
+            m.values_.resize(nnz);
+            for (const core::index k : by_col) {
+                const core::index pos = count[entries[k].row]++;
+                m.col_idx_[pos] = entries[k].col;
+                m.values_[pos] = entries[k].value;
+            }
+            m.sum_duplicates();
+            return m;
+        }
+
+        static CsrMat from_triplets(const core::index rows, const core::index cols,
+                                    const std::vector<Triplet<T>>& entries) {
+            return from_triplets(rows, cols, std::span<const Triplet<T>>(entries));
+        }
+
+        // nonzeros of a dense matrix or view
+        template <MatLike M>
+            requires std::same_as<scalar_t<M>, T>
+        static CsrMat from_dense(const M& A) {
+            const auto a = detail::cview(A);
+            CsrMat m(a.rows(), a.cols());
+            for (core::index r = 0; r < a.rows(); ++r) {
+                for (core::index c = 0; c < a.cols(); ++c) {
+                    if (a(r, c) == T{}) continue;
+                    m.col_idx_.push_back(c);
+                    m.values_.push_back(a(r, c));
+                }
+                m.row_ptr_[r + 1] = m.values_.size();
+            }
+            return m;
+        }
+
+        [[nodiscard]] core::index rows() const noexcept { return rows_; }
+        [[nodiscard]] core::index cols() const noexcept { return cols_; }
+        [[nodiscard]] core::index nnz() const noexcept { return values_.size(); }
+
+        [[nodiscard]] std::span<const core::index> row_ptr() const noexcept { return row_ptr_; }
+        [[nodiscard]] std::span<const core::index> col_idx() const noexcept { return col_idx_; }
+        [[nodiscard]] std::span<const T> values() const noexcept { return values_; }
+        [[nodiscard]] std::span<T> values() noexcept { return values_; }
+
+        // element (row, col), zero if it is not stored, O(log nnz(row))
+        T operator()(const core::index row, const core::index col) const {
+            if (row >= rows_ || col >= cols_) {
+                throw core::Error(core::ErrorCode::kOutOfBounds, "CsrMat(row, col): index out of range");
+            }
+            const auto first = col_idx_.begin() + row_ptr_[row];
+            const auto last = col_idx_.begin() + row_ptr_[row + 1];
+            const auto it = std::lower_bound(first, last, col);
+            return it != last && *it == col ? values_[it - col_idx_.begin()] : T{};
+        }
+
+        CsrMat& operator*=(const T& s) {
+            for (auto& v : values_) v *= s;
+            return *this;
+        }
+
+        [[nodiscard]] Mat<T> to_dense() const {
+            Mat<T> D(rows_, cols_);
+            for (core::index r = 0; r < rows_; ++r) {
+                for (core::index k = row_ptr_[r]; k < row_ptr_[r + 1]; ++k) D(r, col_idx_[k]) = values_[k];
+            }
+            return D;
+        }
+
+        // A^T in CSR form, a counting sort over the columns, O(nnz + cols)
+        [[nodiscard]] CsrMat transpose() const {
+            CsrMat t(cols_, rows_);
+            for (const core::index c : col_idx_) ++t.row_ptr_[c + 1];
+            for (core::index c = 0; c < cols_; ++c) t.row_ptr_[c + 1] += t.row_ptr_[c];
+            std::vector<core::index> next(t.row_ptr_.begin(), t.row_ptr_.end() - 1);
+            t.col_idx_.resize(nnz());
+            t.values_.resize(nnz());
+            for (core::index r = 0; r < rows_; ++r) {
+                for (core::index k = row_ptr_[r]; k < row_ptr_[r + 1]; ++k) {
+                    const core::index pos = next[col_idx_[k]]++;
+                    t.col_idx_[pos] = r;
+                    t.values_[pos] = values_[k];
+                }
+            }
+            return t;
+        }
+
+        [[nodiscard]] CscMat<T> to_csc() const { return CscMat<T>(transpose()); }
+
+    private:
+        core::index rows_;
+        core::index cols_;
+        std::vector<core::index> row_ptr_;
+        std::vector<core::index> col_idx_;
+        core::aligned_vector<T> values_;
+
+        // entries are sorted within each row, equal neighbours are merged in place
+        void sum_duplicates() {
+            core::index out = 0, start = 0;
+            for (core::index r = 0; r < rows_; ++r) {
+                const core::index end = row_ptr_[r + 1];
+                for (core::index k = start; k < end; ++k) {
+                    if (out > row_ptr_[r] && col_idx_[out - 1] == col_idx_[k]) {
+                        values_[out - 1] += values_[k];
+                    } else {
+                        col_idx_[out] = col_idx_[k];
+                        values_[out] = values_[k];
+                        ++out;
+                    }
+                }
+                start = end;
+                row_ptr_[r + 1] = out;
+            }
+            col_idx_.resize(out);
+            values_.resize(out);
+        }
+    };
+
+    template <typename T>
+    class CscMat {
+    public:
+        using value_type = T;
+
+        CscMat(const core::index rows, const core::index cols) : t_(cols, rows) {}
+
+        // takes the CSR form of A^T, the layout of a CSC A
+        explicit CscMat(CsrMat<T> transposed) : t_(std::move(transposed)) {}
+
+        static CscMat from_triplets(const core::index rows, const core::index cols,
+                                    std::span<const Triplet<T>> entries) {
+            std::vector<Triplet<T>> swapped(entries.begin(), entries.end());
+            for (auto& e : swapped) std::swap(e.row, e.col);
+            return CscMat(CsrMat<T>::from_triplets(cols, rows, swapped));
+        }
+
+        static CscMat from_triplets(const core::index rows, const core::index cols,
+                                    const std::vector<Triplet<T>>& entries) {
+            return from_triplets(rows, cols, std::span<const Triplet<T>>(entries));
+        }
+
+        template <MatLike M>
+            requires std::same_as<scalar_t<M>, T>
+        static CscMat from_dense(const M& A) {
+            const auto a = detail::cview(A);
+            return CscMat(CsrMat<T>::from_dense(MatView<const T>(a.data(), a.cols(), a.rows(),
+                                                                 a.col_stride(), a.row_stride())));
+        }
+
+        [[nodiscard]] core::index rows() const noexcept { return t_.cols(); }
+        [[nodiscard]] core::index cols() const noexcept { return t_.rows(); }
+        [[nodiscard]] core::index nnz() const noexcept { return t_.nnz(); }
+
+        [[nodiscard]] std::span<const core::index> col_ptr() const noexcept { return t_.row_ptr(); }
+        [[nodiscard]] std::span<const core::index> row_idx() const noexcept { return t_.col_idx(); }
+        [[nodiscard]] std::span<const T> values() const noexcept { return t_.values(); }
+        [[nodiscard]] std::span<T> values() noexcept { return t_.values(); }
+
+        T operator()(const core::index row, const core::index col) const { return t_(col, row); }
+
+        CscMat& operator*=(const T& s) {
+            t_ *= s;
+            return *this;
+        }
+
+        [[nodiscard]] Mat<T> to_dense() const { return t_.transpose().to_dense(); }
+
+        // A^T as CSR shares this layout exactly
+        [[nodiscard]] const CsrMat<T>& transposed() const noexcept { return t_; }
+        [[nodiscard]] CsrMat<T> to_csr() const { return t_.transpose(); }
+
+    private:
+        CsrMat<T> t_;
+    };
+
+    namespace detail {
+        // y = alpha * S x + beta * y, gathering along the rows of S
+        template <exec::ExecutionPolicy P, typename T, typename VX, typename VY>
+        void csr_gather(const P& policy, const T alpha, const CsrMat<T>& S, const VX& x, const T beta, VY& y) {
+            AXIOM_PROFILE_KERNEL("sparse::gemv", 2 * S.nnz(),
+                                 (sizeof(T) + sizeof(core::index)) * S.nnz() + sizeof(T) * (S.rows() + S.cols()));
+            const auto ptr = S.row_ptr();
+            const auto idx = S.col_idx();
+            const auto val = S.values();
+            const core::index parts = exec::concurrency(exec::in_units(policy, kSpmvUnit), S.nnz() / kSpmvUnit + 1);
+            const auto bounds = balanced_rows(ptr, parts);
+            exec::parallel_for(exec::on_threads(parts), parts, [&](const core::index lo, const core::index hi) {
+                for (core::index r = bounds[lo]; r < bounds[hi]; ++r) {
+                    T s{};
+                    for (core::index k = ptr[r]; k < ptr[r + 1]; ++k) s += val[k] * x[idx[k]];
+                    y[r] = beta == T{} ? alpha * s : alpha * s + beta * y[r];
+                }
+            });
+        }
+
+        // y = alpha * S^T x + beta * y, scattering the rows of S into y
+        template <exec::ExecutionPolicy P, typename T, typename VX, typename VY>
+        void csr_scatter(const P& policy, const T alpha, const CsrMat<T>& S, const VX& x, const T beta, VY& y) {
+            AXIOM_PROFILE_KERNEL("sparse::gemv_t", 2 * S.nnz(),
+                                 (sizeof(T) + sizeof(core::index)) * S.nnz() + sizeof(T) * (S.rows() + S.cols()));
+            const auto ptr = S.row_ptr();
+            const auto idx = S.col_idx();
+            const auto val = S.values();
+            const core::index n = S.cols();
+            if (beta == T{}) y.fill(T{});
+            else if (beta != T{1}) y *= beta;
+
+            const core::index parts = exec::concurrency(exec::in_units(policy, kSpmvUnit), S.nnz() / kSpmvUnit + 1);
+            const auto bounds = balanced_rows(ptr, parts);
+            const auto scatter = [&](const core::index p, auto&& out) {
+                for (core::index r = bounds[p]; r < bounds[p + 1]; ++r) {
+                    const T xr = alpha * x[r];
+                    if (xr == T{}) continue;
+                    for (core::index k = ptr[r]; k < ptr[r + 1]; ++k) out[idx[k]] += val[k] * xr;
+                }
+            };
+            if (parts == 1) return scatter(0, y);
+
+            // one private buffer per extra part, summed into y in part order
+            const core::ArenaScope scope;
+            core::aligned_vector<T> partial((parts - 1) * n, T{});
+            exec::parallel_for(exec::on_threads(parts), parts, [&](const core::index lo, const core::index hi) {
+                for (core::index p = lo; p < hi; ++p) {
+                    if (p == 0) scatter(0, y);
+                    else scatter(p, partial.data() + (p - 1) * n);
+                }
+            });
+            for (core::index p = 1; p < parts; ++p) {
+                const T* part = partial.data() + (p - 1) * n;
+                for (core::index j = 0; j < n; ++j) y[j] += part[j];
+            }
+        }
+
+        template <typename X, typename Y>
+        void check_spmv(const X& x, const Y& y, const core::index x_len, const core::index y_len, const char* msg,
+                        const char* alias_msg) {
+            if (x.size() != x_len || y.size() != y_len) {
+                throw core::Error(core::ErrorCode::kShapeMismatch, msg);
+            }
+            // y is scaled by beta and scattered into before x is fully read
+            if (overlaps(y, x)) throw core::Error(core::ErrorCode::kInvalidArgument, alias_msg);
+        }
+
+        // C = alpha * S B + beta * C with S CSR (gather rows) or S^T (transposed = true, scatter rows),
+        // the columns of B and C are split across threads so no two threads write the same element
+        template <exec::ExecutionPolicy P, typename T, typename MB, typename MC>
+        void csr_gemm(const P& policy, const T alpha, const CsrMat<T>& S, const bool transposed, const MB& b,
+                      const T beta, MC& c) {
+            AXIOM_PROFILE_KERNEL("sparse::gemm", 2 * S.nnz() * c.cols(),
+                                 (sizeof(T) + sizeof(core::index)) * S.nnz() + sizeof(T) * (b.rows() * b.cols() + 2 * c.rows() * c.cols()));
+            const auto ptr = S.row_ptr();
+            const auto idx = S.col_idx();
+            const auto val = S.values();
+            const core::index n = c.cols();
+            const core::index parts = std::min(n, exec::concurrency(exec::in_units(policy, kSpmmUnit),
+                                                                    S.nnz() * n / kSpmmUnit + 1));
+            exec::parallel_for(exec::on_threads(parts), parts, [&](const core::index lo, const core::index hi) {
+                const core::index j0 = n * lo / parts, j1 = n * hi / parts;
+                auto cp = c.block(0, j0, c.rows(), j1 - j0);
+                if (beta == T{}) cp.fill(T{});
+                else if (beta != T{1}) cp *= beta;
+                for (core::index r = 0; r < S.rows(); ++r) {
+                    for (core::index k = ptr[r]; k < ptr[r + 1]; ++k) {
+                        const T v = alpha * val[k];
+                        const core::index src = transposed ? r : idx[k];
+                        const core::index dst = transposed ? idx[k] : r;
+                        for (core::index j = j0; j < j1; ++j) c(dst, j) += v * b(src, j);
+                    }
+                }
+            });
+        }
+
+        template <typename MB, typename MC>
+        void check_spmm(const core::index m, const core::index k, const MB& b, const MC& c, const char* msg) {
+            if (b.rows() != k || c.rows() != m || c.cols() != b.cols()) {
+                throw core::Error(core::ErrorCode::kShapeMismatch, msg);
+            }
+        }
+    }
+
+    // y = alpha * A x + beta * y
+    template <exec::ExecutionPolicy P, typename T, VecLike VX, WritableVec VY>
+        requires std::same_as<scalar_t<VX>, T> && std::same_as<scalar_t<VY>, T>
+    void gemv(const P& policy, const T alpha, const CsrMat<T>& A, const VX& x, const T beta, VY&& y) {
+        const auto xv = detail::cview(x);
+        auto yv = detail::mview(y);
+        detail::check_spmv(xv, yv, A.cols(), A.rows(), "gemv(): x must have A.cols() and y A.rows() elements",
+                           "gemv(): y must not alias x");
+        detail::csr_gather(policy, alpha, A, xv, beta, yv);
+    }
+
+    template <exec::ExecutionPolicy P, typename T, VecLike VX, WritableVec VY>
+        requires std::same_as<scalar_t<VX>, T> && std::same_as<scalar_t<VY>, T>
+    void gemv(const P& policy, const T alpha, const CscMat<T>& A, const VX& x, const T beta, VY&& y) {
+        const auto xv = detail::cview(x);
+        auto yv = detail::mview(y);
+        detail::check_spmv(xv, yv, A.cols(), A.rows(), "gemv(): x must have A.cols() and y A.rows() elements",
+                           "gemv(): y must not alias x");
+        detail::csr_scatter(policy, alpha, A.transposed(), xv, beta, yv);
+    }
+
+    // y = alpha * A^T x + beta * y without forming A^T
+    template <exec::ExecutionPolicy P, typename T, VecLike VX, WritableVec VY>
+        requires std::same_as<scalar_t<VX>, T> && std::same_as<scalar_t<VY>, T>
+    void gemv_t(const P& policy, const T alpha, const CsrMat<T>& A, const VX& x, const T beta, VY&& y) {
+        const auto xv = detail::cview(x);
+        auto yv = detail::mview(y);
+        detail::check_spmv(xv, yv, A.rows(), A.cols(), "gemv_t(): x must have A.rows() and y A.cols() elements",
+                           "gemv_t(): y must not alias x");
+        detail::csr_scatter(policy, alpha, A, xv, beta, yv);
+    }
+
+    template <exec::ExecutionPolicy P, typename T, VecLike VX, WritableVec VY>
+        requires std::same_as<scalar_t<VX>, T> && std::same_as<scalar_t<VY>, T>
+    void gemv_t(const P& policy, const T alpha, const CscMat<T>& A, const VX& x, const T beta, VY&& y) {
+        const auto xv = detail::cview(x);
+        auto yv = detail::mview(y);
+        detail::check_spmv(xv, yv, A.rows(), A.cols(), "gemv_t(): x must have A.rows() and y A.cols() elements",
+                           "gemv_t(): y must not alias x");
+        detail::csr_gather(policy, alpha, A.transposed(), xv, beta, yv);
+    }
+
+    template <exec::ExecutionPolicy P, typename S, VecLike VX>
+        requires (std::same_as<S, CsrMat<scalar_t<VX>>> || std::same_as<S, CscMat<scalar_t<VX>>>)
+    Vec<scalar_t<VX>> matvec(const P& policy, const S& A, const VX& x) {
+        using T = scalar_t<VX>;
+        Vec<T> y(A.rows());
+        gemv(policy, T{1}, A, x, T{}, y);
+        return y;
+    }
+
+    template <exec::ExecutionPolicy P, typename S, VecLike VX>
+        requires (std::same_as<S, CsrMat<scalar_t<VX>>> || std::same_as<S, CscMat<scalar_t<VX>>>)
+    Vec<scalar_t<VX>> matvec_t(const P& policy, const S& A, const VX& x) {
+        using T = scalar_t<VX>;
+        Vec<T> y(A.cols());
+        gemv_t(policy, T{1}, A, x, T{}, y);
+        return y;
+    }
+
+    // C = alpha * A B + beta * C for sparse A and dense B, C
+    template <exec::ExecutionPolicy P, typename T, MatLike MB, WritableMat MC>
+        requires std::same_as<scalar_t<MB>, T> && std::same_as<scalar_t<MC>, T>
+    void gemm(const P& policy, const T alpha, const CsrMat<T>& A, const MB& B, const T beta, MC&& C) {
+        const auto b = detail::cview(B);
+        auto c = detail::mview(C);
+        detail::check_spmm(A.rows(), A.cols(), b, c, "gemm(): A (m x k), B (k x n) and C (m x n) shapes do not agree");
+        if (detail::overlaps(c, b)) {
+            throw core::Error(core::ErrorCode::kInvalidArgument, "gemm(): C must not alias B");
+        }
+        detail::csr_gemm(policy, alpha, A, false, b, beta, c);
+    }
+
+    template <exec::ExecutionPolicy P, typename T, MatLike MB, WritableMat MC>
+        requires std::same_as<scalar_t<MB>, T> && std::same_as<scalar_t<MC>, T>
+    void gemm(const P& policy, const T alpha, const CscMat<T>& A, const MB& B, const T beta, MC&& C) {
+        const auto b = detail::cview(B);
+        auto c = detail::mview(C);
+        detail::check_spmm(A.rows(), A.cols(), b, c, "gemm(): A (m x k), B (k x n) and C (m x n) shapes do not agree");
+        if (detail::overlaps(c, b)) {
+            throw core::Error(core::ErrorCode::kInvalidArgument, "gemm(): C must not alias B");
+        }
+        detail::csr_gemm(policy, alpha, A.transposed(), true, b, beta, c);
+    }
+
+    template <exec::ExecutionPolicy P, typename S, MatLike MB>
+        requires (std::same_as<S, CsrMat<scalar_t<MB>>> || std::same_as<S, CscMat<scalar_t<MB>>>)
+    Mat<scalar_t<MB>> matmul(const P& policy, const S& A, const MB& B) {
+        using T = scalar_t<MB>;
+        Mat<T> C(A.rows(), B.cols());
+        gemm(policy, T{1}, A, B, T{}, C);
+        return C;
+    }
+
+    // thread-count forms, threads > 1 (0 = all threads of the pool) splits any product worth it
+    template <typename S, typename T, VecLike VX, WritableVec VY>
+        requires (std::same_as<S, CsrMat<T>> || std::same_as<S, CscMat<T>>)
+    void gemv(const T alpha, const S& A, const VX& x, const T beta, VY&& y, const core::index threads = 1) {
+        gemv(exec::on_threads(threads), alpha, A, x, beta, std::forward<VY>(y));
+    }
+
+    template <typename S, typename T, VecLike VX, WritableVec VY>
+        requires (std::same_as<S, CsrMat<T>> || std::same_as<S, CscMat<T>>)
+    void gemv_t(const T alpha, const S& A, const VX& x, const T beta, VY&& y, const core::index threads = 1) {
+        gemv_t(exec::on_threads(threads), alpha, A, x, beta, std::forward<VY>(y));
+    }
+
+    template <typename S, VecLike VX>
+        requires (std::same_as<S, CsrMat<scalar_t<VX>>> || std::same_as<S, CscMat<scalar_t<VX>>>)
+    Vec<scalar_t<VX>> matvec(const S& A, const VX& x, const core::index threads = 1) {
+        return matvec(exec::on_threads(threads), A, x);
+    }
+
+    template <typename S, VecLike VX>
+        requires (std::same_as<S, CsrMat<scalar_t<VX>>> || std::same_as<S, CscMat<scalar_t<VX>>>)
+    Vec<scalar_t<VX>> matvec_t(const S& A, const VX& x, const core::index threads = 1) {
+        return matvec_t(exec::on_threads(threads), A, x);
+    }
+
+    template <typename S, typename T, MatLike MB, WritableMat MC>
+        requires (std::same_as<S, CsrMat<T>> || std::same_as<S, CscMat<T>>)
+    void gemm(const T alpha, const S& A, const MB& B, const T beta, MC&& C, const core::index threads = 1) {
+        gemm(exec::on_threads(threads), alpha, A, B, beta, std::forward<MC>(C));
+    }
+
+    template <typename S, MatLike MB>
+        requires (std::same_as<S, CsrMat<scalar_t<MB>>> || std::same_as<S, CscMat<scalar_t<MB>>>)
+    Mat<scalar_t<MB>> matmul(const S& A, const MB& B, const core::index threads = 1) {
+        return matmul(exec::on_threads(threads), A, B);
+    }
+}
+
+#endif //AXIOM_SPARSE_HPP
\ No newline at end of file
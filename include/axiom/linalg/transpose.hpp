@@ -0,0 +1,112 @@
+#ifndef AXIOM_TRANSPOSE_HPP
+#define AXIOM_TRANSPOSE_HPP
+
+#include <algorithm>
+#include <concepts>
+#include <utility>
+
+#include "axiom/core/core.hpp"
+#include "axiom/exec/exec.hpp"
+#include "axiom/linalg/mat.hpp"
+#include "axiom/linalg/view.hpp"
+
+namespace axiom::linalg {
+/*
+ * transposes and storage-order changes for dense matrices:
+ * - A.transposed() (Mat, fixed-size Mat, MatView) is zero-copy, a MatView with rows / cols and
+ *   the strides swapped that every op in ops.hpp accepts, gemm / gemv pick their kernel from
+ *   the strides so op(A^T) costs nothing extra
+ * - transpose(A) materializes A^T and to_layout<L>(A) copies A into storage order L, both in one
+ *   cache-oblivious pass (detail::copy_blocked in view.hpp): the longer side is halved down to
+ *   32 x 32 tiles, so reads and writes stay in cache at every level and the pass runs close to
+ *   memory bandwidth without a block size tuned per machine
+ * - transpose_in_place(A) for a square A swaps the tile pairs (I, J) / (J, I) in place, the
+ *   diagonal tiles are transposed on their own, no workspace
+ * - an exec policy first argument splits the work into bands of whole tiles run on the thread
+ *   pool, every element is written by exactly one band so the result does not depend on it
+ * - Mat<T, dynamic, dynamic, ColMajor>(A) is the same pass as to_layout<ColMajor>(A)
+ */
+
+    namespace detail {
+        inline constexpr core::index kTransposeTile = 32;
+
+        // dst = src in bands of kTransposeTile rows, each band is one copy_blocked() pass
+        template <exec::ExecutionPolicy P, typename T>
+        void copy_bands(const P& policy, const MatView<const T>& src, const MatView<T>& dst) {
+            const core::index rows = src.rows(), cols = src.cols();
+            const core::index bands = (rows + kTransposeTile - 1) / kTransposeTile;
+            exec::parallel_for(exec::in_units(policy, kTransposeTile * cols), bands,
+                               [&](const core::index lo, const core::index hi) {
+                const core::index r0 = lo * kTransposeTile, r1 = std::min(hi * kTransposeTile, rows);
+                copy_blocked(src.block(r0, 0, r1 - r0, cols), dst.block(r0, 0, r1 - r0, cols));
+            });
+        }
+
+        // swaps a(r, c) <-> a(c, r) for r in [r0, r1), c in [c0, c1), the diagonal tile (r0 == c0)
+        // only visits c > r
+        template <typename T>
+        void swap_tiles(T* a, const core::index rs, const core::index cs, const core::index r0, const core::index r1,
+                        const core::index c0, const core::index c1) {
+            for (core::index r = r0; r < r1; ++r) {
+                for (core::index c = r0 == c0 ? r + 1 : c0; c < c1; ++c) std::swap(a[r * rs + c * cs], a[c * rs + r * cs]);
+            }
+        }
+
+        inline void check_square(const bool square, const char* msg) {
+            if (!square) throw core::Error(core::ErrorCode::kShapeMismatch, msg);
+        }
+    }
+
+    // A^T in storage order L
+    template <typename L = RowMajor, exec::ExecutionPolicy P, MatLike M>
+    [[nodiscard]] Mat<scalar_t<M>, core::dynamic, core::dynamic, L> transpose(const P& policy, const M& A) {
+        const MatView<const scalar_t<M>> a = detail::cview(A).transposed();
+        Mat<scalar_t<M>, core::dynamic, core::dynamic, L> out(a.rows(), a.cols());
+        detail::copy_bands(policy, a, out.view());
+        return out;
+    }
+
+    template <typename L = RowMajor, MatLike M>
+    [[nodiscard]] Mat<scalar_t<M>, core::dynamic, core::dynamic, L> transpose(const M& A) {
+        return transpose<L>(exec::seq, A);
+    }
+
+    // a copy of A in storage order L, e.g. to_layout<ColMajor>(A) before handing it to column code
+    template <typename L, exec::ExecutionPolicy P, MatLike M>
+    [[nodiscard]] Mat<scalar_t<M>, core::dynamic, core::dynamic, L> to_layout(const P& policy, const M& A) {
+        const MatView<const scalar_t<M>> a = detail::cview(A);
+        Mat<scalar_t<M>, core::dynamic, core::dynamic, L> out(a.rows(), a.cols());
+        detail::copy_bands(policy, a, out.view());
+        return out;
+    }
+
+    template <typename L, MatLike M>
+    [[nodiscard]] Mat<scalar_t<M>, core::dynamic, core::dynamic, L> to_layout(const M& A) {
+        return to_layout<L>(exec::seq, A);
+    }
+
+    // A = A^T for a square A, tile-row I of the upper triangle is one task
+    template <exec::ExecutionPolicy P, WritableMat M>
+    void transpose_in_place(const P& policy, M&& A) {
+        const MatView<scalar_t<M>> a = detail::mview(A);
+        const core::index n = a.rows();
+        detail::check_square(a.cols() == n, "transpose_in_place(): A must be square");
+        constexpr core::index tile = detail::kTransposeTile;
+        const core::index tiles = (n + tile - 1) / tile;
+        exec::parallel_for(exec::in_units(policy, tile * n), tiles, [&](const core::index lo, const core::index hi) {
+            for (core::index i = lo; i < hi; ++i) {
+                const core::index r0 = i * tile, r1 = std::min(r0 + tile, n);
+                for (core::index c0 = r0; c0 < n; c0 += tile) {
+                    detail::swap_tiles(a.data(), a.row_stride(), a.col_stride(), r0, r1, c0, std::min(c0 + tile, n));
+                }
+            }
+        });
+    }
+
+    template <WritableMat M>
+    void transpose_in_place(M&& A) {
+        transpose_in_place(exec::seq, std::forward<M>(A));
+    }
+}
+
+#endif //AXIOM_TRANSPOSE_HPP
\ No newline at end of file
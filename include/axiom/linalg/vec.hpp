@@ -3,24 +3,33 @@
 
 #include <vector>
 #include <algorithm>
+#include <iterator>
+#include <type_traits>
 #include <utility>
 #include <cmath>
 #include "axiom/core/core.hpp"
+#include "axiom/core/memory.hpp"
+#include "axiom/linalg/expr.hpp"
+#include "axiom/linalg/kernels.hpp"
+#include "axiom/linalg/view.hpp"
 
 namespace axiom::linalg {
+    // heap-backed vector, Vec<T, N> with a compile-time N lives in fixed.hpp
     template <typename T>
-    class Vec {
-        // vector data is represented by nx1
-        std::vector<T> data_;
+    class Vec<T, core::dynamic> : public VecExpr<Vec<T>> {
+        // vector data is represented by nx1, 64-byte aligned and drawn from
+        // core::current_resource() at construction (see core/memory.hpp)
+        using storage = core::aligned_vector<T>;
+        storage data_;
 
         static void validate_dims(const core::index n) {
             if (n == 0) throw core::Error(core::ErrorCode::kInvalidArgument,
                "Vec(n): vector size must be >= 1");
         }
 
-        static std::vector<T> make_vec(const core::index n, T value = T{}) {
+        static storage make_vec(const core::index n, T value = T{}) {
             validate_dims(n);
-            return std::vector<T>(n, value);
+            return storage(n, value);
         }
 
         void check_idx_out_of_range(const core::index idx) const {
@@ -29,18 +38,38 @@ namespace axiom::linalg {
             }
         }
 
-        static std::vector<T> check_data(std::vector<T>&& data) {
+        template <typename Alloc>
+        static storage check_data(std::vector<T, Alloc>&& data) {
             if (data.empty()) {
                 throw core::Error(core::ErrorCode::kInvalidArgument,
                                   "Vec(data): data must be non-empty");
             }
-            return std::move(data);
+            if constexpr (std::is_same_v<Alloc, core::Allocator<T>>) return std::move(data);
+            else return storage(std::make_move_iterator(data.begin()), std::make_move_iterator(data.end()));
+        }
+
+        void check_same_size(const std::size_t n, const char* msg) const {
+            if (size() != n) throw core::Error(core::ErrorCode::kShapeMismatch, msg);
         }
 
     public:
+        using value_type = T;
+        static constexpr core::index static_size = core::dynamic;
+
         // Constructors
-        explicit Vec(std::vector<T>&& data) : data_(check_data(std::move(data))) {}
+        // takes over aligned storage, any other vector is copied into it
+        template <typename Alloc>
+        explicit Vec(std::vector<T, Alloc>&& data) : data_(check_data(std::move(data))) {}
         explicit Vec(const core::index n) : data_(make_vec(n)) {}
+
+        // evaluates an expression in a single pass, e.g. Vec<T> r = a + 2 * b;
+        template <typename E>
+            requires (!std::same_as<E, Vec>)
+        Vec(const VecExpr<E>& expr) : data_(make_vec(expr.derived().size())) {
+            const E& e = expr.derived();
+            for (core::index i = 0; i < size(); ++i) data_[i] = e[i];
+        }
+
         static Vec ones(const core::index n) { return Vec(make_vec(n, T{1})); }
         static Vec zeros(const core::index n) { return Vec(make_vec(n)); }
 
@@ -54,27 +83,21 @@ namespace axiom::linalg {
         void resize(core::index n, T val) { data_.resize(n, val); }
         void fill(const T& val) { std::fill(data_.begin(), data_.end(), val); }
 
-        T l1_norm() const {
-            T res{};
-            for (auto x : data_) res += std::abs(x);
-            return res;
-        }
-
-        [[nodiscard]] double l2_norm() const {
-            long double sum = 0.0;
-            for (const auto x : data_) sum += core::sq(static_cast<long double>(x));
-            return std::sqrt(static_cast<double>(sum));
-        }
+        T l1_norm() const { return view().l1_norm(); }
+        [[nodiscard]] double l2_norm() const { return view().l2_norm(); }
+        T infty_norm() const { return view().infty_norm(); }
 
-        T infty_norm() const {
-            T res{};
-            for (auto x : data_) res = std::max(res, std::abs(x));
-            return res;
+        // Views
+        VecView<T> view() noexcept { return {data(), size()}; }
+        VecView<const T> view() const noexcept { return {data(), size()}; }
+        VecView<T> segment(const core::index start, const core::index len) { return view().segment(start, len); }
+        VecView<const T> segment(const core::index start, const core::index len) const {
+            return view().segment(start, len);
         }
 
         // Iterators
-        using iterator = std::vector<T>::iterator;
-        using const_iterator = std::vector<T>::const_iterator;
+        using iterator = typename storage::iterator;
+        using const_iterator = typename storage::const_iterator;
         iterator begin() noexcept { return data_.begin(); }
         iterator end() noexcept { return data_.end(); }
         const_iterator begin() const noexcept { return data_.begin(); }
@@ -95,52 +118,41 @@ namespace axiom::linalg {
             return data_[i];
         }
 
-        // vector addition
-        Vec& operator+=(const Vec& rhs) {
-            if (size() != rhs.size()) {
-                throw core::Error(core::ErrorCode::kShapeMismatch,
-                    "vec operator +: vectors must be of same size");
-            }
-            for (core::index i = 0; i < size(); ++i) data_[i] += rhs[i];
+        // assignment from an expression, elementwise so v = v + w is alias-safe, a size change
+        // evaluates into fresh storage first since the expression may view this vector
+        template <typename E>
+            requires (!std::same_as<E, Vec>)
+        Vec& operator=(const VecExpr<E>& expr) {
+            const E& e = expr.derived();
+            if (size() != e.size()) return *this = Vec(expr);
+            for (core::index i = 0; i < size(); ++i) data_[i] = e[i];
             return *this;
         }
 
-        friend Vec operator+(Vec lhs, const Vec& rhs) {
-            lhs += rhs;
-            return lhs;
+        // vector addition, y += a * x + b * z runs as one fused loop
+        template <typename E>
+        Vec& operator+=(const VecExpr<E>& expr) {
+            const E& e = expr.derived();
+            check_same_size(e.size(), "vec operator +: vectors must be of same size");
+            for (core::index i = 0; i < size(); ++i) data_[i] += e[i];
+            return *this;
         }
 
         // vector subtraction
-        Vec& operator-=(const Vec& rhs) {
-            if (size() != rhs.size()) {
-                throw core::Error(core::ErrorCode::kShapeMismatch,
-                    "vec operator -: vectors must be of same size");
-            }
-            for (core::index i = 0; i < size(); ++i) data_[i] -= rhs[i];
+        template <typename E>
+        Vec& operator-=(const VecExpr<E>& expr) {
+            const E& e = expr.derived();
+            check_same_size(e.size(), "vec operator -: vectors must be of same size");
+            for (core::index i = 0; i < size(); ++i) data_[i] -= e[i];
             return *this;
         }
 
-        friend Vec operator-(Vec lhs, const Vec& rhs) {
-            lhs -= rhs;
-            return lhs;
-        }
-
         // scalar multiplication
         Vec& operator*=(const T& val) {
             for (auto& x : data_) x *= val;
             return *this;
         }
 
-        friend Vec operator*(Vec lhs, const T& val) {
-            lhs *= val;
-            return lhs;
-        }
-
-        friend Vec operator*(const T& val, Vec rhs) {
-            rhs *= val;
-            return rhs;
-        }
-
         // scalar division
         Vec& operator/=(const T& val) {
             if (val == 0) throw core::Error(core::ErrorCode::kDivideByZero,
@@ -149,17 +161,7 @@ namespace axiom::linalg {
             return *this;
         }
 
-        friend Vec operator/(Vec lhs, const T& val) {
-            lhs /= val;
-            return lhs;
-        }
-
-        // unary negation for -v
-        friend Vec operator-(Vec v) {
-            for (auto& x : v.data_) x = -x;
-            return v;
-        }
-
+        // binary +, -, scalar *, / and unary - are lazy, see expr.hpp
     };
 }
 
@@ -0,0 +1,549 @@
+#ifndef AXIOM_VIEW_HPP
+#define AXIOM_VIEW_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "axiom/core/core.hpp"
+#include "axiom/core/memory.hpp"
+#include "axiom/linalg/expr.hpp"
+#include "axiom/linalg/kernels.hpp"
+
+namespace axiom::linalg {
+/*
+ * non-owning strided views:
+ * - VecView<T>: size elements at data[i * stride], e.g. a row, a column or a segment
+ * - MatView<T>: rows x cols elements at data[r * row_stride + c * col_stride], e.g. a block
+ *   or a range of rows (minibatch), transposed() swaps the strides without touching the elements
+ * - VecView<const T> / MatView<const T> are read-only, a mutable view converts to a const one
+ * - views are expression leaves, writes through a view land in the viewed container, assigning
+ *   to a view copies elements (it never rebinds), an operand that holds the destination's own
+ *   elements in a different order (A.view() = A.transposed(), a segment shifted over itself)
+ *   is evaluated into a temporary
+ *   first, view-to-view copies with different unit strides go through the cache-oblivious
+ *   copy_blocked()
+ * - a view is only valid while the container it refers to is alive and not resized
+ * - every op in ops.hpp accepts owning containers and views alike (VecLike / MatLike)
+ */
+
+    template <typename T> class VecView;
+    template <typename T> class MatView;
+
+    namespace detail {
+        template <typename T>
+        class StridedIterator {
+            T* p_ = nullptr;
+            std::ptrdiff_t stride_ = 1;
+
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = std::remove_const_t<T>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = T*;
+            using reference = T&;
+
+            StridedIterator() = default;
+            StridedIterator(T* p, const std::ptrdiff_t stride) noexcept : p_(p), stride_(stride) {}
+
+            T& operator*() const noexcept { return *p_; }
+            T* operator->() const noexcept { return p_; }
+            T& operator[](const difference_type n) const noexcept { return p_[n * stride_]; }
+
+            StridedIterator& operator++() noexcept { p_ += stride_; return *this; }
+            StridedIterator operator++(int) noexcept { auto it = *this; p_ += stride_; return it; }
+            StridedIterator& operator--() noexcept { p_ -= stride_; return *this; }
+            StridedIterator operator--(int) noexcept { auto it = *this; p_ -= stride_; return it; }
+            StridedIterator& operator+=(const difference_type n) noexcept { p_ += n * stride_; return *this; }
+            StridedIterator& operator-=(const difference_type n) noexcept { p_ -= n * stride_; return *this; }
+
+            friend StridedIterator operator+(StridedIterator it, const difference_type n) noexcept { return it += n; }
+            friend StridedIterator operator+(const difference_type n, StridedIterator it) noexcept { return it += n; }
+            friend StridedIterator operator-(StridedIterator it, const difference_type n) noexcept { return it -= n; }
+            friend difference_type operator-(const StridedIterator& a, const StridedIterator& b) noexcept {
+                return (a.p_ - b.p_) / a.stride_;
+            }
+            friend bool operator==(const StridedIterator& a, const StridedIterator& b) noexcept { return a.p_ == b.p_; }
+            friend auto operator<=>(const StridedIterator& a, const StridedIterator& b) noexcept {
+                return std::compare_three_way{}(a.p_, b.p_);
+            }
+        };
+
+        inline void check_range(const bool ok, const char* msg) {
+            if (!ok) throw core::Error(core::ErrorCode::kOutOfBounds, msg);
+        }
+
+        template <typename T>
+        void copy_blocked(const MatView<const T>& src, const MatView<T>& dst);
+
+        template <typename T, typename E>
+        bool reorders(const VecView<const T>& dst, const E& e);
+        template <typename T, typename E>
+        bool reorders(const MatView<const T>& dst, const E& e);
+    }
+
+    template <typename T>
+    class VecView : public VecExpr<VecView<T>> {
+        T* data_;
+        core::index size_;
+        core::index stride_;
+
+        template <typename E>
+        void check_same_size(const E& e, const char* msg) const {
+            if (e.size() != size_) throw core::Error(core::ErrorCode::kShapeMismatch, msg);
+        }
+
+        // evaluates e into a contiguous temporary and hands it to f, for operands that hold this
+        // view's elements at other positions (elementwise writes would clobber unread ones)
+        template <typename E, typename F>
+        void through_copy(const E& e, F f) const {
+            core::aligned_vector<std::remove_const_t<T>> buf(size_);
+            VecView<std::remove_const_t<T>> tmp(buf.data(), size_);
+            tmp = e;
+            f(VecView<const std::remove_const_t<T>>(tmp));
+        }
+
+    public:
+        using value_type = std::remove_const_t<T>;
+        using element_type = T;
+        using iterator = detail::StridedIterator<T>;
+        static constexpr core::index static_size = core::dynamic;
+
+        VecView(T* data, const core::index size, const core::index stride = 1) noexcept
+            : data_(data), size_(size), stride_(stride) {}
+
+        template <typename U>
+            requires (std::is_const_v<T> && std::same_as<const U, T>)
+        VecView(const VecView<U>& other) noexcept
+            : data_(other.data()), size_(other.size()), stride_(other.stride()) {}
+
+        VecView(const VecView&) = default;
+
+        // Getters
+        [[nodiscard]] std::size_t size() const noexcept { return size_; }
+        [[nodiscard]] core::index stride() const noexcept { return stride_; }
+        [[nodiscard]] bool contiguous() const noexcept { return stride_ == 1 || size_ <= 1; }
+        T* data() const noexcept { return data_; }
+
+        T& operator[](const core::index i) const noexcept { return data_[i * stride_]; }
+        T& at(const core::index i) const {
+            detail::check_range(i < size_, "VecView::at: index out of bounds");
+            return (*this)[i];
+        }
+
+        iterator begin() const noexcept { return {data_, static_cast<std::ptrdiff_t>(stride_)}; }
+        iterator end() const noexcept { return begin() + static_cast<std::ptrdiff_t>(size_); }
+
+        // elements [start, start + len)
+        VecView segment(const core::index start, const core::index len) const {
+            detail::check_range(start <= size_ && len <= size_ - start, "VecView::segment: out of bounds");
+            return {data_ + start * stride_, len, stride_};
+        }
+
+        // elementwise writes into the viewed container
+        VecView& operator=(const VecView& other) requires (!std::is_const_v<T>) {
+            return *this = static_cast<const VecExpr<VecView>&>(other);
+        }
+
+        template <typename E>
+            requires (!std::is_const_v<T>)
+        VecView& operator=(const VecExpr<E>& expr) {
+            const E& e = expr.derived();
+            check_same_size(e, "vec view operator =: vectors must be of same size");
+            if (detail::reorders<value_type>(*this, e)) {
+                through_copy(e, [&](const VecView<const value_type>& tmp) { *this = tmp; });
+            } else {
+                for (core::index i = 0; i < size_; ++i) (*this)[i] = e[i];
+            }
+            return *this;
+        }
+
+        template <typename E>
+            requires (!std::is_const_v<T>)
+        VecView& operator+=(const VecExpr<E>& expr) {
+            const E& e = expr.derived();
+            check_same_size(e, "vec view operator +: vectors must be of same size");
+            if (detail::reorders<value_type>(*this, e)) {
+                through_copy(e, [&](const VecView<const value_type>& tmp) { *this += tmp; });
+            } else {
+                for (core::index i = 0; i < size_; ++i) (*this)[i] += e[i];
+            }
+            return *this;
+        }
+
+        template <typename E>
+            requires (!std::is_const_v<T>)
+        VecView& operator-=(const VecExpr<E>& expr) {
+            const E& e = expr.derived();
+            check_same_size(e, "vec view operator -: vectors must be of same size");
+            if (detail::reorders<value_type>(*this, e)) {
+                through_copy(e, [&](const VecView<const value_type>& tmp) { *this -= tmp; });
+            } else {
+                for (core::index i = 0; i < size_; ++i) (*this)[i] -= e[i];
+            }
+            return *this;
+        }
+
+        VecView& operator*=(const value_type& val) requires (!std::is_const_v<T>) {
+            for (core::index i = 0; i < size_; ++i) (*this)[i] *= val;
+            return *this;
+        }
+
+        VecView& operator/=(const value_type& val) requires (!std::is_const_v<T>) {
+            detail::check_divisor(val, "vec view operator /: cannot divide by 0");
+            for (core::index i = 0; i < size_; ++i) (*this)[i] /= val;
+            return *this;
+        }
+
+        void fill(const value_type& val) const requires (!std::is_const_v<T>) {
+            for (core::index i = 0; i < size_; ++i) (*this)[i] = val;
+        }
+
+        // norms, contiguous float / double views run on the SIMD kernels
+        value_type l1_norm() const {
+            if constexpr (kernels::has_simd<value_type>) {
+                if (contiguous()) return kernels::sum_abs(data_, size_);
+            }
+            value_type res{};
+            for (core::index i = 0; i < size_; ++i) res += std::abs((*this)[i]);
+            return res;
+        }
+
+        [[nodiscard]] double l2_norm() const {
+            if constexpr (kernels::has_simd<value_type>) {
+                if (contiguous()) return std::sqrt(kernels::sum_sq(data_, size_));
+            }
+            return std::sqrt(kernels::detail::compensated_sum(begin(), end(), [](const value_type& x) {
+                return core::sq(static_cast<double>(x));
+            }));
+        }
+
+        value_type infty_norm() const {
+            if constexpr (kernels::has_simd<value_type>) {
+                if (contiguous()) return kernels::max_abs(data_, size_);
+            }
+            value_type res{};
+            for (core::index i = 0; i < size_; ++i) res = std::max(res, static_cast<value_type>(std::abs((*this)[i])));
+            return res;
+        }
+    };
+
+    template <typename T>
+    class MatView : public MatExpr<MatView<T>> {
+        T* data_;
+        core::index rows_;
+        core::index cols_;
+        core::index rs_;
+        core::index cs_;
+
+        template <typename E>
+        void check_same_shape(const E& e, const char* msg) const {
+            if (e.rows() != rows_ || e.cols() != cols_) throw core::Error(core::ErrorCode::kShapeMismatch, msg);
+        }
+
+        template <typename F>
+        void for_each(F f) const {
+            for (core::index r = 0; r < rows_; ++r) {
+                for (core::index c = 0; c < cols_; ++c) f(r, c);
+            }
+        }
+
+        // evaluates e into a row-major temporary and hands it to f, for operands that hold this
+        // view's elements in a different order (elementwise writes would clobber unread ones)
+        template <typename E, typename F>
+        void through_copy(const E& e, F f) const {
+            core::aligned_vector<std::remove_const_t<T>> buf(size());
+            MatView<std::remove_const_t<T>> tmp(buf.data(), rows_, cols_, cols_);
+            tmp = e;
+            f(MatView<const std::remove_const_t<T>>(tmp));
+        }
+
+    public:
+        using value_type = std::remove_const_t<T>;
+        using element_type = T;
+        static constexpr core::index static_rows = core::dynamic;
+        static constexpr core::index static_cols = core::dynamic;
+
+        MatView(T* data, const core::index rows, const core::index cols,
+                const core::index row_stride, const core::index col_stride = 1) noexcept
+            : data_(data), rows_(rows), cols_(cols), rs_(row_stride), cs_(col_stride) {}
+
+        template <typename U>
+            requires (std::is_const_v<T> && std::same_as<const U, T>)
+        MatView(const MatView<U>& other) noexcept
+            : data_(other.data()), rows_(other.rows()), cols_(other.cols()),
+              rs_(other.row_stride()), cs_(other.col_stride()) {}
+
+        MatView(const MatView&) = default;
+
+        // Getters
+        [[nodiscard]] core::index rows() const noexcept { return rows_; }
+        [[nodiscard]] core::index cols() const noexcept { return cols_; }
+        [[nodiscard]] std::size_t size() const noexcept { return rows_ * cols_; }
+        [[nodiscard]] core::index row_stride() const noexcept { return rs_; }
+        [[nodiscard]] core::index col_stride() const noexcept { return cs_; }
+        T* data() const noexcept { return data_; }
+
+        T& operator()(const core::index row, const core::index col) const noexcept {
+            return data_[row * rs_ + col * cs_];
+        }
+        T& at(const core::index row, const core::index col) const {
+            detail::check_range(row < rows_ && col < cols_, "MatView::at: index out of bounds");
+            return (*this)(row, col);
+        }
+
+        // sub-views
+        VecView<T> row(const core::index i) const {
+            detail::check_range(i < rows_, "MatView::row: index out of bounds");
+            return {data_ + i * rs_, cols_, cs_};
+        }
+
+        VecView<T> col(const core::index j) const {
+            detail::check_range(j < cols_, "MatView::col: index out of bounds");
+            return {data_ + j * cs_, rows_, rs_};
+        }
+
+        // rows [row, row + rows) x cols [col, col + cols)
+        MatView block(const core::index row, const core::index col,
+                      const core::index rows, const core::index cols) const {
+            detail::check_range(row <= rows_ && rows <= rows_ - row && col <= cols_ && cols <= cols_ - col,
+                                "MatView::block: block out of bounds");
+            return {data_ + row * rs_ + col * cs_, rows, cols, rs_, cs_};
+        }
+
+        // rows [first, first + count), e.g. a minibatch of samples
+        MatView row_range(const core::index first, const core::index count) const {
+            return block(first, 0, count, cols_);
+        }
+
+        // zero-copy transpose, the same elements with rows / cols and the strides swapped
+        MatView transposed() const noexcept { return {data_, cols_, rows_, cs_, rs_}; }
+
+        // elementwise writes into the viewed container
+        MatView& operator=(const MatView& other) requires (!std::is_const_v<T>) {
+            return *this = static_cast<const MatExpr<MatView>&>(other);
+        }
+
+        template <typename E>
+            requires (!std::is_const_v<T>)
+        MatView& operator=(const MatExpr<E>& expr) {
+            const E& e = expr.derived();
+            check_same_shape(e, "mat view operator =: matrices must be of same shape");
+            if (detail::reorders<value_type>(*this, e)) {
+                through_copy(e, [&](const MatView<const value_type>& tmp) { *this = tmp; });
+            } else if constexpr (std::same_as<E, MatView<value_type>> || std::same_as<E, MatView<const value_type>>) {
+                detail::copy_blocked<value_type>(e, *this);
+            } else {
+                for_each([&](const core::index r, const core::index c) { (*this)(r, c) = e(r, c); });
+            }
+            return *this;
+        }
+
+        template <typename E>
+            requires (!std::is_const_v<T>)
+        MatView& operator+=(const MatExpr<E>& expr) {
+            const E& e = expr.derived();
+            check_same_shape(e, "mat view operator +: matrices must be of same shape");
+            if (detail::reorders<value_type>(*this, e)) {
+                through_copy(e, [&](const MatView<const value_type>& tmp) { *this += tmp; });
+            } else {
+                for_each([&](const core::index r, const core::index c) { (*this)(r, c) += e(r, c); });
+            }
+            return *this;
+        }
+
+        template <typename E>
+            requires (!std::is_const_v<T>)
+        MatView& operator-=(const MatExpr<E>& expr) {
+            const E& e = expr.derived();
+            check_same_shape(e, "mat view operator -: matrices must be of same shape");
+            if (detail::reorders<value_type>(*this, e)) {
+                through_copy(e, [&](const MatView<const value_type>& tmp) { *this -= tmp; });
+            } else {
+                for_each([&](const core::index r, const core::index c) { (*this)(r, c) -= e(r, c); });
+            }
+            return *this;
+        }
+
+        MatView& operator*=(const value_type& val) requires (!std::is_const_v<T>) {
+            for_each([&](const core::index r, const core::index c) { (*this)(r, c) *= val; });
+            return *this;
+        }
+
+        MatView& operator/=(const value_type& val) requires (!std::is_const_v<T>) {
+            detail::check_divisor(val, "mat view operator /: cannot divide by 0");
+            for_each([&](const core::index r, const core::index c) { (*this)(r, c) /= val; });
+            return *this;
+        }
+
+        void fill(const value_type& val) const requires (!std::is_const_v<T>) {
+            for_each([&](const core::index r, const core::index c) { (*this)(r, c) = val; });
+        }
+    };
+
+    namespace detail {
+        // dst = src for two views of the same shape: with matching unit strides it copies line by
+        // line, otherwise (a transpose or a layout change) it halves the longer side down to tiles
+        // that fit in L1 next to each other, reads and writes then stream through every cache
+        // level without a block size tuned per machine (cache-oblivious)
+        template <typename T>
+        void copy_blocked(const MatView<const T>& src, const MatView<T>& dst) {
+            constexpr core::index kTile = 32;
+            const core::index rows = src.rows(), cols = src.cols();
+            const core::index srs = src.row_stride(), scs = src.col_stride();
+            const core::index drs = dst.row_stride(), dcs = dst.col_stride();
+            const T* s = src.data();
+            T* d = dst.data();
+            if (scs == 1 && dcs == 1) {
+                for (core::index r = 0; r < rows; ++r) std::copy_n(s + r * srs, cols, d + r * drs);
+                return;
+            }
+            if (srs == 1 && drs == 1) {
+                for (core::index c = 0; c < cols; ++c) std::copy_n(s + c * scs, rows, d + c * dcs);
+                return;
+            }
+            if (rows > kTile || cols > kTile) {
+                // split on a tile boundary so the leaves stay whole tiles
+                const auto half = [](const core::index n) { return (n / 2 + kTile - 1) / kTile * kTile; };
+                if (rows >= cols) {
+                    const core::index h = half(rows);
+                    copy_blocked(src.block(0, 0, h, cols), dst.block(0, 0, h, cols));
+                    copy_blocked(src.block(h, 0, rows - h, cols), dst.block(h, 0, rows - h, cols));
+                } else {
+                    const core::index h = half(cols);
+                    copy_blocked(src.block(0, 0, rows, h), dst.block(0, 0, rows, h));
+                    copy_blocked(src.block(0, h, rows, cols - h), dst.block(0, h, rows, cols - h));
+                }
+                return;
+            }
+            // the inner loop runs along the destination's unit stride
+            if (drs == 1) {
+                for (core::index c = 0; c < cols; ++c) {
+                    for (core::index r = 0; r < rows; ++r) d[r + c * dcs] = s[r * srs + c * scs];
+                }
+            } else {
+                for (core::index r = 0; r < rows; ++r) {
+                    for (core::index c = 0; c < cols; ++c) d[r * drs + c * dcs] = s[r * srs + c * scs];
+                }
+            }
+        }
+
+        template <typename V> struct is_vec_like : std::false_type {};
+        template <typename T, core::index N> struct is_vec_like<Vec<T, N>> : std::true_type {};
+        template <typename T> struct is_vec_like<VecView<T>> : std::true_type {};
+
+        template <typename M> struct is_mat_like : std::false_type {};
+        template <typename T, core::index R, core::index C, typename L>
+        struct is_mat_like<Mat<T, R, C, L>> : std::true_type {};
+        template <typename T> struct is_mat_like<MatView<T>> : std::true_type {};
+
+        // compile-time sized Vec<T, N> / Mat<T, R, C>
+        template <typename X> inline constexpr bool is_fixed = false;
+        template <typename T, core::index N> inline constexpr bool is_fixed<Vec<T, N>> = N != core::dynamic;
+        template <typename T, core::index R, core::index C, typename L>
+        inline constexpr bool is_fixed<Mat<T, R, C, L>> = R != core::dynamic && C != core::dynamic;
+
+        template <typename... X>
+        concept all_fixed = (is_fixed<std::remove_cvref_t<X>> && ...);
+
+        // read-only view of a container or view
+        template <typename T, core::index N> VecView<const T> cview(const Vec<T, N>& v) noexcept { return v.view(); }
+        template <typename T> VecView<const T> cview(const VecView<T>& v) noexcept { return v; }
+        template <typename T, core::index R, core::index C, typename L>
+        MatView<const T> cview(const Mat<T, R, C, L>& m) noexcept { return m.view(); }
+        template <typename T> MatView<const T> cview(const MatView<T>& m) noexcept { return m; }
+
+        // writable view, only for non-const containers and mutable views
+        template <typename T, core::index N> VecView<T> mview(Vec<T, N>& v) noexcept { return v.view(); }
+        template <typename T> requires (!std::is_const_v<T>)
+        VecView<T> mview(const VecView<T>& v) noexcept { return v; }
+        template <typename T, core::index R, core::index C, typename L>
+        MatView<T> mview(Mat<T, R, C, L>& m) noexcept { return m.view(); }
+        template <typename T> requires (!std::is_const_v<T>)
+        MatView<T> mview(const MatView<T>& m) noexcept { return m; }
+
+        // [first, last] element addresses covered by a view
+        template <typename T>
+        std::pair<const T*, const T*> extent(const VecView<const T>& v) noexcept {
+            return {v.data(), v.data() + (v.size() ? (v.size() - 1) * v.stride() : 0)};
+        }
+
+        template <typename T>
+        std::pair<const T*, const T*> extent(const MatView<const T>& m) noexcept {
+            const core::index last = m.size() ? (m.rows() - 1) * m.row_stride() + (m.cols() - 1) * m.col_stride() : 0;
+            return {m.data(), m.data() + last};
+        }
+
+        // true if two views may share elements (conservative, compares address ranges)
+        template <typename A, typename B>
+        bool overlaps(const A& a, const B& b) noexcept {
+            if (a.size() == 0 || b.size() == 0) return false;
+            const auto [a0, a1] = extent(cview(a));
+            const auto [b0, b1] = extent(cview(b));
+            return !(std::less<>{}(a1, b0) || std::less<>{}(b1, a0));
+        }
+
+        // a and b hold the same elements in the same order
+        template <typename T>
+        bool same_layout(const VecView<const T>& a, const VecView<const T>& b) noexcept {
+            return a.data() == b.data() && a.stride() == b.stride();
+        }
+
+        template <typename T>
+        bool same_layout(const MatView<const T>& a, const MatView<const T>& b) noexcept {
+            return a.data() == b.data() && a.row_stride() == b.row_stride() && a.col_stride() == b.col_stride();
+        }
+
+        // true if any leaf of e is a view of dst's elements in a different order (shifted, strided
+        // or transposed), elementwise evaluation into dst would then read elements it has already
+        // overwritten
+        template <typename View, typename E>
+        bool any_leaf_reorders(const View& dst, const E& e) {
+            bool found = false;
+            for_each_leaf(e, [&](const auto& leaf) {
+                if constexpr (requires { cview(leaf); }) {
+                    const View src = cview(leaf);
+                    found = found || (overlaps(src, dst) && !same_layout(src, dst));
+                }
+            });
+            return found;
+        }
+
+        template <typename T, typename E>
+        bool reorders(const VecView<const T>& dst, const E& e) { return any_leaf_reorders(dst, e); }
+
+        template <typename T, typename E>
+        bool reorders(const MatView<const T>& dst, const E& e) { return any_leaf_reorders(dst, e); }
+    }
+
+    // owning containers and views, the argument types accepted by ops.hpp
+    template <typename V>
+    concept VecLike = detail::is_vec_like<std::remove_cvref_t<V>>::value;
+
+    template <typename M>
+    concept MatLike = detail::is_mat_like<std::remove_cvref_t<M>>::value;
+
+    template <typename V>
+    concept WritableVec = VecLike<V> && requires(V& v) { detail::mview(v); };
+
+    template <typename M>
+    concept WritableMat = MatLike<M> && requires(M& m) { detail::mview(m); };
+
+    template <typename X>
+    using scalar_t = typename std::remove_cvref_t<X>::value_type;
+
+    template <typename A, typename B>
+    concept SameScalar = std::same_as<scalar_t<A>, scalar_t<B>>;
+
+    // vectors whose static sizes agree (see expr.hpp), fixed sizes that differ are rejected
+    template <typename A, typename B>
+    concept SameSize = detail::same_vec_size<std::remove_cvref_t<A>, std::remove_cvref_t<B>>;
+}
+
+#endif //AXIOM_VIEW_HPP
\ No newline at end of file
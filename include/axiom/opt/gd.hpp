@@ -5,4 +5,243 @@
 #ifndef AXIOM_GD_HPP
 #define AXIOM_GD_HPP
 
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "axiom/core/core.hpp"
+#include "axiom/core/profile.hpp"
+#include "axiom/exec/exec.hpp"
+#include "axiom/linalg/mat.hpp"
+#include "axiom/linalg/ops.hpp"
+#include "axiom/linalg/vec.hpp"
+#include "axiom/linalg/view.hpp"
+
+namespace axiom::opt {
+/*
+ * gradient descent over a sum of per-sample losses, f(x) = 1/N sum_i f_i(x):
+ * - the objective is called as f(x, samples, grad) with a span of sample indices, it adds the
+ *   gradient of those samples into grad (which starts at zero) and returns the summed loss
+ * - batch_size 0 is full-batch, 1 is SGD and anything else mini-batch, batches are drawn from a
+ *   per-epoch shuffle (seeded, reproducible)
+ * - every batch is cut into `shards` contiguous pieces evaluated in parallel into their own
+ *   gradient rows, which are summed in shard order, so the result does not depend on threads
+ * - update rules: plain, momentum, Nesterov (in the form that needs no look-ahead gradient) and
+ *   Adam with bias correction
+ * - all state is allocated by the constructor, minimize() does not touch the heap
+ *   (a parallel policy runs on the exec::ThreadPool, which starts its workers on first use)
+ * - convergence: gradient norm (per iteration in full-batch mode, per epoch on the epoch mean
+ *   otherwise), step norm and relative loss change per epoch, any tolerance <= 0 is disabled
+ */
+
+    enum class UpdateRule { kPlain, kMomentum, kNesterov, kAdam };
+
+    // kLineSearchFailed is only reported by line-search based optimizers (lbfgs.hpp)
+    enum class StopReason { kMaxIterations, kGradientTolerance, kStepTolerance, kLossTolerance, kLineSearchFailed };
+
+    struct GdOptions {
+        UpdateRule rule = UpdateRule::kPlain;
+        double learning_rate = 1e-2;
+        double momentum = 0.9;              // momentum and Nesterov
+        double beta1 = 0.9;                 // Adam
+        double beta2 = 0.999;
+        double epsilon = 1e-8;
+
+        core::index batch_size = 0;         // 0 = full batch
+        bool shuffle = true;
+        std::uint64_t seed = 0;
+        core::index shards = 1;             // gradient pieces per batch
+        exec::Parallel policy = exec::on_threads(1);    // spreads the shards, min_size counts samples
+
+        core::index max_iterations = 1000;  // parameter updates
+        double grad_tol = 1e-6;
+        std::size_t grad_norm_order = 2;    // see linalg::norm, 0 is the infinity norm
+        double step_tol = 0.0;
+        double loss_tol = 0.0;
+    };
+
+    template <typename T>
+    struct GdResult {
+        core::index iterations = 0;
+        core::index epochs = 0;
+        T loss{};                           // mean loss over the samples seen in the last epoch
+        double grad_norm = std::numeric_limits<double>::infinity();
+        StopReason reason = StopReason::kMaxIterations;
+
+        [[nodiscard]] bool converged() const noexcept { return reason != StopReason::kMaxIterations; }
+    };
+
+    template <typename F, typename T>
+    concept BatchObjective = std::invocable<F&, const linalg::Vec<T>&, std::span<const core::index>, linalg::VecView<T>> &&
+        std::convertible_to<std::invoke_result_t<F&, const linalg::Vec<T>&, std::span<const core::index>,
+                                                 linalg::VecView<T>>, T>;
+
+    template <std::floating_point T>
+    class GradientDescent {
+    public:
+        GradientDescent(const core::index dim, const core::index samples, const GdOptions& options = {})
+            : options_(options), samples_(samples), grad_(dim), epoch_grad_(dim), step_(dim),
+              first_(dim), second_(dim), shard_grads_(std::max<core::index>(1, options.shards), dim),
+              shard_loss_(std::max<core::index>(1, options.shards)), order_(samples) {
+            if (samples == 0) {
+                throw core::Error(core::ErrorCode::kInvalidArgument, "GradientDescent(): need at least one sample");
+            }
+            if (options.learning_rate <= 0.0) {
+                throw core::Error(core::ErrorCode::kInvalidArgument,
+                    "GradientDescent(): learning_rate must be positive");
+            }
+            if (options.batch_size > samples) {
+                throw core::Error(core::ErrorCode::kInvalidArgument,
+                    "GradientDescent(): batch_size must not exceed the number of samples");
+            }
+            std::iota(order_.begin(), order_.end(), core::index{0});
+        }
+
+        [[nodiscard]] const GdOptions& options() const noexcept { return options_; }
+
+        // minimizes f starting from x, x holds the result, momentum / Adam state starts fresh
+        template <typename F>
+            requires BatchObjective<F, T>
+        GdResult<T> minimize(F&& f, linalg::Vec<T>& x) {
+            AXIOM_PROFILE_SCOPE("opt::GradientDescent::minimize");
+            if (x.size() != grad_.size()) {
+                throw core::Error(core::ErrorCode::kShapeMismatch,
+                    "GradientDescent::minimize(): x must have dim elements");
+            }
+            const core::index batch = options_.batch_size == 0 ? samples_ : options_.batch_size;
+            const bool full_batch = batch == samples_;
+            const core::index per_epoch = (samples_ + batch - 1) / batch;
+            first_.fill(T{});
+            second_.fill(T{});
+            std::mt19937_64 rng(options_.seed);
+
+            GdResult<T> result;
+            T prev_loss = std::numeric_limits<T>::infinity();
+            while (result.iterations < options_.max_iterations) {
+                if (options_.shuffle && !full_batch) std::shuffle(order_.begin(), order_.end(), rng);
+                epoch_grad_.fill(T{});
+                T epoch_loss{};
+                core::index seen = 0;
+
+                for (core::index b = 0; b < per_epoch && result.iterations < options_.max_iterations; ++b) {
+                    const core::index first = b * batch;
+                    const core::index count = std::min(batch, samples_ - first);
+                    epoch_loss += evaluate(f, x, std::span<const core::index>(order_).subspan(first, count));
+                    seen += count;
+                    if (!full_batch) epoch_grad_ += grad_;
+                    grad_ *= T{1} / static_cast<T>(count);
+
+                    if (full_batch) {
+                        result.grad_norm = linalg::norm(grad_, options_.grad_norm_order);
+                        if (result.grad_norm <= options_.grad_tol) {
+                            result.loss = epoch_loss / static_cast<T>(seen);
+                            result.reason = StopReason::kGradientTolerance;
+                            return result;
+                        }
+                    }
+
+                    update(x, ++result.iterations);
+                    if (options_.step_tol > 0.0 && linalg::norm(step_, 2) <= options_.step_tol) {
+                        result.loss = epoch_loss / static_cast<T>(seen);
+                        result.reason = StopReason::kStepTolerance;
+                        return result;
+                    }
+                }
+
+                ++result.epochs;
+                result.loss = epoch_loss / static_cast<T>(seen);
+                if (!full_batch) {
+                    epoch_grad_ *= T{1} / static_cast<T>(seen);
+                    result.grad_norm = linalg::norm(epoch_grad_, options_.grad_norm_order);
+                    if (result.grad_norm <= options_.grad_tol) {
+                        result.reason = StopReason::kGradientTolerance;
+                        return result;
+                    }
+                }
+                if (options_.loss_tol > 0.0 &&
+                    std::abs(prev_loss - result.loss) <= options_.loss_tol * std::max(T{1}, std::abs(result.loss))) {
+                    result.reason = StopReason::kLossTolerance;
+                    return result;
+                }
+                prev_loss = result.loss;
+            }
+            return result;
+        }
+
+    private:
+        GdOptions options_;
+        core::index samples_;
+        linalg::Vec<T> grad_;
+        linalg::Vec<T> epoch_grad_;
+        linalg::Vec<T> step_;
+        linalg::Vec<T> first_;     // velocity, or Adam's first moment
+        linalg::Vec<T> second_;    // Adam's second moment
+        linalg::Mat<T> shard_grads_;
+        std::vector<T> shard_loss_;
+        std::vector<core::index> order_;
+
+        // summed loss of the batch, grad_ = summed gradient, shards reduced in order
+        template <typename F>
+        T evaluate(F& f, const linalg::Vec<T>& x, const std::span<const core::index> batch) {
+            const core::index shards = std::min<core::index>(shard_grads_.rows(), batch.size());
+            exec::parallel_for(exec::in_units(options_.policy, batch.size() / shards), shards,
+                               [&](const core::index first, const core::index last) {
+                for (core::index s = first; s < last; ++s) {
+                    const core::index lo = batch.size() * s / shards, hi = batch.size() * (s + 1) / shards;
+                    auto g = shard_grads_.row(s);
+                    g.fill(T{});
+                    shard_loss_[s] = static_cast<T>(f(x, batch.subspan(lo, hi - lo), g));
+                }
+            });
+            grad_ = shard_grads_.row(0);
+            T loss = shard_loss_[0];
+            for (core::index s = 1; s < shards; ++s) {
+                grad_ += shard_grads_.row(s);
+                loss += shard_loss_[s];
+            }
+            return loss;
+        }
+
+        void update(linalg::Vec<T>& x, const core::index t) {
+            const T lr = static_cast<T>(options_.learning_rate);
+            const T mu = static_cast<T>(options_.momentum);
+            switch (options_.rule) {
+                case UpdateRule::kPlain:
+                    step_ = -lr * grad_;
+                    break;
+                case UpdateRule::kMomentum:
+                    first_ = mu * first_ - lr * grad_;
+                    step_ = first_;
+                    break;
+                case UpdateRule::kNesterov:
+                    // v' = mu v - lr g, x += mu v' - lr g
+                    first_ = mu * first_ - lr * grad_;
+                    step_ = mu * first_ - lr * grad_;
+                    break;
+                case UpdateRule::kAdam: {
+                    const T b1 = static_cast<T>(options_.beta1), b2 = static_cast<T>(options_.beta2);
+                    const T eps = static_cast<T>(options_.epsilon);
+                    const T c1 = T{1} - std::pow(b1, static_cast<T>(t));
+                    const T c2 = T{1} - std::pow(b2, static_cast<T>(t));
+                    for (core::index i = 0; i < x.size(); ++i) {
+                        const T g = grad_[i];
+                        first_[i] = b1 * first_[i] + (T{1} - b1) * g;
+                        second_[i] = b2 * second_[i] + (T{1} - b2) * g * g;
+                        step_[i] = -lr * (first_[i] / c1) / (std::sqrt(second_[i] / c2) + eps);
+                    }
+                    break;
+                }
+            }
+            x += step_;
+        }
+    };
+}
+
 #endif //AXIOM_GD_HPP
\ No newline at end of file
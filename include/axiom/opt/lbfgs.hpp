@@ -0,0 +1,247 @@
+#ifndef AXIOM_LBFGS_HPP
+#define AXIOM_LBFGS_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <limits>
+#include <utility>
+
+#include "axiom/core/core.hpp"
+#include "axiom/core/profile.hpp"
+#include "axiom/linalg/mat.hpp"
+#include "axiom/linalg/ops.hpp"
+#include "axiom/linalg/vec.hpp"
+#include "axiom/opt/gd.hpp"
+#include "axiom/opt/linsearch.hpp"
+
+namespace axiom::opt {
+/*
+ * limited-memory BFGS:
+ * - the last `history` pairs s = x_k+1 - x_k, y = g_k+1 - g_k are rows of two history x dim
+ *   matrices used as one ring buffer, so the two-loop recursion walks contiguous rows with the
+ *   SIMD dot kernel and fused axpy expressions, nothing is allocated after construction
+ * - H0 = (s.y / y.y) I from the newest pair, pairs with s.y <= eps y.y are skipped so H stays
+ *   positive definite
+ * - the line search is a template parameter (MoreThuente by default, see linsearch.hpp), a
+ *   failed search drops the history and retries once along the steepest descent direction
+ * - bounds (projected L-BFGS, a simplified L-BFGS-B): variables at a bound whose gradient
+ *   points outward are held fixed for the iteration, the direction is built on the free ones,
+ *   every trial point is projected onto the box with core::clamp before evaluation, and
+ *   convergence uses the projected gradient x - clamp(x - g)
+ */
+
+    struct LbfgsOptions {
+        core::index history = 8;
+        core::index max_iterations = 500;
+        double grad_tol = 1e-6;
+        std::size_t grad_norm_order = 0;    // see linalg::norm, 0 is the infinity norm
+        double loss_tol = 0.0;              // relative decrease per iteration, <= 0 disables
+        double curvature_eps = 1e-10;
+    };
+
+    template <typename T>
+    struct LbfgsResult {
+        core::index iterations = 0;
+        T loss{};
+        double grad_norm = std::numeric_limits<double>::infinity();
+        StopReason reason = StopReason::kMaxIterations;
+        core::index f_evals = 0;
+        core::index g_evals = 0;
+
+        [[nodiscard]] bool converged() const noexcept {
+            return reason == StopReason::kGradientTolerance || reason == StopReason::kLossTolerance;
+        }
+    };
+
+    template <std::floating_point T, typename LS = MoreThuente<T>>
+    class Lbfgs {
+    public:
+        explicit Lbfgs(const core::index dim, const LbfgsOptions& options = {})
+            : Lbfgs(dim, options, LS(dim)) {}
+
+        Lbfgs(const core::index dim, const LbfgsOptions& options, LS line_search)
+            : options_(options), search_(std::move(line_search)),
+              s_(std::max<core::index>(1, options.history), dim), y_(std::max<core::index>(1, options.history), dim),
+              rho_(std::max<core::index>(1, options.history)), alpha_(std::max<core::index>(1, options.history)),
+              g_(dim), d_(dim), x_prev_(dim), g_prev_(dim), lower_(dim), upper_(dim), projected_(dim) {
+            if (options.history == 0) {
+                throw core::Error(core::ErrorCode::kInvalidArgument, "Lbfgs(): history must be at least 1");
+            }
+        }
+
+        // box constraints lower <= x <= upper, elementwise
+        void set_bounds(const linalg::Vec<T>& lower, const linalg::Vec<T>& upper) {
+            if (lower.size() != g_.size() || upper.size() != g_.size()) {
+                throw core::Error(core::ErrorCode::kShapeMismatch, "Lbfgs::set_bounds(): bounds must have dim elements");
+            }
+            for (core::index i = 0; i < lower.size(); ++i) {
+                if (lower[i] > upper[i]) {
+                    throw core::Error(core::ErrorCode::kInvalidArgument, "Lbfgs::set_bounds(): lower > upper");
+                }
+            }
+            lower_ = lower;
+            upper_ = upper;
+            bounded_ = true;
+        }
+
+        void clear_bounds() noexcept { bounded_ = false; }
+
+        [[nodiscard]] const LS& line_search() const noexcept { return search_; }
+
+        // minimizes f starting from x (projected onto the bounds if any), x holds the result
+        template <typename F>
+            requires FunctionGradient<F, T> && LineSearchFor<LS, F, T>
+        LbfgsResult<T> minimize(F&& fg, linalg::Vec<T>& x) {
+            AXIOM_PROFILE_SCOPE("opt::Lbfgs::minimize");
+            if (x.size() != g_.size()) {
+                throw core::Error(core::ErrorCode::kShapeMismatch, "Lbfgs::minimize(): x must have dim elements");
+            }
+            LbfgsResult<T> result;
+            head_ = count_ = 0;
+
+            // trial points are projected onto the box before f sees them
+            auto objective = [&](const linalg::Vec<T>& xt, linalg::Vec<T>& g) -> T {
+                if (!bounded_) return static_cast<T>(fg(xt, g));
+                projected_ = xt;
+                project(projected_);
+                return static_cast<T>(fg(projected_, g));
+            };
+
+            if (bounded_) project(x);
+            T f = objective(x, g_);
+            ++result.f_evals;
+            ++result.g_evals;
+
+            for (;;) {
+                result.loss = f;
+                result.grad_norm = projected_grad_norm(x);
+                if (result.grad_norm <= options_.grad_tol) {
+                    result.reason = StopReason::kGradientTolerance;
+                    return result;
+                }
+                if (result.iterations == options_.max_iterations) {
+                    result.reason = StopReason::kMaxIterations;
+                    return result;
+                }
+
+                x_prev_ = x;
+                g_prev_ = g_;
+                const T f_prev = f;
+                direction(x);
+                auto r = run_search(objective, x, f, count_ == 0);
+                if (!r.moved() && count_ > 0) {
+                    count_ = 0;
+                    direction(x);
+                    const auto retry = run_search(objective, x, f, true);
+                    r.f_evals += retry.f_evals;
+                    r.g_evals += retry.g_evals;
+                    r.status = retry.status;
+                    r.step = retry.step;
+                }
+                result.f_evals += r.f_evals;
+                result.g_evals += r.g_evals;
+                if (!r.moved()) {
+                    result.reason = StopReason::kLineSearchFailed;
+                    return result;
+                }
+                if (bounded_) project(x);
+                ++result.iterations;
+                push_pair(x);
+
+                if (options_.loss_tol > 0.0 &&
+                    f_prev - f <= static_cast<T>(options_.loss_tol) * std::max(T{1}, std::abs(f))) {
+                    result.loss = f;
+                    result.grad_norm = projected_grad_norm(x);
+                    result.reason = StopReason::kLossTolerance;
+                    return result;
+                }
+            }
+        }
+
+    private:
+        LbfgsOptions options_;
+        LS search_;
+        linalg::Mat<T> s_, y_;      // ring buffer rows, newest at head_ - 1
+        linalg::Vec<T> rho_, alpha_;
+        linalg::Vec<T> g_, d_, x_prev_, g_prev_;
+        linalg::Vec<T> lower_, upper_, projected_;
+        core::index head_ = 0, count_ = 0;
+        bool bounded_ = false;
+
+        void project(linalg::Vec<T>& x) const {
+            for (core::index i = 0; i < x.size(); ++i) x[i] = core::clamp(lower_[i], upper_[i], x[i]);
+        }
+
+        // variable i is held at its bound this iteration
+        [[nodiscard]] bool fixed(const linalg::Vec<T>& x, const core::index i) const {
+            return bounded_ && ((x[i] <= lower_[i] && g_[i] > T{}) || (x[i] >= upper_[i] && g_[i] < T{}));
+        }
+
+        [[nodiscard]] double projected_grad_norm(const linalg::Vec<T>& x) {
+            if (!bounded_) return linalg::norm(g_, options_.grad_norm_order);
+            for (core::index i = 0; i < x.size(); ++i) d_[i] = x[i] - core::clamp(lower_[i], upper_[i], x[i] - g_[i]);
+            return linalg::norm(d_, options_.grad_norm_order);
+        }
+
+        // d = -H g over the free variables (two-loop recursion)
+        void direction(const linalg::Vec<T>& x) {
+            d_ = -g_;
+            if (bounded_) {
+                for (core::index i = 0; i < x.size(); ++i) {
+                    if (fixed(x, i)) d_[i] = T{};
+                }
+            }
+            const core::index m = s_.rows();
+            for (core::index k = 0; k < count_; ++k) {
+                const core::index i = (head_ + m - 1 - k) % m;
+                alpha_[i] = rho_[i] * linalg::dot(s_.row(i), d_);
+                d_ -= alpha_[i] * y_.row(i);
+            }
+            if (count_ > 0) {
+                const core::index newest = (head_ + m - 1) % m;
+                const T yy = linalg::dot(y_.row(newest), y_.row(newest));
+                d_ *= T{1} / (rho_[newest] * yy);
+            }
+            for (core::index k = count_; k-- > 0;) {
+                const core::index i = (head_ + m - 1 - k) % m;
+                const T beta = rho_[i] * linalg::dot(y_.row(i), d_);
+                d_ += (alpha_[i] - beta) * s_.row(i);
+            }
+            if (bounded_) {
+                for (core::index i = 0; i < x.size(); ++i) {
+                    if (fixed(x, i)) d_[i] = T{};
+                }
+            }
+        }
+
+        template <typename F>
+        LineSearchResult<T> run_search(F& objective, linalg::Vec<T>& x, T& f, const bool first) {
+            // without curvature information the first step is scaled to unit length
+            T step{1};
+            if (first) {
+                const double len = linalg::len(d_);
+                if (len > 0.0) step = static_cast<T>(std::min(1.0, 1.0 / len));
+            }
+            if (!(linalg::dot(g_, d_) < T{})) return {LineSearchStatus::kNotDescent};
+            return search_.search(objective, x, f, g_, d_, step);
+        }
+
+        // the pair is staged in d_ / g_prev_ (both rewritten before their next use) and only
+        // copied into the ring once accepted, a rejected pair must not overwrite the oldest one
+        void push_pair(const linalg::Vec<T>& x) {
+            d_ = x - x_prev_;
+            g_prev_ = g_ - g_prev_;
+            const T sy = linalg::dot(d_, g_prev_);
+            const T yy = linalg::dot(g_prev_, g_prev_);
+            if (!(sy > static_cast<T>(options_.curvature_eps) * yy)) return;
+            s_.row(head_) = d_;
+            y_.row(head_) = g_prev_;
+            rho_[head_] = T{1} / sy;
+            head_ = (head_ + 1) % s_.rows();
+            count_ = std::min(count_ + 1, s_.rows());
+        }
+    };
+}
+
+#endif //AXIOM_LBFGS_HPP
\ No newline at end of file
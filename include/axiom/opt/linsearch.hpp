@@ -1,4 +1,474 @@
 #ifndef AXIOM_LINSEARCH_HPP
 #define AXIOM_LINSEARCH_HPP
 
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "axiom/core/core.hpp"
+#include "axiom/linalg/ops.hpp"
+#include "axiom/linalg/vec.hpp"
+
+namespace axiom::opt {
+/*
+ * line searches along a descent direction d from x, phi(a) = f(x + a d):
+ * - the objective is fused, f_and_grad(x, grad) returns f(x) and writes its gradient, every
+ *   trial costs one call and is counted in LineSearchResult / LineSearchStats
+ * - search(fg, x, f, g, d, step) takes f = f(x) and g = grad f(x) and, on success, leaves the
+ *   accepted point in x, f, g; trial points live in workspace vectors that are swapped in, so
+ *   the accepted point is never evaluated again and no vector is allocated per call
+ * - the last evaluation is cached by step length, asking for the same step twice is free
+ * - Backtracking: Armijo sufficient decrease, steps come from a quadratic then cubic fit of the
+ *   function values instead of halving, safeguarded to [0.1, 0.5] of the previous step
+ * - StrongWolfe: bracketing and zoom (Nocedal & Wright, alg. 3.5 / 3.6), zoom steps are cubic
+ *   minimizers of the bracket ends
+ * - MoreThuente: the More & Thuente (1994) algorithm as in MINPACK-2 dcsrch / dcstep
+ */
+
+    enum class LineSearchStatus { kConverged, kMaxEvaluations, kNotDescent, kStepBounds, kTolerance };
+
+    struct LineSearchOptions {
+        double c1 = 1e-4;               // sufficient decrease
+        double c2 = 0.9;                // curvature (Wolfe searches)
+        double xtol = 1e-12;            // relative bracket width (More-Thuente)
+        double min_step = 1e-20;
+        double max_step = 1e20;
+        core::index max_evaluations = 20;
+    };
+
+    template <typename T>
+    struct LineSearchResult {
+        LineSearchStatus status = LineSearchStatus::kConverged;
+        T step{};
+        core::index f_evals = 0;
+        core::index g_evals = 0;
+        core::index cache_hits = 0;
+
+        // true if x, f and g were moved to a new point
+        [[nodiscard]] bool moved() const noexcept { return step > T{}; }
+        [[nodiscard]] bool converged() const noexcept { return status == LineSearchStatus::kConverged; }
+    };
+
+    // totals over every search() of one line search object
+    struct LineSearchStats {
+        core::index searches = 0;
+        core::index f_evals = 0;
+        core::index g_evals = 0;
+        core::index cache_hits = 0;
+    };
+
+    template <typename F, typename T>
+    concept FunctionGradient = std::invocable<F&, const linalg::Vec<T>&, linalg::Vec<T>&> &&
+        std::convertible_to<std::invoke_result_t<F&, const linalg::Vec<T>&, linalg::Vec<T>&>, T>;
+
+    namespace detail {
+        // minimizer of the cubic through (a, fa, ga) and (b, fb, gb), NaN if it has none
+        template <typename T>
+        T cubic_min(const T a, const T fa, const T ga, const T b, const T fb, const T gb) {
+            const T d1 = ga + gb - T{3} * (fa - fb) / (a - b);
+            const T disc = d1 * d1 - ga * gb;
+            if (disc < T{}) return std::numeric_limits<T>::quiet_NaN();
+            const T d2 = std::copysign(std::sqrt(disc), b - a);
+            return b - (b - a) * (gb + d2 - d1) / (gb - ga + T{2} * d2);
+        }
+
+        // minimizer of the quadratic through (0, f0) with slope g0 and (a, fa)
+        template <typename T>
+        T quad_min(const T f0, const T g0, const T a, const T fa) {
+            return -g0 * a * a / (T{2} * (fa - f0 - g0 * a));
+        }
+
+        // minimizer of the cubic through (0, f0) with slope g0, (a0, f_a0) and (a1, f_a1)
+        template <typename T>
+        T cubic_min_values(const T f0, const T g0, const T a0, const T fa0, const T a1, const T fa1) {
+            const T r1 = fa1 - f0 - g0 * a1;
+            const T r0 = fa0 - f0 - g0 * a0;
+            const T d = a0 * a0 * a1 * a1 * (a1 - a0);
+            const T ca = (a0 * a0 * r1 - a1 * a1 * r0) / d;
+            const T cb = (-a0 * a0 * a0 * r1 + a1 * a1 * a1 * r0) / d;
+            if (ca == T{}) return -g0 / (T{2} * cb);
+            const T disc = cb * cb - T{3} * ca * g0;
+            if (disc < T{}) return std::numeric_limits<T>::quiet_NaN();
+            return (-cb + std::sqrt(disc)) / (T{3} * ca);
+        }
+
+        // workspace, evaluation cache and counters shared by the searches
+        template <typename T>
+        class LineSearchBase {
+        public:
+            [[nodiscard]] const LineSearchOptions& options() const noexcept { return options_; }
+            [[nodiscard]] const LineSearchStats& stats() const noexcept { return stats_; }
+            void reset_stats() noexcept { stats_ = {}; }
+
+        protected:
+            LineSearchOptions options_;
+            LineSearchStats stats_;
+            linalg::Vec<T> x_trial_, g_trial_;  // most recent evaluation
+            linalg::Vec<T> x_best_, g_best_;    // best accepted-so-far point (bracket end)
+            T trial_step_ = -T{1};
+            T trial_f_{}, trial_slope_{};
+            T best_step_{}, best_f_{};
+            LineSearchResult<T> result_;
+
+            LineSearchBase(const core::index dim, const LineSearchOptions& options)
+                : options_(options), x_trial_(dim), g_trial_(dim), x_best_(dim), g_best_(dim) {}
+
+            // checks shapes and the descent condition, returns the slope along d at x
+            T begin(const linalg::Vec<T>& x, const linalg::Vec<T>& g, const linalg::Vec<T>& d, const T step) {
+                if (x.size() != x_trial_.size() || g.size() != x.size() || d.size() != x.size()) {
+                    throw core::Error(core::ErrorCode::kShapeMismatch,
+                        "line search: x, g and d must have the dimension of the search");
+                }
+                if (!(step > T{})) {
+                    throw core::Error(core::ErrorCode::kInvalidArgument, "line search: initial step must be positive");
+                }
+                ++stats_.searches;
+                result_ = {};
+                trial_step_ = -T{1};
+                best_step_ = T{};
+                return linalg::dot(g, d);
+            }
+
+            // phi(step) and phi'(step) through the cache
+            template <typename F>
+            std::pair<T, T> evaluate(F& fg, const linalg::Vec<T>& x, const linalg::Vec<T>& d, const T step) {
+                if (step == trial_step_) {
+                    ++result_.cache_hits;
+                    ++stats_.cache_hits;
+                    return {trial_f_, trial_slope_};
+                }
+                x_trial_ = x + step * d;
+                trial_f_ = static_cast<T>(fg(x_trial_, g_trial_));
+                trial_slope_ = linalg::dot(g_trial_, d);
+                trial_step_ = step;
+                ++result_.f_evals;
+                ++result_.g_evals;
+                ++stats_.f_evals;
+                ++stats_.g_evals;
+                return {trial_f_, trial_slope_};
+            }
+
+            // the last trial becomes the best point, its buffers are swapped, not copied
+            void keep_trial() {
+                std::swap(x_best_, x_trial_);
+                std::swap(g_best_, g_trial_);
+                best_step_ = trial_step_;
+                best_f_ = trial_f_;
+                trial_step_ = -T{1};
+            }
+
+            LineSearchResult<T> accept_trial(linalg::Vec<T>& x, T& f, linalg::Vec<T>& g, const LineSearchStatus status) {
+                std::swap(x, x_trial_);
+                std::swap(g, g_trial_);
+                f = trial_f_;
+                result_.step = trial_step_;
+                result_.status = status;
+                trial_step_ = -T{1};
+                return result_;
+            }
+
+            // falls back to the best point seen if it decreased f, otherwise x stays put
+            LineSearchResult<T> finish(linalg::Vec<T>& x, T& f, linalg::Vec<T>& g, const LineSearchStatus status) {
+                if (best_step_ > T{} && best_f_ < f) {
+                    std::swap(x, x_best_);
+                    std::swap(g, g_best_);
+                    f = best_f_;
+                    result_.step = best_step_;
+                } else {
+                    result_.step = T{};
+                }
+                result_.status = status;
+                return result_;
+            }
+
+            LineSearchResult<T> not_descent() {
+                result_.status = LineSearchStatus::kNotDescent;
+                return result_;
+            }
+        };
+    }
+
+    template <std::floating_point T>
+    class Backtracking : public detail::LineSearchBase<T> {
+        using Base = detail::LineSearchBase<T>;
+
+    public:
+        explicit Backtracking(const core::index dim, const LineSearchOptions& options = {}) : Base(dim, options) {}
+
+        template <typename F>
+            requires FunctionGradient<F, T>
+        LineSearchResult<T> search(F& fg, linalg::Vec<T>& x, T& f, linalg::Vec<T>& g, const linalg::Vec<T>& d,
+                                   T step = T{1}) {
+            const T slope0 = this->begin(x, g, d, step);
+            if (!(slope0 < T{})) return this->not_descent();
+            const auto& opt = this->options_;
+            const T c1 = static_cast<T>(opt.c1);
+            step = std::min(step, static_cast<T>(opt.max_step));
+
+            T prev_step{}, prev_f{};
+            for (core::index k = 0; k < opt.max_evaluations; ++k) {
+                const auto [fa, slope] = this->evaluate(fg, x, d, step);
+                (void)slope;
+                if (fa <= f + c1 * step * slope0) return this->accept_trial(x, f, g, LineSearchStatus::kConverged);
+
+                T next = k == 0 || !std::isfinite(prev_f) ? detail::quad_min(f, slope0, step, fa)
+                                                          : detail::cubic_min_values(f, slope0, prev_step, prev_f, step, fa);
+                if (!std::isfinite(fa) || !std::isfinite(next)) next = T{0.5} * step;
+                next = std::clamp(next, T{0.1} * step, T{0.5} * step);
+                prev_step = step;
+                prev_f = fa;
+                step = next;
+                if (step < static_cast<T>(opt.min_step)) return this->finish(x, f, g, LineSearchStatus::kStepBounds);
+            }
+            return this->finish(x, f, g, LineSearchStatus::kMaxEvaluations);
+        }
+    };
+
+    template <std::floating_point T>
+    class StrongWolfe : public detail::LineSearchBase<T> {
+        using Base = detail::LineSearchBase<T>;
+
+    public:
+        explicit StrongWolfe(const core::index dim, const LineSearchOptions& options = {}) : Base(dim, options) {}
+
+        template <typename F>
+            requires FunctionGradient<F, T>
+        LineSearchResult<T> search(F& fg, linalg::Vec<T>& x, T& f, linalg::Vec<T>& g, const linalg::Vec<T>& d,
+                                   T step = T{1}) {
+            const T slope0 = this->begin(x, g, d, step);
+            if (!(slope0 < T{})) return this->not_descent();
+            const auto& opt = this->options_;
+            const T c1 = static_cast<T>(opt.c1), c2 = static_cast<T>(opt.c2);
+            const T max_step = static_cast<T>(opt.max_step);
+            const T f0 = f;
+            step = std::min(step, max_step);
+
+            // bracket end with the lower f (lo) and the other end (hi)
+            T lo = T{}, f_lo = f0, s_lo = slope0;
+            for (core::index k = 0; k < opt.max_evaluations; ++k) {
+                const auto [fa, sa] = this->evaluate(fg, x, d, step);
+                if (fa > f0 + c1 * step * slope0 || (k > 0 && fa >= f_lo) || !std::isfinite(fa)) {
+                    return zoom(fg, x, f, g, d, slope0, lo, f_lo, s_lo, step, fa, sa, k + 1);
+                }
+                if (std::abs(sa) <= -c2 * slope0) return this->accept_trial(x, f, g, LineSearchStatus::kConverged);
+                if (sa >= T{}) {
+                    const T hi = lo, f_hi = f_lo, s_hi = s_lo;
+                    lo = step;
+                    f_lo = fa;
+                    s_lo = sa;
+                    this->keep_trial();
+                    return zoom(fg, x, f, g, d, slope0, lo, f_lo, s_lo, hi, f_hi, s_hi, k + 1);
+                }
+                lo = step;
+                f_lo = fa;
+                s_lo = sa;
+                this->keep_trial();
+                if (step >= max_step) return this->finish(x, f, g, LineSearchStatus::kStepBounds);
+                step = std::min(T{2} * step, max_step);
+            }
+            return this->finish(x, f, g, LineSearchStatus::kMaxEvaluations);
+        }
+
+    private:
+        template <typename F>
+        LineSearchResult<T> zoom(F& fg, linalg::Vec<T>& x, T& f, linalg::Vec<T>& g, const linalg::Vec<T>& d,
+                                 const T slope0, T lo, T f_lo, T s_lo, T hi, T f_hi, T s_hi, core::index evals) {
+            const auto& opt = this->options_;
+            const T c1 = static_cast<T>(opt.c1), c2 = static_cast<T>(opt.c2);
+            const T f0 = f;
+            for (; evals < opt.max_evaluations; ++evals) {
+                const T a = std::min(lo, hi), b = std::max(lo, hi);
+                if (b - a <= static_cast<T>(opt.xtol) * b) return this->finish(x, f, g, LineSearchStatus::kTolerance);
+                T step = std::isfinite(f_hi) ? detail::cubic_min(lo, f_lo, s_lo, hi, f_hi, s_hi)
+                                             : std::numeric_limits<T>::quiet_NaN();
+                const T margin = T{0.1} * (b - a);
+                if (!std::isfinite(step) || step < a + margin || step > b - margin) step = T{0.5} * (a + b);
+
+                const auto [fa, sa] = this->evaluate(fg, x, d, step);
+                if (fa > f0 + c1 * step * slope0 || fa >= f_lo || !std::isfinite(fa)) {
+                    hi = step;
+                    f_hi = fa;
+                    s_hi = sa;
+                    continue;
+                }
+                if (std::abs(sa) <= -c2 * slope0) return this->accept_trial(x, f, g, LineSearchStatus::kConverged);
+                if (sa * (hi - lo) >= T{}) {
+                    hi = lo;
+                    f_hi = f_lo;
+                    s_hi = s_lo;
+                }
+                lo = step;
+                f_lo = fa;
+                s_lo = sa;
+                this->keep_trial();
+            }
+            return this->finish(x, f, g, LineSearchStatus::kMaxEvaluations);
+        }
+    };
+
+    template <std::floating_point T>
+    class MoreThuente : public detail::LineSearchBase<T> {
+        using Base = detail::LineSearchBase<T>;
+
+    public:
+        explicit MoreThuente(const core::index dim, const LineSearchOptions& options = {}) : Base(dim, options) {}
+
+        template <typename F>
+            requires FunctionGradient<F, T>
+        LineSearchResult<T> search(F& fg, linalg::Vec<T>& x, T& f, linalg::Vec<T>& g, const linalg::Vec<T>& d,
+                                   T step = T{1}) {
+            const T ginit = this->begin(x, g, d, step);
+            if (!(ginit < T{})) return this->not_descent();
+            const auto& opt = this->options_;
+            const T ftol = static_cast<T>(opt.c1), gtol = static_cast<T>(opt.c2), xtol = static_cast<T>(opt.xtol);
+            const T stpmin = static_cast<T>(opt.min_step), stpmax = static_cast<T>(opt.max_step);
+            constexpr T xtrapl = T{1.1}, xtrapu = T{4};
+
+            const T finit = f;
+            const T gtest = ftol * ginit;
+            T width = stpmax - stpmin, width1 = T{2} * width;
+            Step s{T{}, finit, ginit, T{}, finit, ginit, false};
+            T stmin = T{}, stmax = step + xtrapu * step;
+            bool stage1 = true;
+            step = std::clamp(step, stpmin, stpmax);
+
+            for (core::index k = 0; k < opt.max_evaluations; ++k) {
+                const auto [fp, gp] = this->evaluate(fg, x, d, step);
+                const T ftest = finit + step * gtest;
+                if (stage1 && fp <= ftest && gp >= T{}) stage1 = false;
+
+                if (fp <= ftest && std::abs(gp) <= gtol * -ginit) {
+                    return this->accept_trial(x, f, g, LineSearchStatus::kConverged);
+                }
+                if (s.bracketed && (step <= stmin || step >= stmax)) return this->finish(x, f, g, LineSearchStatus::kTolerance);
+                if (s.bracketed && stmax - stmin <= xtol * stmax) return this->finish(x, f, g, LineSearchStatus::kTolerance);
+                if (step == stpmax && fp <= ftest && gp <= gtest) {
+                    return this->accept_trial(x, f, g, LineSearchStatus::kStepBounds);
+                }
+                if (step == stpmin && (fp > ftest || gp >= gtest)) return this->finish(x, f, g, LineSearchStatus::kStepBounds);
+
+                // a modified function with sufficient decrease built in, until some step has it
+                const T evaluated = step;
+                if (stage1 && fp <= s.fx && fp > ftest) {
+                    Step m{s.stx, s.fx - s.stx * gtest, s.gx - gtest, s.sty, s.fy - s.sty * gtest, s.gy - gtest, s.bracketed};
+                    step = dcstep(m, step, fp - step * gtest, gp - gtest, stmin, stmax);
+                    s = {m.stx, m.fx + m.stx * gtest, m.gx + gtest, m.sty, m.fy + m.sty * gtest, m.gy + gtest, m.bracketed};
+                } else {
+                    step = dcstep(s, step, fp, gp, stmin, stmax);
+                }
+                if (s.stx == evaluated && std::isfinite(fp)) this->keep_trial();
+
+                if (s.bracketed) {
+                    if (std::abs(s.sty - s.stx) >= T{0.66} * width1) step = s.stx + T{0.5} * (s.sty - s.stx);
+                    width1 = width;
+                    width = std::abs(s.sty - s.stx);
+                    stmin = std::min(s.stx, s.sty);
+                    stmax = std::max(s.stx, s.sty);
+                } else {
+                    stmin = step + xtrapl * (step - s.stx);
+                    stmax = step + xtrapu * (step - s.stx);
+                }
+                step = std::clamp(step, stpmin, stpmax);
+                if (s.bracketed && (step <= stmin || step >= stmax || stmax - stmin <= xtol * stmax)) step = s.stx;
+            }
+            return this->finish(x, f, g, LineSearchStatus::kMaxEvaluations);
+        }
+
+    private:
+        // best step (x), the other end of the interval (y) and whether it brackets a minimizer
+        struct Step {
+            T stx, fx, gx;
+            T sty, fy, gy;
+            bool bracketed;
+        };
+
+        // safeguarded step (MINPACK-2 dcstep), updates the interval with the trial (stp, fp, dp)
+        static T dcstep(Step& s, const T stp, const T fp, const T dp, const T stpmin, const T stpmax) {
+            const T sgnd = dp * (s.gx / std::abs(s.gx));
+            T stpf;
+            if (fp > s.fx) {
+                const T theta = T{3} * (s.fx - fp) / (stp - s.stx) + s.gx + dp;
+                const T sc = std::max({std::abs(theta), std::abs(s.gx), std::abs(dp)});
+                T gamma = sc * std::sqrt(std::max(T{}, (theta / sc) * (theta / sc) - (s.gx / sc) * (dp / sc)));
+                if (stp < s.stx) gamma = -gamma;
+                const T p = (gamma - s.gx) + theta;
+                const T q = ((gamma - s.gx) + gamma) + dp;
+                const T stpc = s.stx + (p / q) * (stp - s.stx);
+                const T stpq = s.stx + ((s.gx / ((s.fx - fp) / (stp - s.stx) + s.gx)) / T{2}) * (stp - s.stx);
+                stpf = std::abs(stpc - s.stx) < std::abs(stpq - s.stx) ? stpc : stpc + (stpq - stpc) / T{2};
+                s.bracketed = true;
+            } else if (sgnd < T{}) {
+                const T theta = T{3} * (s.fx - fp) / (stp - s.stx) + s.gx + dp;
+                const T sc = std::max({std::abs(theta), std::abs(s.gx), std::abs(dp)});
+                T gamma = sc * std::sqrt(std::max(T{}, (theta / sc) * (theta / sc) - (s.gx / sc) * (dp / sc)));
+                if (stp > s.stx) gamma = -gamma;
+                const T p = (gamma - dp) + theta;
+                const T q = ((gamma - dp) + gamma) + s.gx;
+                const T stpc = stp + (p / q) * (s.stx - stp);
+                const T stpq = stp + (dp / (dp - s.gx)) * (s.stx - stp);
+                stpf = std::abs(stpc - stp) > std::abs(stpq - stp) ? stpc : stpq;
+                s.bracketed = true;
+            } else if (std::abs(dp) < std::abs(s.gx)) {
+                const T theta = T{3} * (s.fx - fp) / (stp - s.stx) + s.gx + dp;
+                const T sc = std::max({std::abs(theta), std::abs(s.gx), std::abs(dp)});
+                T gamma = sc * std::sqrt(std::max(T{}, (theta / sc) * (theta / sc) - (s.gx / sc) * (dp / sc)));
+                if (stp > s.stx) gamma = -gamma;
+                const T p = (gamma - dp) + theta;
+                const T q = (gamma + (s.gx - dp)) + gamma;
+                const T r = p / q;
+                T stpc;
+                if (r < T{} && gamma != T{}) stpc = stp + r * (s.stx - stp);
+                else stpc = stp > s.stx ? stpmax : stpmin;
+                const T stpq = stp + (dp / (dp - s.gx)) * (s.stx - stp);
+                if (s.bracketed) {
+                    stpf = std::abs(stpc - stp) < std::abs(stpq - stp) ? stpc : stpq;
+                    if (stp > s.stx) stpf = std::min(stp + T{0.66} * (s.sty - stp), stpf);
+                    else stpf = std::max(stp + T{0.66} * (s.sty - stp), stpf);
+                } else {
+                    stpf = std::abs(stpc - stp) > std::abs(stpq - stp) ? stpc : stpq;
+                    stpf = std::clamp(stpf, stpmin, stpmax);
+                }
+            } else {
+                if (s.bracketed) {
+                    const T theta = T{3} * (fp - s.fy) / (s.sty - stp) + s.gy + dp;
+                    const T sc = std::max({std::abs(theta), std::abs(s.gy), std::abs(dp)});
+                    T gamma = sc * std::sqrt(std::max(T{}, (theta / sc) * (theta / sc) - (s.gy / sc) * (dp / sc)));
+                    if (stp > s.sty) gamma = -gamma;
+                    const T p = (gamma - dp) + theta;
+                    const T q = ((gamma - dp) + gamma) + s.gy;
+                    stpf = stp + (p / q) * (s.sty - stp);
+                } else {
+                    stpf = stp > s.stx ? stpmax : stpmin;
+                }
+            }
+
+            if (fp > s.fx) {
+                s.sty = stp;
+                s.fy = fp;
+                s.gy = dp;
+            } else {
+                if (sgnd < T{}) {
+                    s.sty = s.stx;
+                    s.fy = s.fx;
+                    s.gy = s.gx;
+                }
+                s.stx = stp;
+                s.fx = fp;
+                s.gx = dp;
+            }
+            return stpf;
+        }
+    };
+
+    // any of the searches above, for optimizers that take the line search as a parameter
+    template <typename LS, typename F, typename T>
+    concept LineSearchFor = FunctionGradient<F, T> &&
+        requires(LS& ls, F& fg, linalg::Vec<T>& x, T& f, linalg::Vec<T>& g, const linalg::Vec<T>& d, T step) {
+            { ls.search(fg, x, f, g, d, step) } -> std::same_as<LineSearchResult<T>>;
+        };
+}
+
 #endif //AXIOM_LINSEARCH_HPP
\ No newline at end of file
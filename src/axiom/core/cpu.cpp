@@ -0,0 +1,88 @@
+#include "axiom/core/cpu.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+#include "axiom/core/core.hpp"
+
+#if AXIOM_HAVE_X86_KERNELS && defined(_MSC_VER) && !defined(__clang__)
+  #include <intrin.h>
+  #include <immintrin.h>
+#endif
+
+namespace axiom::core {
+    namespace {
+        Isa detect() noexcept {
+#if AXIOM_HAVE_X86_KERNELS
+  #if defined(__GNUC__) || defined(__clang__)
+            // libgcc / compiler-rt also check that the OS saves the wider register state
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f")) return Isa::kAvx512;
+            if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return Isa::kAvx2;
+            if (__builtin_cpu_supports("sse2")) return Isa::kSse2;
+  #elif defined(_MSC_VER)
+            int info[4];
+            __cpuid(info, 0);
+            const int max_leaf = info[0];
+            __cpuid(info, 1);
+            const bool osxsave = (info[2] & (1 << 27)) != 0;
+            const bool fma = (info[2] & (1 << 12)) != 0;
+            const bool sse2 = (info[3] & (1 << 26)) != 0;
+            if (osxsave && max_leaf >= 7) {
+                const unsigned long long xcr0 = _xgetbv(0);
+                __cpuidex(info, 7, 0);
+                if ((info[1] & (1 << 16)) && (xcr0 & 0xE6) == 0xE6) return Isa::kAvx512;
+                if ((info[1] & (1 << 5)) && fma && (xcr0 & 0x6) == 0x6) return Isa::kAvx2;
+            }
+            if (sse2) return Isa::kSse2;
+  #endif
+#endif
+            return Isa::kScalar;
+        }
+
+        Isa cap_from_env(const Isa best) noexcept {
+            const char* env = std::getenv("AXIOM_ISA");
+            if (env == nullptr) return best;
+            Isa requested = best;
+            if (std::strcmp(env, "scalar") == 0) requested = Isa::kScalar;
+            else if (std::strcmp(env, "sse2") == 0) requested = Isa::kSse2;
+            else if (std::strcmp(env, "avx2") == 0) requested = Isa::kAvx2;
+            else if (std::strcmp(env, "avx512") == 0) requested = Isa::kAvx512;
+            return requested < best ? requested : best;
+        }
+
+        std::atomic<Isa>& active() noexcept {
+            static std::atomic<Isa> isa{cap_from_env(detected_isa())};
+            return isa;
+        }
+    }
+
+    Isa detected_isa() noexcept {
+        static const Isa isa = detect();
+        return isa;
+    }
+
+    Isa active_isa() noexcept {
+        return active().load(std::memory_order_relaxed);
+    }
+
+    void set_active_isa(const Isa isa) {
+        if (isa > detected_isa()) {
+            throw Error(ErrorCode::kInvalidArgument,
+                "set_active_isa(): isa is not supported by this cpu or build");
+        }
+        active().store(isa, std::memory_order_relaxed);
+    }
+
+    const char* isa_name(const Isa isa) noexcept {
+        switch (isa) {
+            case Isa::kScalar: return "scalar";
+            case Isa::kSse2: return "sse2";
+            case Isa::kAvx2: return "avx2";
+            case Isa::kAvx512: return "avx512";
+        }
+        return "unknown";
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,154 @@
+#include "axiom/core/memory.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <new>
+
+namespace axiom::core {
+    namespace {
+        struct Counters {
+            std::atomic<std::size_t> heap_allocations{0};
+            std::atomic<std::size_t> heap_deallocations{0};
+            std::atomic<std::size_t> heap_bytes{0};
+            std::atomic<std::size_t> arena_allocations{0};
+            std::atomic<std::size_t> arena_bytes{0};
+        };
+
+        Counters& counters() noexcept {
+            static Counters c;
+            return c;
+        }
+
+        void bump(std::atomic<std::size_t>& counter, const std::size_t by = 1) noexcept {
+            counter.fetch_add(by, std::memory_order_relaxed);
+        }
+
+        class AlignedResource final : public std::pmr::memory_resource {
+            void* do_allocate(const std::size_t bytes, const std::size_t alignment) override {
+                void* p = ::operator new(bytes, std::align_val_t{std::max(alignment, kAlignment)});
+                bump(counters().heap_allocations);
+                bump(counters().heap_bytes, bytes);
+                return p;
+            }
+
+            void do_deallocate(void* p, std::size_t, const std::size_t alignment) override {
+                ::operator delete(p, std::align_val_t{std::max(alignment, kAlignment)});
+                bump(counters().heap_deallocations);
+            }
+
+            bool do_is_equal(const memory_resource& other) const noexcept override {
+                return this == &other;
+            }
+        };
+
+        thread_local std::pmr::memory_resource* tls_resource = nullptr;
+
+        std::byte* align_up(std::byte* p, const std::size_t alignment) noexcept {
+            const auto v = reinterpret_cast<std::uintptr_t>(p);
+            return p + ((alignment - v % alignment) % alignment);
+        }
+    }
+
+    MemoryStats memory_stats() noexcept {
+        const Counters& c = counters();
+        return {c.heap_allocations.load(std::memory_order_relaxed),
+                c.heap_deallocations.load(std::memory_order_relaxed),
+                c.heap_bytes.load(std::memory_order_relaxed),
+                c.arena_allocations.load(std::memory_order_relaxed),
+                c.arena_bytes.load(std::memory_order_relaxed)};
+    }
+
+    void reset_memory_stats() noexcept {
+        Counters& c = counters();
+        c.heap_allocations.store(0, std::memory_order_relaxed);
+        c.heap_deallocations.store(0, std::memory_order_relaxed);
+        c.heap_bytes.store(0, std::memory_order_relaxed);
+        c.arena_allocations.store(0, std::memory_order_relaxed);
+        c.arena_bytes.store(0, std::memory_order_relaxed);
+    }
+
+    std::pmr::memory_resource* aligned_resource() noexcept {
+        static AlignedResource resource;
+        return &resource;
+    }
+
+    // chunk header, the usable bytes follow it (the header is one alignment unit long)
+    struct Arena::Chunk {
+        Chunk* next;
+        std::size_t bytes;
+
+        std::byte* begin() noexcept { return reinterpret_cast<std::byte*>(this) + kAlignment; }
+        std::byte* end() noexcept { return begin() + bytes; }
+    };
+
+    static_assert(sizeof(void*) * 2 <= kAlignment);
+
+    Arena::Arena(const std::size_t chunk_bytes) noexcept : chunk_bytes_(std::max(chunk_bytes, kAlignment)) {}
+
+    Arena::~Arena() { release(); }
+
+    void* Arena::do_allocate(const std::size_t bytes, const std::size_t alignment) {
+        std::byte* p = ptr_ ? align_up(ptr_, alignment) : nullptr;
+        if (!p || p > end_ || static_cast<std::size_t>(end_ - p) < bytes) p = next_chunk(bytes, alignment);
+        ptr_ = p + bytes;
+        bump(counters().arena_allocations);
+        bump(counters().arena_bytes, bytes);
+        return p;
+    }
+
+    // moves to the chunk after cur_, reusing it when it is big enough, else splices in a new one
+    std::byte* Arena::next_chunk(const std::size_t bytes, const std::size_t alignment) {
+        Chunk* next = cur_ ? cur_->next : head_;
+        const std::size_t need = bytes + (alignment > kAlignment ? alignment : 0);
+        if (!next || next->bytes < need) {
+            const std::size_t size = std::max({need, chunk_bytes_, capacity_});
+            auto* chunk = static_cast<Chunk*>(aligned_resource()->allocate(size + kAlignment, kAlignment));
+            chunk->next = next;
+            chunk->bytes = size;
+            if (cur_) cur_->next = chunk; else head_ = chunk;
+            capacity_ += size;
+            next = chunk;
+        }
+        cur_ = next;
+        end_ = cur_->end();
+        return align_up(cur_->begin(), alignment);
+    }
+
+    void Arena::rewind(const Mark m) noexcept {
+        cur_ = static_cast<Chunk*>(m.chunk);
+        ptr_ = m.ptr;
+        end_ = cur_ ? cur_->end() : nullptr;
+    }
+
+    void Arena::release() noexcept {
+        while (head_) {
+            Chunk* next = head_->next;
+            aligned_resource()->deallocate(head_, head_->bytes + kAlignment, kAlignment);
+            head_ = next;
+        }
+        cur_ = nullptr;
+        ptr_ = end_ = nullptr;
+        capacity_ = 0;
+    }
+
+    Arena& thread_arena() noexcept {
+        thread_local Arena arena;
+        return arena;
+    }
+
+    std::pmr::memory_resource* current_resource() noexcept {
+        return tls_resource ? tls_resource : aligned_resource();
+    }
+
+    ArenaScope::ArenaScope(Arena& arena) noexcept
+        : arena_(arena), mark_(arena.mark()), prev_(tls_resource) {
+        tls_resource = &arena;
+    }
+
+    ArenaScope::~ArenaScope() {
+        tls_resource = prev_;
+        arena_.rewind(mark_);
+    }
+
+}
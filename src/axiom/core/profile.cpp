@@ -0,0 +1,252 @@
+#include "axiom/core/profile.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+namespace axiom::core::profile {
+#if AXIOM_ENABLE_PROFILING
+    namespace {
+        struct Event {
+            const char* name;
+            std::uint64_t begin;        // ns since the epoch below
+            std::uint64_t duration;
+            double flops;
+            double bytes;
+            index allocations;
+        };
+
+        struct Accumulator {
+            index calls = 0;
+            std::uint64_t total = 0, min = ~std::uint64_t{0}, max = 0;
+            double flops = 0.0, bytes = 0.0;
+            index allocations = 0;
+            std::size_t alloc_bytes = 0;
+        };
+
+        // one per thread, the owner only contends with snapshot() / reset()
+        struct ThreadBuffer {
+            std::mutex mutex;
+            std::uint32_t tid = 0;
+            std::unordered_map<const char*, Accumulator> stats;
+            std::vector<Event> events;
+            index dropped = 0;
+            index loose_allocations = 0;       // made outside any scope
+            std::size_t loose_bytes = 0;
+        };
+
+        struct Registry {
+            std::mutex mutex;
+            std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+            const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+        };
+
+        Registry& registry() {
+            static Registry r;
+            return r;
+        }
+
+        ThreadBuffer& buffer() {
+            thread_local const std::shared_ptr<ThreadBuffer> tls = [] {
+                auto b = std::make_shared<ThreadBuffer>();
+                Registry& r = registry();
+                const std::lock_guard<std::mutex> lock(r.mutex);
+                b->tid = static_cast<std::uint32_t>(r.buffers.size());
+                r.buffers.push_back(b);
+                return b;
+            }();
+            return *tls;
+        }
+
+        std::uint64_t now() noexcept {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - registry().epoch).count();
+        }
+
+        thread_local detail::Scope* tls_scope = nullptr;
+
+        std::string escape(const char* s) {
+            std::string out;
+            for (; *s; ++s) {
+                if (*s == '"' || *s == '\\') out += '\\';
+                out += *s;
+            }
+            return out;
+        }
+    }
+
+    namespace detail {
+        Scope::Scope(const char* name, const double flops, const double bytes) noexcept
+            : name_(name), begin_(now()), flops_(flops), bytes_(bytes), parent_(tls_scope) {
+            tls_scope = this;
+        }
+
+        Scope::~Scope() {
+            const std::uint64_t duration = now() - begin_;
+            tls_scope = parent_;
+            if (parent_) {
+                parent_->allocations_ += allocations_;
+                parent_->alloc_bytes_ += alloc_bytes_;
+            }
+
+            // recording allocates (a thread's first scope, a new name, a growing event buffer), if
+            // that fails the call is lost instead of throwing out of a destructor
+            try {
+                ThreadBuffer& b = buffer();
+                const std::lock_guard<std::mutex> lock(b.mutex);
+                Accumulator& a = b.stats[name_];
+                ++a.calls;
+                a.total += duration;
+                a.min = std::min(a.min, duration);
+                a.max = std::max(a.max, duration);
+                a.flops += flops_;
+                a.bytes += bytes_;
+                a.allocations += allocations_;
+                a.alloc_bytes += alloc_bytes_;
+                if (b.events.size() < kMaxEventsPerThread) {
+                    b.events.push_back({name_, begin_, duration, flops_, bytes_, allocations_});
+                } else {
+                    ++b.dropped;
+                }
+            } catch (...) {
+            }
+        }
+
+        void record_alloc(const std::size_t bytes) {
+            if (Scope* s = tls_scope) {
+                ++s->allocations_;
+                s->alloc_bytes_ += bytes;
+                return;
+            }
+            ThreadBuffer& b = buffer();
+            const std::lock_guard<std::mutex> lock(b.mutex);
+            ++b.loose_allocations;
+            b.loose_bytes += bytes;
+        }
+    }
+
+    std::vector<Stats> snapshot() {
+        std::map<std::string, Stats> merged;
+        Registry& r = registry();
+        const std::lock_guard<std::mutex> lock(r.mutex);
+        for (const auto& b : r.buffers) {
+            const std::lock_guard<std::mutex> buffer_lock(b->mutex);
+            for (const auto& [name, a] : b->stats) {
+                Stats& s = merged[name];
+                const double min = static_cast<double>(a.min) * 1e-9, max = static_cast<double>(a.max) * 1e-9;
+                s.min_seconds = s.calls == 0 ? min : std::min(s.min_seconds, min);
+                s.max_seconds = std::max(s.max_seconds, max);
+                s.calls += a.calls;
+                s.seconds += static_cast<double>(a.total) * 1e-9;
+                s.flops += a.flops;
+                s.bytes += a.bytes;
+                s.allocations += a.allocations;
+                s.alloc_bytes += a.alloc_bytes;
+                ++s.threads;
+            }
+        }
+        std::vector<Stats> out;
+        out.reserve(merged.size());
+        for (auto& [name, s] : merged) {
+            s.name = name;
+            out.push_back(std::move(s));
+        }
+        std::stable_sort(out.begin(), out.end(), [](const Stats& a, const Stats& b) { return a.seconds > b.seconds; });
+        return out;
+    }
+
+    std::string summary() {
+        const std::vector<Stats> stats = snapshot();
+        index loose = 0, dropped = 0;
+        std::size_t loose_bytes = 0;
+        {
+            Registry& r = registry();
+            const std::lock_guard<std::mutex> lock(r.mutex);
+            for (const auto& b : r.buffers) {
+                const std::lock_guard<std::mutex> buffer_lock(b->mutex);
+                loose += b->loose_allocations;
+                loose_bytes += b->loose_bytes;
+                dropped += b->dropped;
+            }
+        }
+
+        std::ostringstream out;
+        char line[256];
+        std::snprintf(line, sizeof line, "%-32s %10s %12s %11s %11s %11s %9s %9s %8s %10s\n", "scope", "calls",
+                      "total ms", "mean us", "min us", "max us", "GFLOP/s", "GB/s", "allocs", "alloc KiB");
+        out << line;
+        for (const Stats& s : stats) {
+            const double per_s = s.seconds > 0.0 ? 1e-9 / s.seconds : 0.0;
+            std::snprintf(line, sizeof line, "%-32s %10zu %12.3f %11.3f %11.3f %11.3f %9.2f %9.2f %8zu %10.1f\n",
+                          s.name.c_str(), static_cast<std::size_t>(s.calls), s.seconds * 1e3,
+                          s.seconds / static_cast<double>(s.calls) * 1e6, s.min_seconds * 1e6, s.max_seconds * 1e6,
+                          s.flops * per_s, s.bytes * per_s, static_cast<std::size_t>(s.allocations),
+                          static_cast<double>(s.alloc_bytes) / 1024.0);
+            out << line;
+        }
+        if (loose > 0) {
+            std::snprintf(line, sizeof line, "%zu allocation(s), %.1f KiB outside any scope\n",
+                          static_cast<std::size_t>(loose), static_cast<double>(loose_bytes) / 1024.0);
+            out << line;
+        }
+        if (dropped > 0) out << dropped << " trace event(s) dropped past kMaxEventsPerThread\n";
+        return out.str();
+    }
+
+    void write_chrome_trace(const std::string& path) {
+        std::ofstream out(path);
+        if (!out) throw Error(ErrorCode::kInvalidArgument, "write_chrome_trace(): cannot open " + path);
+        out << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+        bool first = true;
+        char num[64];
+        Registry& r = registry();
+        const std::lock_guard<std::mutex> lock(r.mutex);
+        for (const auto& b : r.buffers) {
+            const std::lock_guard<std::mutex> buffer_lock(b->mutex);
+            out << (first ? "\n" : ",\n") << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": "
+                << b->tid << ", \"args\": {\"name\": \"axiom thread " << b->tid << "\"}}";
+            first = false;
+            for (const Event& e : b->events) {
+                std::snprintf(num, sizeof num, "%.3f, \"dur\": %.3f", static_cast<double>(e.begin) * 1e-3,
+                              static_cast<double>(e.duration) * 1e-3);
+                out << ",\n{\"name\": \"" << escape(e.name) << "\", \"ph\": \"X\", \"pid\": 1, \"tid\": " << b->tid
+                    << ", \"ts\": " << num << ", \"args\": {\"flops\": " << e.flops << ", \"bytes\": " << e.bytes
+                    << ", \"allocations\": " << e.allocations << "}}";
+            }
+        }
+        out << "\n]}\n";
+        if (!out) throw Error(ErrorCode::kInvalidArgument, "write_chrome_trace(): failed writing " + path);
+    }
+
+    void reset() {
+        Registry& r = registry();
+        const std::lock_guard<std::mutex> lock(r.mutex);
+        for (const auto& b : r.buffers) {
+            const std::lock_guard<std::mutex> buffer_lock(b->mutex);
+            b->stats.clear();
+            b->events.clear();
+            b->dropped = 0;
+            b->loose_allocations = 0;
+            b->loose_bytes = 0;
+        }
+    }
+#else
+    std::vector<Stats> snapshot() { return {}; }
+
+    std::string summary() { return "profiling disabled (build with AXIOM_ENABLE_PROFILING=1)\n"; }
+
+    void write_chrome_trace(const std::string& path) {
+        std::ofstream out(path);
+        if (!out) throw Error(ErrorCode::kInvalidArgument, "write_chrome_trace(): cannot open " + path);
+        out << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": []}\n";
+    }
+
+    void reset() {}
+#endif
+}
\ No newline at end of file
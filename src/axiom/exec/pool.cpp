@@ -0,0 +1,219 @@
+#include "axiom/exec/pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "axiom/core/parallel.hpp"
+#include "axiom/core/profile.hpp"
+
+namespace axiom::exec {
+    namespace {
+        thread_local bool tls_in_job = false;
+
+        struct Range {
+            core::index lo = 0, hi = 0;
+        };
+
+        // the one range a participant offers to thieves, refilled by its owner when empty
+        struct alignas(64) Slot {
+            std::mutex mutex;
+            Range range;
+            std::atomic<bool> full{false};
+
+            void put(const Range r) {
+                const std::lock_guard<std::mutex> lock(mutex);
+                range = r;
+                full.store(true, std::memory_order_release);
+            }
+
+            bool take(Range& r) {
+                if (!full.load(std::memory_order_acquire)) return false;
+                const std::lock_guard<std::mutex> lock(mutex);
+                if (!full.load(std::memory_order_relaxed)) return false;
+                r = range;
+                full.store(false, std::memory_order_release);
+                return true;
+            }
+        };
+
+        struct InJob {
+            bool saved = tls_in_job;
+            InJob() noexcept { tls_in_job = true; }
+            ~InJob() { tls_in_job = saved; }
+        };
+    }
+
+    struct ThreadPool::Impl {
+        std::vector<std::unique_ptr<Slot>> slots;   // slot 0 belongs to the calling thread
+        std::vector<std::thread> workers;           // worker w is participant w + 1
+        std::atomic<core::index> size{0};
+
+        std::mutex run_mutex;                       // one job at a time
+        std::mutex wake_mutex;
+        std::condition_variable wake;
+        std::condition_variable done;
+        std::uint64_t generation = 0;
+        core::index busy = 0;                       // workers still inside the current job
+        bool stop = false;
+
+        // current job
+        RangeFn fn = nullptr;
+        void* ctx = nullptr;
+        core::index grain = 1;
+        core::index participants = 1;
+        std::atomic<core::index> remaining{0};
+        std::atomic<bool> failed{false};
+        std::exception_ptr error;
+        std::mutex error_mutex;
+
+        std::atomic<core::index> steals{0};
+
+        void execute(Range r, const core::index id) {
+            Slot& own = *slots[id];
+            while (r.lo < r.hi) {
+                if (r.hi - r.lo > grain && !own.full.load(std::memory_order_relaxed)) {
+                    const core::index mid = r.lo + (r.hi - r.lo) / 2;
+                    own.put({mid, r.hi});
+                    r.hi = mid;
+                    continue;
+                }
+                const core::index hi = std::min(r.hi, r.lo + grain);
+                if (!failed.load(std::memory_order_relaxed)) {
+                    try {
+                        fn(ctx, r.lo, hi, id);
+                    } catch (...) {
+                        const std::lock_guard<std::mutex> lock(error_mutex);
+                        if (!error) error = std::current_exception();
+                        failed.store(true, std::memory_order_relaxed);
+                    }
+                }
+                remaining.fetch_sub(hi - r.lo, std::memory_order_acq_rel);
+                r.lo = hi;
+            }
+        }
+
+        bool steal(Range& r, const core::index id) {
+            for (core::index k = 1; k < participants; ++k) {
+                if (slots[(id + k) % participants]->take(r)) {
+                    steals.fetch_add(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void work(const core::index id) {
+            const InJob scope;
+            Range r;
+            while (remaining.load(std::memory_order_acquire) > 0) {
+                if (slots[id]->take(r) || steal(r, id)) execute(r, id);
+                else std::this_thread::yield();
+            }
+        }
+
+        void worker_loop(const core::index id, std::uint64_t seen) {
+            for (;;) {
+                {
+                    std::unique_lock<std::mutex> lock(wake_mutex);
+                    wake.wait(lock, [&] { return stop || generation != seen; });
+                    if (stop) return;
+                    seen = generation;
+                    if (id >= participants) continue;
+                }
+                work(id);
+                {
+                    const std::lock_guard<std::mutex> lock(wake_mutex);
+                    if (--busy == 0) done.notify_one();
+                }
+            }
+        }
+
+        void grow(const core::index threads) {
+            while (static_cast<core::index>(slots.size()) < threads) {
+                slots.push_back(std::make_unique<Slot>());
+                const core::index id = slots.size() - 1;
+                workers.emplace_back([this, id, seen = generation] { worker_loop(id, seen); });
+            }
+            size.store(slots.size(), std::memory_order_release);
+        }
+    };
+
+    ThreadPool::ThreadPool(const core::index threads) : impl_(std::make_unique<Impl>()) {
+        impl_->slots.push_back(std::make_unique<Slot>());
+        impl_->grow(threads == 0 ? core::hardware_threads() : threads);
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            const std::lock_guard<std::mutex> lock(impl_->wake_mutex);
+            impl_->stop = true;
+        }
+        impl_->wake.notify_all();
+        for (auto& w : impl_->workers) w.join();
+    }
+
+    core::index ThreadPool::size() const noexcept {
+        return impl_->size.load(std::memory_order_acquire);
+    }
+
+    void ThreadPool::reserve(const core::index threads) {
+        if (tls_in_job) return;
+        const std::lock_guard<std::mutex> lock(impl_->run_mutex);
+        impl_->grow(threads);
+    }
+
+    core::index ThreadPool::steals() const noexcept {
+        return impl_->steals.load(std::memory_order_relaxed);
+    }
+
+    ThreadPool& ThreadPool::global() {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    bool ThreadPool::in_job() noexcept { return tls_in_job; }
+
+    void ThreadPool::run_ranges(const core::index n, core::index grain, core::index threads, const RangeFn fn,
+                                void* ctx) {
+        if (n == 0) return;
+        grain = std::max<core::index>(grain, 1);
+        if (threads == 0) threads = size();
+        threads = std::min(threads, (n + grain - 1) / grain);
+        if (threads <= 1 || tls_in_job) {
+            for (core::index lo = 0; lo < n; lo += grain) fn(ctx, lo, std::min(n, lo + grain), 0);
+            return;
+        }
+
+        AXIOM_PROFILE_SCOPE("exec::ThreadPool::run");
+        Impl& p = *impl_;
+        const std::lock_guard<std::mutex> run_lock(p.run_mutex);
+        p.grow(threads);
+        p.fn = fn;
+        p.ctx = ctx;
+        p.grain = grain;
+        p.failed.store(false, std::memory_order_relaxed);
+        p.error = nullptr;
+        p.remaining.store(n, std::memory_order_relaxed);
+        for (core::index t = 0; t < threads; ++t) p.slots[t]->put({n * t / threads, n * (t + 1) / threads});
+        {
+            const std::lock_guard<std::mutex> lock(p.wake_mutex);
+            p.participants = threads;
+            p.busy = threads - 1;
+            ++p.generation;
+        }
+        p.wake.notify_all();
+        p.work(0);
+        {
+            std::unique_lock<std::mutex> lock(p.wake_mutex);
+            p.done.wait(lock, [&] { return p.busy == 0; });
+        }
+        if (p.error) std::rethrow_exception(p.error);
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,186 @@
+#include "axiom/io/binary.hpp"
+
+#include <bit>
+#include <cstring>
+
+#if defined(_WIN32)
+  #ifndef NOMINMAX
+    #define NOMINMAX
+  #endif
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+namespace axiom::io {
+    namespace {
+        constexpr char kMagic[8] = {'A', 'X', 'I', 'O', 'M', 'M', 'A', 'T'};
+        constexpr std::uint32_t kVersion = 1;
+        constexpr std::size_t kHeaderSize = 64;
+
+        [[noreturn]] void fail(const std::string& msg) {
+            throw core::Error(core::ErrorCode::kIoError, msg);
+        }
+
+        template <typename U>
+        void put(std::string& out, const std::size_t at, const U value) {
+            std::memcpy(out.data() + at, &value, sizeof(U));
+        }
+
+        template <typename U>
+        U get(const std::byte* p, const std::size_t at) {
+            U value;
+            std::memcpy(&value, p + at, sizeof(U));
+            return value;
+        }
+    }
+
+    std::size_t dtype_size(const DType dtype) {
+        switch (dtype) {
+            case DType::kFloat32: return sizeof(float);
+            case DType::kFloat64: return sizeof(double);
+        }
+        throw core::Error(core::ErrorCode::kInvalidArgument, "dtype_size(): unknown dtype");
+    }
+
+    const char* dtype_name(const DType dtype) {
+        switch (dtype) {
+            case DType::kFloat32: return "float32";
+            case DType::kFloat64: return "float64";
+        }
+        return "unknown";
+    }
+
+#if defined(_WIN32)
+    MappedFile::MappedFile(const std::string& path) : path_(path) {
+        const HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                        FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) fail("MappedFile(): cannot open " + path);
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size)) {
+            CloseHandle(file);
+            fail("MappedFile(): cannot stat " + path);
+        }
+        size_ = static_cast<std::size_t>(size.QuadPart);
+        if (size_ == 0) {
+            CloseHandle(file);
+            return;
+        }
+        handle_ = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (!handle_) fail("MappedFile(): cannot map " + path);
+        data_ = static_cast<const std::byte*>(MapViewOfFile(handle_, FILE_MAP_READ, 0, 0, 0));
+        if (!data_) {
+            CloseHandle(handle_);
+            fail("MappedFile(): cannot map " + path);
+        }
+    }
+
+    MappedFile::~MappedFile() {
+        if (data_) UnmapViewOfFile(data_);
+        if (handle_) CloseHandle(handle_);
+    }
+#else
+    MappedFile::MappedFile(const std::string& path) : path_(path) {
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) fail("MappedFile(): cannot open " + path);
+        struct stat st {};
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            fail("MappedFile(): cannot stat " + path);
+        }
+        size_ = static_cast<std::size_t>(st.st_size);
+        if (size_ == 0) {
+            ::close(fd);
+            return;
+        }
+        void* p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);            // the mapping holds its own reference
+        if (p == MAP_FAILED) fail("MappedFile(): cannot map " + path);
+        data_ = static_cast<const std::byte*>(p);
+    }
+
+    MappedFile::~MappedFile() {
+        if (data_) ::munmap(const_cast<std::byte*>(data_), size_);
+    }
+#endif
+
+    namespace detail {
+        void check_array(const MappedFile& file, const ArrayInfo& info, const char* fn) {
+            if (info.rows == 0 || info.cols == 0) {
+                throw core::Error(core::ErrorCode::kInvalidArgument,
+                                  std::string(fn) + ": " + file.path() + " holds an empty array");
+            }
+            // the span (rows - 1) * row_stride + (cols - 1) * col_stride + 1 must fit in the elements
+            // after offset, checked term by term since rows / cols come straight from the file
+            const auto truncated = [&] { fail(std::string(fn) + ": " + file.path() + " is truncated"); };
+            if (info.offset > file.size()) truncated();
+            const std::size_t avail = (file.size() - info.offset) / dtype_size(info.dtype);
+            if (avail == 0) truncated();
+            if (info.col_stride != 0 && info.cols - 1 > (avail - 1) / info.col_stride) truncated();
+            const std::size_t rest = avail - 1 - (info.cols - 1) * info.col_stride;
+            if (info.row_stride != 0 && info.rows - 1 > rest / info.row_stride) truncated();
+        }
+
+        std::string axm_header(const DType dtype, const core::index rows, const core::index cols) {
+            if constexpr (std::endian::native != std::endian::little) {
+                fail("save_matrix(): big-endian hosts are not supported");
+            }
+            std::string h(kHeaderSize, '\0');
+            std::memcpy(h.data(), kMagic, sizeof kMagic);
+            put<std::uint32_t>(h, 8, kVersion);
+            put<std::uint32_t>(h, 12, static_cast<std::uint32_t>(dtype));
+            put<std::uint64_t>(h, 16, rows);
+            put<std::uint64_t>(h, 24, cols);
+            put<std::uint64_t>(h, 32, kHeaderSize);
+            put<std::uint64_t>(h, 40, core::kAlignment);
+            return h;
+        }
+
+        ArrayInfo parse_axm(const MappedFile& file) {
+            const std::string& path = file.path();
+            if constexpr (std::endian::native != std::endian::little) {
+                fail("load_matrix(): big-endian hosts are not supported");
+            }
+            const std::byte* p = file.data();
+            if (file.size() < kHeaderSize || std::memcmp(p, kMagic, sizeof kMagic) != 0) {
+                fail(path + " is not an axiom matrix file");
+            }
+            if (get<std::uint32_t>(p, 8) != kVersion) fail(path + ": unsupported format version");
+
+            ArrayInfo info;
+            const auto dtype = get<std::uint32_t>(p, 12);
+            if (dtype != static_cast<std::uint32_t>(DType::kFloat32) && dtype != static_cast<std::uint32_t>(DType::kFloat64)) {
+                fail(path + ": unknown dtype " + std::to_string(dtype));
+            }
+            info.dtype = static_cast<DType>(dtype);
+            info.rows = get<std::uint64_t>(p, 16);
+            info.cols = get<std::uint64_t>(p, 24);
+            info.row_stride = info.cols;
+            info.offset = get<std::uint64_t>(p, 32);
+            if (info.offset < kHeaderSize || info.offset % dtype_size(info.dtype) != 0) {
+                fail(path + ": bad data offset");
+            }
+            return info;
+        }
+
+        std::ofstream open_for_write(const std::string& path, const char* fn) {
+            std::ofstream out(path, std::ios::binary | std::ios::trunc);
+            if (!out) fail(std::string(fn) + ": cannot open " + path);
+            return out;
+        }
+
+        void finish_write(std::ofstream& out, const std::string& path, const char* fn) {
+            out.close();
+            if (!out) fail(std::string(fn) + ": failed writing " + path);
+        }
+    }
+
+    ArrayInfo read_matrix_info(const std::string& path) {
+        return detail::parse_axm(MappedFile(path));
+    }
+
+}
@@ -0,0 +1,179 @@
+#include "axiom/io/npy.hpp"
+
+#include <bit>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+namespace axiom::io {
+    namespace {
+        constexpr char kMagic[6] = {'\x93', 'N', 'U', 'M', 'P', 'Y'};
+
+        [[noreturn]] void fail(const std::string& path, const std::string& msg) {
+            throw core::Error(core::ErrorCode::kIoError, path + ": " + msg);
+        }
+
+        // the header is a Python dict literal, only the three keys numpy writes are read
+        class HeaderParser {
+        public:
+            HeaderParser(const std::string_view text, const std::string& path) : s_(text), path_(path) {}
+
+            // position just past `'key':`
+            void seek(const std::string_view key) {
+                const std::string quoted = "'" + std::string(key) + "'";
+                i_ = s_.find(quoted);
+                if (i_ == std::string_view::npos) fail(path_, "npy header has no " + quoted);
+                i_ += quoted.size();
+                skip_space();
+                if (i_ >= s_.size() || s_[i_] != ':') fail(path_, "malformed npy header");
+                ++i_;
+                skip_space();
+            }
+
+            std::string_view string() {
+                if (i_ >= s_.size() || (s_[i_] != '\'' && s_[i_] != '"')) fail(path_, "malformed npy header");
+                const char quote = s_[i_++];
+                const std::size_t end = s_.find(quote, i_);
+                if (end == std::string_view::npos) fail(path_, "malformed npy header");
+                const std::string_view out = s_.substr(i_, end - i_);
+                i_ = end + 1;
+                return out;
+            }
+
+            bool boolean() {
+                if (s_.substr(i_, 4) == "True") return true;
+                if (s_.substr(i_, 5) == "False") return false;
+                fail(path_, "malformed npy header");
+            }
+
+            std::vector<core::index> tuple() {
+                std::vector<core::index> dims;
+                if (i_ >= s_.size() || s_[i_] != '(') fail(path_, "malformed npy header");
+                ++i_;
+                for (;;) {
+                    skip_space();
+                    if (i_ < s_.size() && s_[i_] == ')') break;
+                    if (i_ >= s_.size() || !std::isdigit(static_cast<unsigned char>(s_[i_]))) {
+                        fail(path_, "malformed npy shape");
+                    }
+                    core::index d = 0;
+                    while (i_ < s_.size() && std::isdigit(static_cast<unsigned char>(s_[i_]))) {
+                        const auto digit = static_cast<core::index>(s_[i_++] - '0');
+                        if (d > (std::numeric_limits<core::index>::max() - digit) / 10) {
+                            fail(path_, "npy shape out of range");
+                        }
+                        d = d * 10 + digit;
+                    }
+                    dims.push_back(d);
+                    skip_space();
+                    if (i_ < s_.size() && s_[i_] == ',') ++i_;
+                }
+                return dims;
+            }
+
+        private:
+            std::string_view s_;
+            const std::string& path_;
+            std::size_t i_ = 0;
+
+            void skip_space() {
+                while (i_ < s_.size() && std::isspace(static_cast<unsigned char>(s_[i_]))) ++i_;
+            }
+        };
+
+        DType parse_descr(const std::string_view descr, const std::string& path) {
+            // '<' little-endian, '=' native, '|' not applicable (1-byte types)
+            const bool little = std::endian::native == std::endian::little;
+            if (descr.size() == 3 && (descr[0] == '<' || descr[0] == '=') && little && descr[1] == 'f') {
+                if (descr[2] == '4') return DType::kFloat32;
+                if (descr[2] == '8') return DType::kFloat64;
+            }
+            fail(path, "unsupported npy dtype '" + std::string(descr) + "', expected float32 or float64");
+        }
+    }
+
+    namespace detail {
+        std::string npy_header(const DType dtype, const core::index rows, const core::index cols,
+                               const core::index ndim) {
+            if constexpr (std::endian::native != std::endian::little) {
+                throw core::Error(core::ErrorCode::kIoError, "save_npy(): big-endian hosts are not supported");
+            }
+            std::string dict = "{'descr': '<f";
+            dict += dtype == DType::kFloat32 ? "4" : "8";
+            dict += "', 'fortran_order': False, 'shape': (" + std::to_string(rows);
+            dict += ndim == 1 ? ",), }" : ", " + std::to_string(cols) + "), }";
+
+            // magic (6) + version (2) + length (2) + dict + padding + '\n', a multiple of 64
+            constexpr std::size_t kPreamble = 10;
+            const std::size_t total = (kPreamble + dict.size() + 1 + core::kAlignment - 1)
+                                      / core::kAlignment * core::kAlignment;
+            dict.append(total - kPreamble - dict.size() - 1, ' ');
+            dict += '\n';
+            if (dict.size() > 0xffff) {
+                throw core::Error(core::ErrorCode::kInvalidArgument, "save_npy(): header too long");
+            }
+
+            std::string out(kMagic, sizeof kMagic);
+            out += '\x01';
+            out += '\x00';
+            out += static_cast<char>(dict.size() & 0xff);
+            out += static_cast<char>(dict.size() >> 8);
+            return out + dict;
+        }
+
+        ArrayInfo parse_npy(const MappedFile& file) {
+            const std::string& path = file.path();
+            const auto* p = reinterpret_cast<const unsigned char*>(file.data());
+            if (file.size() < 10 || std::memcmp(p, kMagic, sizeof kMagic) != 0) fail(path, "not an npy file");
+
+            // 1.0 has a 2-byte header length, 2.0 and 3.0 (utf-8 header) a 4-byte one
+            const unsigned major = p[6];
+            std::size_t length = 0, preamble = 0;
+            if (major == 1) {
+                length = p[8] | static_cast<std::size_t>(p[9]) << 8;
+                preamble = 10;
+            } else if (major == 2 || major == 3) {
+                if (file.size() < 12) fail(path, "truncated npy header");
+                length = p[8] | static_cast<std::size_t>(p[9]) << 8 | static_cast<std::size_t>(p[10]) << 16
+                         | static_cast<std::size_t>(p[11]) << 24;
+                preamble = 12;
+            } else {
+                fail(path, "unsupported npy version " + std::to_string(major));
+            }
+            if (length > file.size() - preamble) fail(path, "truncated npy header");
+
+            HeaderParser header({reinterpret_cast<const char*>(p) + preamble, length}, path);
+            ArrayInfo info;
+            header.seek("descr");
+            info.dtype = parse_descr(header.string(), path);
+            header.seek("fortran_order");
+            const bool fortran = header.boolean();
+            header.seek("shape");
+            const std::vector<core::index> shape = header.tuple();
+            if (shape.empty() || shape.size() > 2) {
+                fail(path, "npy arrays of " + std::to_string(shape.size()) + " dimensions are not supported");
+            }
+
+            info.ndim = shape.size();
+            info.rows = shape[0];
+            info.cols = shape.size() == 2 ? shape[1] : 1;
+            info.offset = preamble + length;
+            if (fortran) {
+                info.row_stride = 1;
+                info.col_stride = info.rows;
+            } else {
+                info.row_stride = info.cols;
+                info.col_stride = 1;
+            }
+            return info;
+        }
+    }
+
+    ArrayInfo read_npy_info(const std::string& path) {
+        return detail::parse_npy(MappedFile(path));
+    }
+
+}
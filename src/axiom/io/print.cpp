@@ -0,0 +1,106 @@
+#include "axiom/io/print.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <vector>
+
+namespace axiom::io {
+    namespace {
+        template <typename T>
+        void append_value(std::string& out, const T value, const PrintOptions& options) {
+            char buf[64];
+            const auto [end, ec] = options.precision < 0
+                ? std::to_chars(buf, buf + sizeof buf, value, options.format)
+                : std::to_chars(buf, buf + sizeof buf, value, options.format, options.precision);
+            if (ec != std::errc{}) {
+                // only a huge fixed-format precision overflows the buffer
+                out += std::to_string(value);
+                return;
+            }
+            out.append(buf, end);
+        }
+
+        // the indices printed along one axis, kSkip marks the "..." gap
+        constexpr core::index kSkip = core::dynamic;
+
+        std::vector<core::index> shown(const core::index n, const core::index edge) {
+            std::vector<core::index> idx;
+            if (edge == 0 || n <= 2 * edge) {
+                idx.resize(n);
+                for (core::index i = 0; i < n; ++i) idx[i] = i;
+                return idx;
+            }
+            for (core::index i = 0; i < edge; ++i) idx.push_back(i);
+            idx.push_back(kSkip);
+            for (core::index i = n - edge; i < n; ++i) idx.push_back(i);
+            return idx;
+        }
+
+        template <typename T>
+        void append_rows(std::string& out, const linalg::MatView<const T>& m, const std::vector<core::index>& rows,
+                         const std::vector<core::index>& cols, const PrintOptions& options) {
+            for (const core::index r : rows) {
+                for (std::size_t k = 0; k < cols.size(); ++k) {
+                    if (k > 0) out += options.delimiter;
+                    if (r == kSkip || cols[k] == kSkip) out += "...";
+                    else append_value(out, m(r, cols[k]), options);
+                }
+                out += '\n';
+            }
+        }
+
+        // rows formatted per task, each block into its own string, joined in order
+        constexpr core::index kPrintBlock = 64;
+
+        template <exec::ExecutionPolicy P, typename T>
+        void append_matrix(const P& policy, std::string& out, const linalg::MatView<const T>& m,
+                           const PrintOptions& options) {
+            const std::vector<core::index> rows = shown(m.rows(), options.edge_items);
+            const std::vector<core::index> cols = shown(m.cols(), options.edge_items);
+            const core::index blocks = (rows.size() + kPrintBlock - 1) / kPrintBlock;
+            if (std::same_as<P, exec::Sequential> || blocks < 2) {
+                out.reserve(out.size() + rows.size() * cols.size() * 12);
+                append_rows(out, m, rows, cols, options);
+                return;
+            }
+
+            std::vector<std::string> parts(blocks);
+            exec::parallel_for(exec::in_units(policy, kPrintBlock * cols.size()), blocks,
+                               [&](const core::index lo, const core::index hi) {
+                for (core::index b = lo; b < hi; ++b) {
+                    const auto first = rows.begin() + static_cast<std::ptrdiff_t>(b * kPrintBlock);
+                    const auto last = rows.begin() + static_cast<std::ptrdiff_t>(std::min((b + 1) * kPrintBlock, rows.size()));
+                    append_rows(parts[b], m, std::vector<core::index>(first, last), cols, options);
+                }
+            });
+            std::size_t total = out.size();
+            for (const auto& p : parts) total += p.size();
+            out.reserve(total);
+            for (const auto& p : parts) out += p;
+        }
+    }
+
+    void append(std::string& out, const double value, const PrintOptions& options) {
+        append_value(out, value, options);
+    }
+
+    void append(std::string& out, const float value, const PrintOptions& options) {
+        append_value(out, value, options);
+    }
+
+    template <exec::ExecutionPolicy P>
+    void append(const P& policy, std::string& out, const linalg::MatView<const double>& m, const PrintOptions& options) {
+        append_matrix(policy, out, m, options);
+    }
+
+    template <exec::ExecutionPolicy P>
+    void append(const P& policy, std::string& out, const linalg::MatView<const float>& m, const PrintOptions& options) {
+        append_matrix(policy, out, m, options);
+    }
+
+    template void append(const exec::Sequential&, std::string&, const linalg::MatView<const double>&, const PrintOptions&);
+    template void append(const exec::Parallel&, std::string&, const linalg::MatView<const double>&, const PrintOptions&);
+    template void append(const exec::Sequential&, std::string&, const linalg::MatView<const float>&, const PrintOptions&);
+    template void append(const exec::Parallel&, std::string&, const linalg::MatView<const float>&, const PrintOptions&);
+
+}
@@ -0,0 +1,490 @@
+#include "axiom/io/text.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#include "axiom/exec/exec.hpp"
+#include "axiom/io/binary.hpp"
+
+namespace axiom::io {
+    namespace {
+        [[noreturn]] void fail(const std::string& msg) {
+            throw core::Error(core::ErrorCode::kIoError, msg);
+        }
+
+        [[noreturn]] void fail_line(const char* fn, const core::index line, const std::string& msg) {
+            fail(std::string(fn) + ": line " + std::to_string(line) + ": " + msg);
+        }
+
+        bool blank(const char c) noexcept { return c == ' ' || c == '\t' || c == '\r'; }
+
+        std::string_view trim(std::string_view s) noexcept {
+            while (!s.empty() && blank(s.front())) s.remove_prefix(1);
+            while (!s.empty() && blank(s.back())) s.remove_suffix(1);
+            return s;
+        }
+
+        // calls f(line) for every line of s without the '\n'
+        template <typename F>
+        void for_each_line(std::string_view s, F&& f) {
+            while (!s.empty()) {
+                const auto* nl = static_cast<const char*>(std::memchr(s.data(), '\n', s.size()));
+                const std::size_t len = nl ? static_cast<std::size_t>(nl - s.data()) : s.size();
+                f(s.substr(0, len));
+                s.remove_prefix(nl ? len + 1 : len);
+            }
+        }
+
+        // s without its first line
+        std::string_view drop_line(const std::string_view s) noexcept {
+            const std::size_t nl = s.find('\n');
+            return nl == std::string_view::npos ? std::string_view{} : s.substr(nl + 1);
+        }
+
+        // a slice of the text starting at a line, with the line number of its first line and the
+        // number of records in it (set by the counting pass)
+        struct Chunk {
+            std::string_view text;
+            core::index first_line = 0;
+            core::index records = 0;
+            core::index first_record = 0;
+        };
+
+        // text is cut into chunks of about kChunkBytes, the policy's min_size / grain are bytes
+        constexpr std::size_t kChunkBytes = std::size_t{1} << 16;
+
+        // f(c) for every chunk, ranges of chunks on the pool
+        template <exec::ExecutionPolicy P, typename F>
+        void for_each_chunk(const P& policy, const std::vector<Chunk>& chunks, F&& f) {
+            exec::parallel_for(exec::in_units(policy, kChunkBytes), chunks.size(),
+                               [&](const core::index lo, const core::index hi) {
+                for (core::index c = lo; c < hi; ++c) f(c);
+            });
+        }
+
+        // splits text at line boundaries into chunks of about kChunkBytes, counts the records
+        // (lines for which is_record is true) of every chunk in parallel and numbers them
+        template <exec::ExecutionPolicy P, typename R>
+        std::vector<Chunk> split(const P& policy, const std::string_view text, const core::index first_line,
+                                 R&& is_record) {
+            std::vector<Chunk> chunks;
+            std::size_t begin = 0;
+            while (begin < text.size()) {
+                std::size_t end = std::min(text.size(), begin + kChunkBytes);
+                if (end < text.size()) {
+                    const std::size_t nl = text.find('\n', end);
+                    end = nl == std::string_view::npos ? text.size() : nl + 1;
+                }
+                chunks.push_back({text.substr(begin, end - begin)});
+                begin = end;
+            }
+
+            std::vector<core::index> lines(chunks.size(), 0);
+            for_each_chunk(policy, chunks, [&](const core::index c) {
+                for_each_line(chunks[c].text, [&](const std::string_view line) {
+                    ++lines[c];
+                    chunks[c].records += is_record(line);
+                });
+            });
+            core::index line = first_line, record = 0;
+            for (core::index c = 0; c < chunks.size(); ++c) {
+                chunks[c].first_line = line;
+                chunks[c].first_record = record;
+                line += lines[c];
+                record += chunks[c].records;
+            }
+            return chunks;
+        }
+
+        // one number, surrounding blanks and a leading '+' allowed, nullptr on failure
+        template <typename T>
+        const char* parse_number(const char* p, const char* end, T& out) noexcept {
+            while (p < end && blank(*p)) ++p;
+            if (p < end && *p == '+') ++p;
+            const auto [q, ec] = std::from_chars(p, end, out);
+            if (ec != std::errc{} || q == p) return nullptr;
+            p = q;
+            while (p < end && blank(*p)) ++p;
+            return p;
+        }
+
+        template <typename T>
+        T parse_field(const char* fn, const core::index line, const char*& p, const char* end) {
+            T value{};
+            const char* q = parse_number(p, end, value);
+            if (!q) {
+                const char* stop = p;
+                while (stop < end && !blank(*stop) && *stop != ',') ++stop;
+                fail_line(fn, line, "not a number: '" + std::string(p, stop) + "'");
+            }
+            p = q;
+            return value;
+        }
+
+        // ---- CSV ----
+
+        core::index count_fields(const std::string_view line, const char delimiter) {
+            if (blank(delimiter)) {
+                core::index n = 0;
+                for (std::size_t i = 0; i < line.size(); ++i) {
+                    n += !blank(line[i]) && (i == 0 || blank(line[i - 1]));
+                }
+                return n;
+            }
+            return static_cast<core::index>(std::count(line.begin(), line.end(), delimiter)) + 1;
+        }
+
+        template <typename T, exec::ExecutionPolicy P>
+        linalg::Mat<T> parse_csv_impl(const P& policy, std::string_view text, const CsvOptions& options) {
+            constexpr const char* fn = "parse_csv()";
+            core::index first_line = 1;
+            if (options.header) {
+                text = drop_line(text);
+                ++first_line;
+            }
+
+            core::index cols = options.cols;
+            if (cols == 0) {
+                std::string_view rest = text;
+                while (!rest.empty() && cols == 0) {
+                    const std::string_view line = trim(rest.substr(0, rest.find('\n')));
+                    if (!line.empty()) cols = count_fields(line, options.delimiter);
+                    rest = drop_line(rest);
+                }
+            }
+
+            const std::vector<Chunk> chunks = split(policy, text, first_line,
+                                                    [](const std::string_view line) { return !trim(line).empty(); });
+            const core::index rows = chunks.empty() ? 0 : chunks.back().first_record + chunks.back().records;
+            if (rows == 0 || cols == 0) {
+                throw core::Error(core::ErrorCode::kInvalidArgument, std::string(fn) + ": no data");
+            }
+
+            linalg::Mat<T> m(rows, cols);
+            const bool ws = blank(options.delimiter);
+            for_each_chunk(policy, chunks, [&](const core::index c) {
+                core::index line_no = chunks[c].first_line, row = chunks[c].first_record;
+                for_each_line(chunks[c].text, [&](std::string_view line) {
+                    line = trim(line);
+                    if (!line.empty()) {
+                        T* out = m.data() + row * cols;
+                        const char* p = line.data();
+                        const char* end = p + line.size();
+                        for (core::index j = 0; j < cols; ++j) {
+                            if (p == end) fail_line(fn, line_no, "expected " + std::to_string(cols) + " fields");
+                            out[j] = parse_field<T>(fn, line_no, p, end);
+                            if (j + 1 < cols && !ws) {
+                                if (p == end || *p != options.delimiter) {
+                                    fail_line(fn, line_no, std::string("expected '") + options.delimiter + "'");
+                                }
+                                ++p;
+                            }
+                        }
+                        if (p != end) fail_line(fn, line_no, "more than " + std::to_string(cols) + " fields");
+                        ++row;
+                    }
+                    ++line_no;
+                });
+            });
+            return m;
+        }
+
+        // ---- Matrix Market ----
+
+        enum class Field { kReal, kInteger, kPattern };
+        enum class Symmetry { kGeneral, kSymmetric, kSkewSymmetric };
+
+        struct MarketHeader {
+            bool coordinate = true;
+            Field field = Field::kReal;
+            Symmetry symmetry = Symmetry::kGeneral;
+            core::index rows = 0, cols = 0, entries = 0;
+            std::string_view body;              // the entry lines
+            core::index body_line = 0;          // line number of the first of them
+        };
+
+        std::string lower(std::string_view s) {
+            std::string out(s);
+            for (char& c : out) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+            return out;
+        }
+
+        bool comment(const std::string_view line) {
+            const std::string_view t = trim(line);
+            return t.empty() || t.front() == '%';
+        }
+
+        MarketHeader parse_market_header(std::string_view text, const char* fn) {
+            MarketHeader h;
+            const std::string_view banner = trim(text.substr(0, text.find('\n')));
+            std::vector<std::string> words;
+            for (std::size_t i = 0; i < banner.size();) {
+                while (i < banner.size() && blank(banner[i])) ++i;
+                const std::size_t start = i;
+                while (i < banner.size() && !blank(banner[i])) ++i;
+                if (i > start) words.push_back(lower(banner.substr(start, i - start)));
+            }
+            if (words.size() != 5 || words[0] != "%%matrixmarket" || words[1] != "matrix") {
+                fail(std::string(fn) + ": missing %%MatrixMarket matrix banner");
+            }
+            if (words[2] == "array") h.coordinate = false;
+            else if (words[2] != "coordinate") fail(std::string(fn) + ": unknown format '" + words[2] + "'");
+            if (words[3] == "integer") h.field = Field::kInteger;
+            else if (words[3] == "pattern") h.field = Field::kPattern;
+            else if (words[3] != "real" && words[3] != "double") {
+                fail(std::string(fn) + ": unsupported field '" + words[3] + "'");
+            }
+            if (words[4] == "symmetric") h.symmetry = Symmetry::kSymmetric;
+            else if (words[4] == "skew-symmetric") h.symmetry = Symmetry::kSkewSymmetric;
+            else if (words[4] != "general") fail(std::string(fn) + ": unsupported symmetry '" + words[4] + "'");
+            if (h.field == Field::kPattern && !h.coordinate) fail(std::string(fn) + ": pattern array files are invalid");
+
+            // comments, then the size line
+            core::index line = 1;
+            text = drop_line(text);
+            ++line;
+            while (!text.empty() && comment(text.substr(0, text.find('\n')))) {
+                text = drop_line(text);
+                ++line;
+            }
+            if (text.empty()) fail(std::string(fn) + ": missing size line");
+            const std::string_view size_line = trim(text.substr(0, text.find('\n')));
+            const char* p = size_line.data();
+            const char* end = p + size_line.size();
+            const auto read_index = [&] {
+                core::index v = 0;
+                while (p < end && blank(*p)) ++p;
+                const auto [q, ec] = std::from_chars(p, end, v);
+                if (ec != std::errc{}) fail_line(fn, line, "malformed size line");
+                p = q;
+                return v;
+            };
+            h.rows = read_index();
+            h.cols = read_index();
+            h.entries = h.coordinate ? read_index() : 0;
+            if (p != end) fail_line(fn, line, "malformed size line");
+            if (h.rows == 0 || h.cols == 0) fail_line(fn, line, "empty matrix");
+            if (h.symmetry != Symmetry::kGeneral && h.rows != h.cols) fail_line(fn, line, "symmetric matrix is not square");
+            if (!h.coordinate) {
+                const core::index n = h.rows;
+                h.entries = h.symmetry == Symmetry::kGeneral ? h.rows * h.cols
+                          : h.symmetry == Symmetry::kSymmetric ? n * (n + 1) / 2 : n * (n - 1) / 2;
+            }
+            h.body = drop_line(text);
+            h.body_line = line + 1;
+            return h;
+        }
+
+        // coordinate entries in file order (0-based), mirrored entries of symmetric files appended
+        template <typename T, exec::ExecutionPolicy P>
+        std::vector<linalg::Triplet<T>> parse_coordinates(const P& policy, const MarketHeader& h, const char* fn) {
+            const std::vector<Chunk> chunks = split(policy, h.body, h.body_line,
+                                                    [](const std::string_view line) { return !comment(line); });
+            const core::index found = chunks.empty() ? 0 : chunks.back().first_record + chunks.back().records;
+            if (found != h.entries) {
+                fail(std::string(fn) + ": expected " + std::to_string(h.entries) + " entries, found "
+                     + std::to_string(found));
+            }
+
+            std::vector<linalg::Triplet<T>> entries(h.entries);
+            for_each_chunk(policy, chunks, [&](const core::index c) {
+                core::index line_no = chunks[c].first_line, k = chunks[c].first_record;
+                for_each_line(chunks[c].text, [&](std::string_view line) {
+                    if (!comment(line)) {
+                        line = trim(line);
+                        const char* p = line.data();
+                        const char* end = p + line.size();
+                        core::index ij[2];
+                        for (core::index& v : ij) {
+                            while (p < end && blank(*p)) ++p;
+                            const auto [q, ec] = std::from_chars(p, end, v);
+                            if (ec != std::errc{}) fail_line(fn, line_no, "malformed entry");
+                            p = q;
+                        }
+                        if (ij[0] == 0 || ij[0] > h.rows || ij[1] == 0 || ij[1] > h.cols) {
+                            fail_line(fn, line_no, "entry outside of the matrix");
+                        }
+                        const T value = h.field == Field::kPattern ? T{1} : parse_field<T>(fn, line_no, p, end);
+                        if (p != end) fail_line(fn, line_no, "trailing characters");
+                        entries[k++] = {ij[0] - 1, ij[1] - 1, value};
+                    }
+                    ++line_no;
+                });
+            });
+
+            if (h.symmetry != Symmetry::kGeneral) {
+                const T sign = h.symmetry == Symmetry::kSkewSymmetric ? T{-1} : T{1};
+                for (core::index k = 0; k < h.entries; ++k) {
+                    const auto e = entries[k];
+                    if (e.row != e.col) entries.push_back({e.col, e.row, sign * e.value});
+                }
+            }
+            return entries;
+        }
+
+        // array values, column-major (lower triangle for symmetric files)
+        template <typename T, exec::ExecutionPolicy P>
+        linalg::Mat<T> parse_array(const P& policy, const MarketHeader& h, const char* fn) {
+            const std::vector<Chunk> chunks = split(policy, h.body, h.body_line,
+                                                    [](const std::string_view line) { return !comment(line); });
+            const core::index found = chunks.empty() ? 0 : chunks.back().first_record + chunks.back().records;
+            if (found != h.entries) {
+                fail(std::string(fn) + ": expected " + std::to_string(h.entries) + " values, found "
+                     + std::to_string(found));
+            }
+
+            core::aligned_vector<T> values(h.entries);
+            for_each_chunk(policy, chunks, [&](const core::index c) {
+                core::index line_no = chunks[c].first_line, k = chunks[c].first_record;
+                for_each_line(chunks[c].text, [&](std::string_view line) {
+                    if (!comment(line)) {
+                        line = trim(line);
+                        const char* p = line.data();
+                        values[k++] = parse_field<T>(fn, line_no, p, p + line.size());
+                        if (p != line.data() + line.size()) fail_line(fn, line_no, "trailing characters");
+                    }
+                    ++line_no;
+                });
+            });
+
+            linalg::Mat<T> m(h.rows, h.cols);
+            core::index k = 0;
+            if (h.symmetry == Symmetry::kGeneral) {
+                for (core::index j = 0; j < h.cols; ++j) {
+                    for (core::index i = 0; i < h.rows; ++i) m(i, j) = values[k++];
+                }
+                return m;
+            }
+            const T sign = h.symmetry == Symmetry::kSkewSymmetric ? T{-1} : T{1};
+            const core::index skip = h.symmetry == Symmetry::kSkewSymmetric ? 1 : 0;
+            for (core::index j = 0; j < h.cols; ++j) {
+                for (core::index i = j + skip; i < h.rows; ++i) {
+                    m(i, j) = values[k];
+                    m(j, i) = sign * values[k++];
+                }
+            }
+            return m;
+        }
+
+        std::string_view text_of(const MappedFile& file) {
+            return {reinterpret_cast<const char*>(file.data()), file.size()};
+        }
+
+        template <typename T>
+        void write_csv_impl(const std::string& path, const linalg::MatView<const T>& m, PrintOptions options) {
+            options.edge_items = 0;
+            std::string text;
+            append(text, m, options);
+            std::ofstream out = detail::open_for_write(path, "write_csv()");
+            out.write(text.data(), static_cast<std::streamsize>(text.size()));
+            detail::finish_write(out, path, "write_csv()");
+        }
+    }
+
+    template <std::floating_point T, exec::ExecutionPolicy P>
+    linalg::Mat<T> parse_csv(const P& policy, const std::string_view text, const CsvOptions& options) {
+        return parse_csv_impl<T>(policy, text, options);
+    }
+
+    template <std::floating_point T, exec::ExecutionPolicy P>
+    linalg::Mat<T> read_csv(const P& policy, const std::string& path, const CsvOptions& options) {
+        const MappedFile file(path);
+        return parse_csv_impl<T>(policy, text_of(file), options);
+    }
+
+    template <std::floating_point T, exec::ExecutionPolicy P>
+    linalg::CsrMat<T> parse_matrix_market(const P& policy, const std::string_view text) {
+        constexpr const char* fn = "parse_matrix_market()";
+        const MarketHeader h = parse_market_header(text, fn);
+        if (!h.coordinate) return linalg::CsrMat<T>::from_dense(parse_array<T>(policy, h, fn));
+        return linalg::CsrMat<T>::from_triplets(h.rows, h.cols, parse_coordinates<T>(policy, h, fn));
+    }
+
+    template <std::floating_point T, exec::ExecutionPolicy P>
+    linalg::CsrMat<T> read_matrix_market(const P& policy, const std::string& path) {
+        const MappedFile file(path);
+        return parse_matrix_market<T>(policy, text_of(file));
+    }
+
+    template <std::floating_point T, exec::ExecutionPolicy P>
+    linalg::Mat<T> parse_matrix_market_dense(const P& policy, const std::string_view text) {
+        constexpr const char* fn = "parse_matrix_market_dense()";
+        const MarketHeader h = parse_market_header(text, fn);
+        if (!h.coordinate) return parse_array<T>(policy, h, fn);
+        linalg::Mat<T> m(h.rows, h.cols);
+        for (const auto& e : parse_coordinates<T>(policy, h, fn)) {
+            m(e.row, e.col) += e.value;
+        }
+        return m;
+    }
+
+    template <std::floating_point T, exec::ExecutionPolicy P>
+    linalg::Mat<T> read_matrix_market_dense(const P& policy, const std::string& path) {
+        const MappedFile file(path);
+        return parse_matrix_market_dense<T>(policy, text_of(file));
+    }
+
+    void write_csv(const std::string& path, const linalg::MatView<const double>& m, const PrintOptions& options) {
+        write_csv_impl(path, m, options);
+    }
+
+    void write_csv(const std::string& path, const linalg::MatView<const float>& m, const PrintOptions& options) {
+        write_csv_impl(path, m, options);
+    }
+
+    template <std::floating_point T>
+    void write_matrix_market(const std::string& path, const linalg::CsrMat<T>& m, const PrintOptions& options) {
+        std::string text = "%%MatrixMarket matrix coordinate real general\n";
+        text += std::to_string(m.rows()) + ' ' + std::to_string(m.cols()) + ' ' + std::to_string(m.nnz()) + '\n';
+        text.reserve(text.size() + m.nnz() * 32);
+        const auto row_ptr = m.row_ptr();
+        const auto col_idx = m.col_idx();
+        const auto values = m.values();
+        char buf[24];
+        for (core::index r = 0; r < m.rows(); ++r) {
+            for (core::index k = row_ptr[r]; k < row_ptr[r + 1]; ++k) {
+                text.append(buf, std::to_chars(buf, buf + sizeof buf, r + 1).ptr);
+                text += ' ';
+                text.append(buf, std::to_chars(buf, buf + sizeof buf, col_idx[k] + 1).ptr);
+                text += ' ';
+                append(text, values[k], options);
+                text += '\n';
+            }
+        }
+        std::ofstream out = detail::open_for_write(path, "write_matrix_market()");
+        out.write(text.data(), static_cast<std::streamsize>(text.size()));
+        detail::finish_write(out, path, "write_matrix_market()");
+    }
+
+    template linalg::Mat<float> parse_csv<float>(const exec::Sequential&, std::string_view, const CsvOptions&);
+    template linalg::Mat<float> read_csv<float>(const exec::Sequential&, const std::string&, const CsvOptions&);
+    template linalg::CsrMat<float> parse_matrix_market<float>(const exec::Sequential&, std::string_view);
+    template linalg::CsrMat<float> read_matrix_market<float>(const exec::Sequential&, const std::string&);
+    template linalg::Mat<float> parse_matrix_market_dense<float>(const exec::Sequential&, std::string_view);
+    template linalg::Mat<float> read_matrix_market_dense<float>(const exec::Sequential&, const std::string&);
+    template linalg::Mat<double> parse_csv<double>(const exec::Sequential&, std::string_view, const CsvOptions&);
+    template linalg::Mat<double> read_csv<double>(const exec::Sequential&, const std::string&, const CsvOptions&);
+    template linalg::CsrMat<double> parse_matrix_market<double>(const exec::Sequential&, std::string_view);
+    template linalg::CsrMat<double> read_matrix_market<double>(const exec::Sequential&, const std::string&);
+    template linalg::Mat<double> parse_matrix_market_dense<double>(const exec::Sequential&, std::string_view);
+    template linalg::Mat<double> read_matrix_market_dense<double>(const exec::Sequential&, const std::string&);
+    template linalg::Mat<float> parse_csv<float>(const exec::Parallel&, std::string_view, const CsvOptions&);
+    template linalg::Mat<float> read_csv<float>(const exec::Parallel&, const std::string&, const CsvOptions&);
+    template linalg::CsrMat<float> parse_matrix_market<float>(const exec::Parallel&, std::string_view);
+    template linalg::CsrMat<float> read_matrix_market<float>(const exec::Parallel&, const std::string&);
+    template linalg::Mat<float> parse_matrix_market_dense<float>(const exec::Parallel&, std::string_view);
+    template linalg::Mat<float> read_matrix_market_dense<float>(const exec::Parallel&, const std::string&);
+    template linalg::Mat<double> parse_csv<double>(const exec::Parallel&, std::string_view, const CsvOptions&);
+    template linalg::Mat<double> read_csv<double>(const exec::Parallel&, const std::string&, const CsvOptions&);
+    template linalg::CsrMat<double> parse_matrix_market<double>(const exec::Parallel&, std::string_view);
+    template linalg::CsrMat<double> read_matrix_market<double>(const exec::Parallel&, const std::string&);
+    template linalg::Mat<double> parse_matrix_market_dense<double>(const exec::Parallel&, std::string_view);
+    template linalg::Mat<double> read_matrix_market_dense<double>(const exec::Parallel&, const std::string&);
+    template void write_matrix_market<float>(const std::string&, const linalg::CsrMat<float>&, const PrintOptions&);
+    template void write_matrix_market<double>(const std::string&, const linalg::CsrMat<double>&, const PrintOptions&);
+
+}
@@ -0,0 +1,54 @@
+#include "axiom/linalg/kernels.hpp"
+
+#include "axiom/core/profile.hpp"
+#include "dispatch.hpp"
+
+namespace axiom::linalg::kernels {
+    namespace {
+        template <typename T>
+        const BatchTable<T>& batch_table() noexcept {
+            return active_kernels().batch<T>();
+        }
+    }
+
+    void dot3(const core::index n, const Lanes3<const double> a, const Lanes3<const double> b, double* out) {
+        AXIOM_PROFILE_KERNEL("kernels::dot3", 5 * n, sizeof(double) * 7 * n);
+        batch_table<double>().dot3(n, a, b, out);
+    }
+    void dot3(const core::index n, const Lanes3<const float> a, const Lanes3<const float> b, float* out) {
+        AXIOM_PROFILE_KERNEL("kernels::dot3", 5 * n, sizeof(float) * 7 * n);
+        batch_table<float>().dot3(n, a, b, out);
+    }
+
+    void cross3(const core::index n, const Lanes3<const double> a, const Lanes3<const double> b,
+                const Lanes3<double> out) {
+        AXIOM_PROFILE_KERNEL("kernels::cross3", 9 * n, sizeof(double) * 9 * n);
+        batch_table<double>().cross3(n, a, b, out);
+    }
+    void cross3(const core::index n, const Lanes3<const float> a, const Lanes3<const float> b,
+                const Lanes3<float> out) {
+        AXIOM_PROFILE_KERNEL("kernels::cross3", 9 * n, sizeof(float) * 9 * n);
+        batch_table<float>().cross3(n, a, b, out);
+    }
+
+    void normalize3(const core::index n, const Lanes3<const double> a, const Lanes3<double> out) {
+        AXIOM_PROFILE_KERNEL("kernels::normalize3", 10 * n, sizeof(double) * 6 * n);
+        batch_table<double>().normalize3(n, a, out);
+    }
+    void normalize3(const core::index n, const Lanes3<const float> a, const Lanes3<float> out) {
+        AXIOM_PROFILE_KERNEL("kernels::normalize3", 10 * n, sizeof(float) * 6 * n);
+        batch_table<float>().normalize3(n, a, out);
+    }
+
+    void reflect3(const core::index n, const Lanes3<const double> v, const Lanes3<const double> normal,
+                  const Lanes3<double> out) {
+        AXIOM_PROFILE_KERNEL("kernels::reflect3", 12 * n, sizeof(double) * 9 * n);
+        batch_table<double>().reflect3(n, v, normal, out);
+    }
+    void reflect3(const core::index n, const Lanes3<const float> v, const Lanes3<const float> normal,
+                  const Lanes3<float> out) {
+        AXIOM_PROFILE_KERNEL("kernels::reflect3", 12 * n, sizeof(float) * 9 * n);
+        batch_table<float>().reflect3(n, v, normal, out);
+    }
+
+}
@@ -0,0 +1,152 @@
+#ifndef AXIOM_BATCH_IMPL_HPP
+#define AXIOM_BATCH_IMPL_HPP
+
+#include <cfloat>
+#include <cstddef>
+
+#include "dispatch.hpp"
+
+namespace axiom::linalg::kernels {
+// structure-of-arrays 3-vector kernels written against the SIMD traits of reduce_impl.hpp,
+// instantiated with internal linkage by every isa_*.cpp; like reduce_impl.hpp they call no std
+// templates, whose weak instantiations would carry this file's target flags; every input lane
+// of a block is loaded before the block is stored, which is what makes out == in safe
+//
+// the last n % W elements are copied into zero-padded W-wide buffers and run through the same
+// block as the rest, so every element gets the same (fused or not) arithmetic whatever its
+// position
+namespace {
+
+    // W lanes of three components, staged from / to the tail of a Lanes3
+    template <class S>
+    struct Stage3 {
+        using T = typename S::T;
+        T x[S::W]{}, y[S::W]{}, z[S::W]{};
+
+        Stage3() = default;
+        Stage3(const Lanes3<const T> src, const std::size_t i, const std::size_t m) {
+            for (std::size_t k = 0; k < m; ++k) {
+                x[k] = src.x[i + k];
+                y[k] = src.y[i + k];
+                z[k] = src.z[i + k];
+            }
+        }
+
+        Lanes3<const T> in() const { return {x, y, z}; }
+        Lanes3<T> out() { return {x, y, z}; }
+
+        void copy_to(const Lanes3<T> dst, const std::size_t i, const std::size_t m) const {
+            for (std::size_t k = 0; k < m; ++k) {
+                dst.x[i + k] = x[k];
+                dst.y[i + k] = y[k];
+                dst.z[i + k] = z[k];
+            }
+        }
+    };
+
+    template <class S>
+    void dot3(const std::size_t n, const Lanes3<const typename S::T> a, const Lanes3<const typename S::T> b,
+              typename S::T* out) {
+        using T = typename S::T;
+        using reg = typename S::reg;
+        constexpr std::size_t W = S::W;
+        const auto block = [](const Lanes3<const T> a, const Lanes3<const T> b, T* out, const std::size_t i) {
+            reg r = S::mul(S::load(a.x + i), S::load(b.x + i));
+            r = S::fmadd(S::load(a.y + i), S::load(b.y + i), r);
+            S::store(out + i, S::fmadd(S::load(a.z + i), S::load(b.z + i), r));
+        };
+        std::size_t i = 0;
+        for (; i + W <= n; i += W) block(a, b, out, i);
+        if (i < n) {
+            const Stage3<S> sa(a, i, n - i), sb(b, i, n - i);
+            T so[W];
+            block(sa.in(), sb.in(), so, 0);
+            for (std::size_t k = 0; i + k < n; ++k) out[i + k] = so[k];
+        }
+    }
+
+    template <class S>
+    void cross3(const std::size_t n, const Lanes3<const typename S::T> a, const Lanes3<const typename S::T> b,
+                const Lanes3<typename S::T> out) {
+        using T = typename S::T;
+        using reg = typename S::reg;
+        constexpr std::size_t W = S::W;
+        const auto block = [](const Lanes3<const T> a, const Lanes3<const T> b, const Lanes3<T> out,
+                              const std::size_t i) {
+            const reg ax = S::load(a.x + i), ay = S::load(a.y + i), az = S::load(a.z + i);
+            const reg bx = S::load(b.x + i), by = S::load(b.y + i), bz = S::load(b.z + i);
+            S::store(out.x + i, S::sub(S::mul(ay, bz), S::mul(az, by)));
+            S::store(out.y + i, S::sub(S::mul(az, bx), S::mul(ax, bz)));
+            S::store(out.z + i, S::sub(S::mul(ax, by), S::mul(ay, bx)));
+        };
+        std::size_t i = 0;
+        for (; i + W <= n; i += W) block(a, b, out, i);
+        if (i < n) {
+            const Stage3<S> sa(a, i, n - i), sb(b, i, n - i);
+            Stage3<S> so;
+            block(sa.in(), sb.in(), so.out(), 0);
+            so.copy_to(out, i, n - i);
+        }
+    }
+
+    template <class S>
+    void normalize3(const std::size_t n, const Lanes3<const typename S::T> a, const Lanes3<typename S::T> out) {
+        using T = typename S::T;
+        using reg = typename S::reg;
+        constexpr std::size_t W = S::W;
+        // clamping the squared length keeps 0 / 0 out of the loop, a zero vector scales to zero
+        constexpr T tiny = sizeof(T) == sizeof(double) ? T(DBL_MIN) : T(FLT_MIN);
+        const reg one = S::set1(T{1}), floor = S::set1(tiny);
+        const auto block = [&](const Lanes3<const T> a, const Lanes3<T> out, const std::size_t i) {
+            const reg x = S::load(a.x + i), y = S::load(a.y + i), z = S::load(a.z + i);
+            const reg l2 = S::fmadd(z, z, S::fmadd(y, y, S::mul(x, x)));
+            const reg s = S::div(one, S::sqrt(S::max(l2, floor)));
+            S::store(out.x + i, S::mul(x, s));
+            S::store(out.y + i, S::mul(y, s));
+            S::store(out.z + i, S::mul(z, s));
+        };
+        std::size_t i = 0;
+        for (; i + W <= n; i += W) block(a, out, i);
+        if (i < n) {
+            const Stage3<S> sa(a, i, n - i);
+            Stage3<S> so;
+            block(sa.in(), so.out(), 0);
+            so.copy_to(out, i, n - i);
+        }
+    }
+
+    template <class S>
+    void reflect3(const std::size_t n, const Lanes3<const typename S::T> v, const Lanes3<const typename S::T> normal,
+                  const Lanes3<typename S::T> out) {
+        using T = typename S::T;
+        using reg = typename S::reg;
+        constexpr std::size_t W = S::W;
+        const reg two = S::set1(T{2});
+        const auto block = [&](const Lanes3<const T> v, const Lanes3<const T> normal, const Lanes3<T> out,
+                               const std::size_t i) {
+            const reg x = S::load(v.x + i), y = S::load(v.y + i), z = S::load(v.z + i);
+            const reg nx = S::load(normal.x + i), ny = S::load(normal.y + i), nz = S::load(normal.z + i);
+            const reg t = S::mul(two, S::fmadd(z, nz, S::fmadd(y, ny, S::mul(x, nx))));
+            S::store(out.x + i, S::sub(x, S::mul(t, nx)));
+            S::store(out.y + i, S::sub(y, S::mul(t, ny)));
+            S::store(out.z + i, S::sub(z, S::mul(t, nz)));
+        };
+        std::size_t i = 0;
+        for (; i + W <= n; i += W) block(v, normal, out, i);
+        if (i < n) {
+            const Stage3<S> sv(v, i, n - i), sn(normal, i, n - i);
+            Stage3<S> so;
+            block(sv.in(), sn.in(), so.out(), 0);
+            so.copy_to(out, i, n - i);
+        }
+    }
+
+    template <class S>
+    BatchTable<typename S::T> make_batch_table() {
+        return {&dot3<S>, &cross3<S>, &normalize3<S>, &reflect3<S>};
+    }
+
+}
+}
+
+#endif //AXIOM_BATCH_IMPL_HPP
\ No newline at end of file
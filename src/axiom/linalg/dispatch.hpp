@@ -0,0 +1,104 @@
+#ifndef AXIOM_DISPATCH_HPP
+#define AXIOM_DISPATCH_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+#include "axiom/linalg/kernels.hpp"
+
+namespace axiom::linalg::kernels {
+/*
+ * per-ISA kernel tables: every isa_*.cpp translation unit is compiled with its own
+ * target flags and only exports its IsaKernels table, everything else in it has internal
+ * linkage so no ISA-specific code can leak into the rest of the library through ODR
+ */
+
+    template <typename T>
+    struct ReduceTable {
+        T (*dot)(const T*, const T*, std::size_t);
+        T (*sum)(const T*, std::size_t);
+        T (*sum_abs)(const T*, std::size_t);
+        T (*max_abs)(const T*, std::size_t);
+        double (*sum_sq)(const T*, std::size_t);
+        T (*dist_sq)(const T*, const T*, std::size_t);
+        T (*min)(const T*, std::size_t);
+        T (*max)(const T*, std::size_t);
+        // first index i with a[i] == v, n if there is none
+        std::size_t (*find)(const T*, std::size_t, T);
+    };
+
+    // register-tiled GEMM micro-kernel on packed panels:
+    // C[mr x nr] = alpha * A_panel * B_panel + beta * C, with A packed as kc columns of mr
+    // and B as kc rows of nr, C addressed as c[i * rsc + j * csc] (beta == 0 ignores C)
+    template <typename T>
+    struct GemmTable {
+        std::size_t mr;
+        std::size_t nr;
+        void (*micro)(std::size_t kc, const T* a, const T* b, T* c,
+                      std::size_t rsc, std::size_t csc, T alpha, T beta);
+    };
+
+    // row-major A (m x n, leading dimension lda):
+    // gemv_n: y[0, m) = alpha * A x + beta * y (beta == 0 ignores y)
+    // gemv_t: y[0, n) += alpha * A^T x
+    template <typename T>
+    struct GemvTable {
+        void (*gemv_n)(std::size_t m, std::size_t n, T alpha, const T* a, std::size_t lda,
+                       const T* x, T beta, T* y);
+        void (*gemv_t)(std::size_t m, std::size_t n, T alpha, const T* a, std::size_t lda,
+                       const T* x, T* y);
+    };
+
+    // structure-of-arrays 3-vector kernels, see kernels.hpp
+    template <typename T>
+    struct BatchTable {
+        void (*dot3)(std::size_t n, Lanes3<const T> a, Lanes3<const T> b, T* out);
+        void (*cross3)(std::size_t n, Lanes3<const T> a, Lanes3<const T> b, Lanes3<T> out);
+        void (*normalize3)(std::size_t n, Lanes3<const T> a, Lanes3<T> out);
+        void (*reflect3)(std::size_t n, Lanes3<const T> v, Lanes3<const T> normal, Lanes3<T> out);
+    };
+
+    struct IsaKernels {
+        ReduceTable<double> reduce_f64;
+        ReduceTable<float> reduce_f32;
+        GemmTable<double> gemm_f64;
+        GemmTable<float> gemm_f32;
+        GemvTable<double> gemv_f64;
+        GemvTable<float> gemv_f32;
+        BatchTable<double> batch_f64;
+        BatchTable<float> batch_f32;
+
+        template <typename T>
+        const ReduceTable<T>& reduce() const noexcept {
+            if constexpr (std::is_same_v<T, double>) return reduce_f64; else return reduce_f32;
+        }
+
+        template <typename T>
+        const GemmTable<T>& gemm() const noexcept {
+            if constexpr (std::is_same_v<T, double>) return gemm_f64; else return gemm_f32;
+        }
+
+        template <typename T>
+        const GemvTable<T>& gemv() const noexcept {
+            if constexpr (std::is_same_v<T, double>) return gemv_f64; else return gemv_f32;
+        }
+
+        template <typename T>
+        const BatchTable<T>& batch() const noexcept {
+            if constexpr (std::is_same_v<T, double>) return batch_f64; else return batch_f32;
+        }
+    };
+
+    // table for core::active_isa(), defined in kernels.cpp
+    const IsaKernels& active_kernels() noexcept;
+
+    namespace scalar { extern const IsaKernels table; }
+#if AXIOM_HAVE_X86_KERNELS
+    namespace sse2 { extern const IsaKernels table; }
+    namespace avx2 { extern const IsaKernels table; }
+    namespace avx512 { extern const IsaKernels table; }
+#endif
+
+}
+
+#endif //AXIOM_DISPATCH_HPP
\ No newline at end of file
@@ -0,0 +1,199 @@
+#include "axiom/linalg/kernels.hpp"
+
+#include <algorithm>
+
+#include "axiom/core/memory.hpp"
+#include "axiom/core/parallel.hpp"
+#include "axiom/core/profile.hpp"
+#include "axiom/exec/exec.hpp"
+#include "dispatch.hpp"
+
+namespace axiom::linalg::kernels {
+    namespace {
+        // cache blocking in elements: a kc x nr sliver of B stays in L1, the packed mc x kc
+        // block of A in L2 and the packed kc x nc panel of B in L3
+        template <typename T>
+        struct Blocking {
+            static constexpr std::size_t kc = sizeof(T) == sizeof(double) ? 256 : 384;
+            static constexpr std::size_t mc = sizeof(T) == sizeof(double) ? 144 : 192;
+            static constexpr std::size_t nc = 4096;
+        };
+
+        // upper bound on mr * nr over all micro-kernels, sizes the partial-tile scratch
+        constexpr std::size_t kMaxMicroTile = 1024;
+
+        // below this many multiply-adds a product is not worth spreading over threads
+        constexpr std::size_t kParallelMinWork = std::size_t{1} << 18;
+
+        // packing scratch comes from the calling thread's arena and is rewound on return, so
+        // repeated products of similar size do not touch the heap
+        template <typename T>
+        T* scratch(const std::size_t n) {
+            return static_cast<T*>(core::thread_arena().allocate(n * sizeof(T), core::kAlignment));
+        }
+
+        // mc x kc block of A into mr-row panels, each stored as kc columns of mr (zero padded)
+        template <typename T>
+        void pack_a(const std::size_t mc, const std::size_t kc, const T* a, const std::size_t rsa,
+                    const std::size_t csa, const std::size_t mr, T* out) {
+            for (std::size_t ir = 0; ir < mc; ir += mr) {
+                const std::size_t rows = std::min(mr, mc - ir);
+                for (std::size_t i = 0; i < rows; ++i) {
+                    const T* src = a + (ir + i) * rsa;
+                    for (std::size_t p = 0; p < kc; ++p) out[p * mr + i] = src[p * csa];
+                }
+                for (std::size_t i = rows; i < mr; ++i) {
+                    for (std::size_t p = 0; p < kc; ++p) out[p * mr + i] = T{};
+                }
+                out += mr * kc;
+            }
+        }
+
+        // kc x nc panel of B into nr-column slivers, each stored as kc rows of nr (zero padded)
+        template <typename T>
+        void pack_b(const std::size_t kc, const std::size_t nc, const T* b, const std::size_t rsb,
+                    const std::size_t csb, const std::size_t nr, T* out) {
+            for (std::size_t jr = 0; jr < nc; jr += nr) {
+                const std::size_t cols = std::min(nr, nc - jr);
+                for (std::size_t p = 0; p < kc; ++p) {
+                    const T* src = b + p * rsb + jr * csb;
+                    T* dst = out + p * nr;
+                    if (csb == 1) std::copy(src, src + cols, dst);
+                    else for (std::size_t j = 0; j < cols; ++j) dst[j] = src[j * csb];
+                    std::fill(dst + cols, dst + nr, T{});
+                }
+                out += nr * kc;
+            }
+        }
+
+        template <typename T>
+        void scale(const std::size_t m, const std::size_t n, const T beta, T* c,
+                   const std::size_t rsc, const std::size_t csc) {
+            for (std::size_t i = 0; i < m; ++i) {
+                for (std::size_t j = 0; j < n; ++j) {
+                    T& cij = c[i * rsc + j * csc];
+                    cij = beta == T{} ? T{} : beta * cij;
+                }
+            }
+        }
+
+        template <typename T>
+        struct Operands {
+            const T* a; std::size_t rsa, csa;
+            const T* b; std::size_t rsb, csb;
+            T* c; std::size_t rsc, csc;
+        };
+
+        template <typename T>
+        void gemm_serial(const GemmTable<T>& kernel, const std::size_t m, const std::size_t n,
+                         const std::size_t k, const T alpha, const Operands<T>& x, const T beta) {
+            using B = Blocking<T>;
+            const std::size_t mr = kernel.mr, nr = kernel.nr;
+            const std::size_t mc_max = std::max(mr, B::mc / mr * mr);
+            const std::size_t nc_max = std::max(nr, B::nc / nr * nr);
+            const std::size_t kc_max = std::min(B::kc, k);
+
+            const core::ArenaScope scope;
+            T* const a_pack = scratch<T>(mc_max * kc_max);
+            T* const b_pack = scratch<T>(std::min(nc_max, (n + nr - 1) / nr * nr) * kc_max);
+            T edge[kMaxMicroTile];
+
+            for (std::size_t jc = 0; jc < n; jc += nc_max) {
+                const std::size_t nc = std::min(nc_max, n - jc);
+                for (std::size_t pc = 0; pc < k; pc += kc_max) {
+                    const std::size_t kc = std::min(kc_max, k - pc);
+                    const T beta_eff = pc == 0 ? beta : T{1};
+                    pack_b(kc, nc, x.b + pc * x.rsb + jc * x.csb, x.rsb, x.csb, nr, b_pack);
+
+                    for (std::size_t ic = 0; ic < m; ic += mc_max) {
+                        const std::size_t mc = std::min(mc_max, m - ic);
+                        pack_a(mc, kc, x.a + ic * x.rsa + pc * x.csa, x.rsa, x.csa, mr, a_pack);
+
+                        for (std::size_t jr = 0; jr < nc; jr += nr) {
+                            const std::size_t cols = std::min(nr, nc - jr);
+                            const T* bp = b_pack + jr * kc;
+                            for (std::size_t ir = 0; ir < mc; ir += mr) {
+                                const std::size_t rows = std::min(mr, mc - ir);
+                                const T* ap = a_pack + ir * kc;
+                                T* cp = x.c + (ic + ir) * x.rsc + (jc + jr) * x.csc;
+                                if (rows == mr && cols == nr) {
+                                    kernel.micro(kc, ap, bp, cp, x.rsc, x.csc, alpha, beta_eff);
+                                    continue;
+                                }
+                                // partial tile: full micro-tile into scratch, then merge
+                                kernel.micro(kc, ap, bp, edge, nr, 1, alpha, T{});
+                                for (std::size_t i = 0; i < rows; ++i) {
+                                    for (std::size_t j = 0; j < cols; ++j) {
+                                        T& cij = cp[i * x.rsc + j * x.csc];
+                                        cij = beta_eff == T{} ? edge[i * nr + j] : edge[i * nr + j] + beta_eff * cij;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        template <typename T>
+        void gemm_impl(const std::size_t m, const std::size_t n, const std::size_t k, const T alpha,
+                       const Operands<T>& x, const T beta, std::size_t threads) {
+            AXIOM_PROFILE_KERNEL("kernels::gemm", 2 * m * n * k, sizeof(T) * (m * k + k * n + 2 * m * n));
+            if (m == 0 || n == 0) return;
+            if (k == 0 || alpha == T{}) {
+                scale(m, n, beta, x.c, x.rsc, x.csc);
+                return;
+            }
+
+            const GemmTable<T>& kernel = active_kernels().gemm<T>();
+            if (threads == 0) threads = core::hardware_threads();
+            if (threads <= 1 || m * n * k < kParallelMinWork) {
+                gemm_serial(kernel, m, n, k, alpha, x, beta);
+                return;
+            }
+
+            // split the larger of M / N into one contiguous, tile-aligned slab per thread
+            const bool split_m = m >= n;
+            const std::size_t extent = split_m ? m : n;
+            const std::size_t tile = split_m ? kernel.mr : kernel.nr;
+            const std::size_t tiles = (extent + tile - 1) / tile;
+            const std::size_t tasks = std::min(threads, tiles);
+            const std::size_t per_task = (tiles + tasks - 1) / tasks * tile;
+
+            exec::parallel_for(exec::on_threads(tasks), tasks, [&](const std::size_t lo, const std::size_t hi) {
+                for (std::size_t t = lo; t < hi; ++t) {
+                    const std::size_t begin = t * per_task;
+                    if (begin >= extent) return;
+                    const std::size_t len = std::min(per_task, extent - begin);
+                    Operands<T> part = x;
+                    if (split_m) {
+                        part.a += begin * x.rsa;
+                        part.c += begin * x.rsc;
+                        gemm_serial(kernel, len, n, k, alpha, part, beta);
+                    } else {
+                        part.b += begin * x.csb;
+                        part.c += begin * x.csc;
+                        gemm_serial(kernel, m, len, k, alpha, part, beta);
+                    }
+                }
+            });
+        }
+    }
+
+    void gemm(const core::index m, const core::index n, const core::index k, const double alpha,
+              const double* a, const core::index rsa, const core::index csa,
+              const double* b, const core::index rsb, const core::index csb,
+              const double beta, double* c, const core::index rsc, const core::index csc,
+              const core::index threads) {
+        gemm_impl<double>(m, n, k, alpha, {a, rsa, csa, b, rsb, csb, c, rsc, csc}, beta, threads);
+    }
+
+    void gemm(const core::index m, const core::index n, const core::index k, const float alpha,
+              const float* a, const core::index rsa, const core::index csa,
+              const float* b, const core::index rsb, const core::index csb,
+              const float beta, float* c, const core::index rsc, const core::index csc,
+              const core::index threads) {
+        gemm_impl<float>(m, n, k, alpha, {a, rsa, csa, b, rsb, csb, c, rsc, csc}, beta, threads);
+    }
+
+}
\ No newline at end of file
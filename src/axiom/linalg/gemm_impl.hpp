@@ -0,0 +1,87 @@
+#ifndef AXIOM_GEMM_IMPL_HPP
+#define AXIOM_GEMM_IMPL_HPP
+
+#include <cstddef>
+
+#include "dispatch.hpp"
+
+#if defined(__clang__)
+  #define AXIOM_UNROLL _Pragma("unroll")
+#elif defined(__GNUC__)
+  #define AXIOM_UNROLL _Pragma("GCC unroll 32")
+#else
+  #define AXIOM_UNROLL
+#endif
+
+namespace axiom::linalg::kernels {
+// GEMM micro-kernel written against the SIMD traits of reduce_impl.hpp (plus mul and
+// store), instantiated with internal linkage by every isa_*.cpp
+namespace {
+
+    // MR rows of NV registers: MR * NV accumulators stay in registers for the whole kc loop
+    template <class S, std::size_t MR, std::size_t NV>
+    void gemm_micro(const std::size_t kc, const typename S::T* a, const typename S::T* b,
+                    typename S::T* c, const std::size_t rsc, const std::size_t csc,
+                    const typename S::T alpha, const typename S::T beta) {
+        using T = typename S::T;
+        using reg = typename S::reg;
+        constexpr std::size_t W = S::W;
+        constexpr std::size_t NR = NV * W;
+
+        reg acc[MR][NV];
+        AXIOM_UNROLL
+        for (std::size_t i = 0; i < MR; ++i) {
+            AXIOM_UNROLL
+            for (std::size_t v = 0; v < NV; ++v) acc[i][v] = S::zero();
+        }
+
+        for (std::size_t p = 0; p < kc; ++p) {
+            reg bv[NV];
+            AXIOM_UNROLL
+            for (std::size_t v = 0; v < NV; ++v) bv[v] = S::load(b + v * W);
+            AXIOM_UNROLL
+            for (std::size_t i = 0; i < MR; ++i) {
+                const reg ai = S::set1(a[i]);
+                AXIOM_UNROLL
+                for (std::size_t v = 0; v < NV; ++v) acc[i][v] = S::fmadd(ai, bv[v], acc[i][v]);
+            }
+            a += MR;
+            b += NR;
+        }
+
+        const reg va = S::set1(alpha);
+        const reg vb = S::set1(beta);
+        if (csc == 1) {
+            AXIOM_UNROLL
+            for (std::size_t i = 0; i < MR; ++i) {
+                AXIOM_UNROLL
+                for (std::size_t v = 0; v < NV; ++v) {
+                    T* cp = c + i * rsc + v * W;
+                    reg r = S::mul(va, acc[i][v]);
+                    if (beta != T{}) r = S::fmadd(vb, S::load(cp), r);
+                    S::store(cp, r);
+                }
+            }
+            return;
+        }
+
+        T row[NR];
+        for (std::size_t i = 0; i < MR; ++i) {
+            AXIOM_UNROLL
+            for (std::size_t v = 0; v < NV; ++v) S::store(row + v * W, S::mul(va, acc[i][v]));
+            for (std::size_t j = 0; j < NR; ++j) {
+                T& cij = c[i * rsc + j * csc];
+                cij = beta == T{} ? row[j] : row[j] + beta * cij;
+            }
+        }
+    }
+
+    template <class S, std::size_t MR, std::size_t NV>
+    constexpr GemmTable<typename S::T> make_gemm_table() {
+        return {MR, NV * S::W, &gemm_micro<S, MR, NV>};
+    }
+
+}
+}
+
+#endif //AXIOM_GEMM_IMPL_HPP
\ No newline at end of file
@@ -0,0 +1,104 @@
+#include "axiom/linalg/kernels.hpp"
+
+#include <algorithm>
+
+#include "axiom/core/parallel.hpp"
+#include "axiom/core/profile.hpp"
+#include "axiom/exec/exec.hpp"
+#include "dispatch.hpp"
+
+namespace axiom::linalg::kernels {
+    namespace {
+        // below this many elements of A a product is not worth spreading over threads
+        constexpr std::size_t kParallelMinWork = std::size_t{1} << 16;
+
+        // row blocks of A x follow the 4-row grouping of the gemv_n kernels
+        constexpr std::size_t kRowAlign = 4;
+
+        // column slabs of the transposed product are kept to whole cache lines of y
+        constexpr std::size_t kColumnAlign = 16;
+
+        std::size_t task_count(const std::size_t m, const std::size_t n, std::size_t threads,
+                               const std::size_t units) {
+            if (threads == 0) threads = core::hardware_threads();
+            if (m * n < kParallelMinWork) return 1;
+            return std::max<std::size_t>(1, std::min(threads, units));
+        }
+
+        template <typename T>
+        void gemv_impl(const std::size_t m, const std::size_t n, const T alpha, const T* a,
+                       const std::size_t lda, const T* x, const T beta, T* y, const std::size_t threads) {
+            AXIOM_PROFILE_KERNEL("kernels::gemv", 2 * m * n, sizeof(T) * (m * n + n + 2 * m));
+            if (m == 0) return;
+            const GemvTable<T>& kernel = active_kernels().gemv<T>();
+            const std::size_t tasks = task_count(m, n, threads, m);
+            if (tasks == 1) {
+                kernel.gemv_n(m, n, alpha, a, lda, x, beta, y);
+                return;
+            }
+            // rows are independent, each thread owns a contiguous block of y; blocks are kept
+            // to multiples of the kernel's row group so results match the serial call bitwise
+            const std::size_t per_task = ((m + tasks - 1) / tasks + kRowAlign - 1) / kRowAlign * kRowAlign;
+            exec::parallel_for(exec::on_threads(tasks), tasks, [&](const std::size_t lo, const std::size_t hi) {
+                for (std::size_t t = lo; t < hi; ++t) {
+                    const std::size_t begin = t * per_task;
+                    if (begin >= m) return;
+                    const std::size_t rows = std::min(per_task, m - begin);
+                    kernel.gemv_n(rows, n, alpha, a + begin * lda, lda, x, beta, y + begin);
+                }
+            });
+        }
+
+        template <typename T>
+        void gemv_t_impl(const std::size_t m, const std::size_t n, const T alpha, const T* a,
+                         const std::size_t lda, const T* x, const T beta, T* y, const std::size_t threads) {
+            AXIOM_PROFILE_KERNEL("kernels::gemv_t", 2 * m * n, sizeof(T) * (m * n + m + 2 * n));
+            if (n == 0) return;
+            const GemvTable<T>& kernel = active_kernels().gemv<T>();
+            const auto run = [&](const std::size_t begin, const std::size_t cols) {
+                T* yp = y + begin;
+                if (beta == T{}) std::fill(yp, yp + cols, T{});
+                else if (beta != T{1}) for (std::size_t j = 0; j < cols; ++j) yp[j] *= beta;
+                kernel.gemv_t(m, cols, alpha, a + begin, lda, x, yp);
+            };
+
+            const std::size_t slabs = (n + kColumnAlign - 1) / kColumnAlign;
+            const std::size_t tasks = task_count(m, n, threads, slabs);
+            if (tasks == 1) {
+                run(0, n);
+                return;
+            }
+            // split columns rather than rows: every thread still streams A row by row but
+            // owns a disjoint slice of y, so there are no partial sums to allocate or reduce
+            const std::size_t per_task = (slabs + tasks - 1) / tasks * kColumnAlign;
+            exec::parallel_for(exec::on_threads(tasks), tasks, [&](const std::size_t lo, const std::size_t hi) {
+                for (std::size_t t = lo; t < hi; ++t) {
+                    const std::size_t begin = t * per_task;
+                    if (begin >= n) return;
+                    run(begin, std::min(per_task, n - begin));
+                }
+            });
+        }
+    }
+
+    void gemv(const core::index m, const core::index n, const double alpha, const double* a,
+              const core::index lda, const double* x, const double beta, double* y, const core::index threads) {
+        gemv_impl(m, n, alpha, a, lda, x, beta, y, threads);
+    }
+
+    void gemv(const core::index m, const core::index n, const float alpha, const float* a,
+              const core::index lda, const float* x, const float beta, float* y, const core::index threads) {
+        gemv_impl(m, n, alpha, a, lda, x, beta, y, threads);
+    }
+
+    void gemv_t(const core::index m, const core::index n, const double alpha, const double* a,
+                const core::index lda, const double* x, const double beta, double* y, const core::index threads) {
+        gemv_t_impl(m, n, alpha, a, lda, x, beta, y, threads);
+    }
+
+    void gemv_t(const core::index m, const core::index n, const float alpha, const float* a,
+                const core::index lda, const float* x, const float beta, float* y, const core::index threads) {
+        gemv_t_impl(m, n, alpha, a, lda, x, beta, y, threads);
+    }
+
+}
@@ -0,0 +1,113 @@
+#ifndef AXIOM_GEMV_IMPL_HPP
+#define AXIOM_GEMV_IMPL_HPP
+
+#include <cstddef>
+
+#include "dispatch.hpp"
+
+namespace axiom::linalg::kernels {
+// matrix-vector kernels over a row-major A (m x n, leading dimension lda) written against
+// the SIMD traits of reduce_impl.hpp, instantiated with internal linkage by every isa_*.cpp
+namespace {
+
+    // rows handled together so each load of x (or of y) is shared by several rows of A
+    constexpr std::size_t kGemvRows = 4;
+
+    // y[0, m) = alpha * A x + beta * y
+    template <class S>
+    void gemv_n(const std::size_t m, const std::size_t n, const typename S::T alpha,
+                const typename S::T* a, const std::size_t lda, const typename S::T* x,
+                const typename S::T beta, typename S::T* y) {
+        using T = typename S::T;
+        using reg = typename S::reg;
+        constexpr std::size_t W = S::W;
+        const auto finish = [&](const std::size_t i, const double s) {
+            const T r = static_cast<T>(alpha * static_cast<T>(s));
+            y[i] = beta == T{} ? r : r + beta * y[i];
+        };
+
+        std::size_t i = 0;
+        for (; i + kGemvRows <= m; i += kGemvRows) {
+            const T* r0 = a + i * lda;
+            const T* r1 = r0 + lda;
+            const T* r2 = r1 + lda;
+            const T* r3 = r2 + lda;
+            reg acc0 = S::zero(), acc1 = S::zero(), acc2 = S::zero(), acc3 = S::zero();
+            std::size_t j = 0;
+            for (; j + W <= n; j += W) {
+                const reg xv = S::load(x + j);
+                acc0 = S::fmadd(S::load(r0 + j), xv, acc0);
+                acc1 = S::fmadd(S::load(r1 + j), xv, acc1);
+                acc2 = S::fmadd(S::load(r2 + j), xv, acc2);
+                acc3 = S::fmadd(S::load(r3 + j), xv, acc3);
+            }
+            double s0 = S::hsum(acc0), s1 = S::hsum(acc1), s2 = S::hsum(acc2), s3 = S::hsum(acc3);
+            for (; j < n; ++j) {
+                s0 += r0[j] * x[j];
+                s1 += r1[j] * x[j];
+                s2 += r2[j] * x[j];
+                s3 += r3[j] * x[j];
+            }
+            finish(i, s0);
+            finish(i + 1, s1);
+            finish(i + 2, s2);
+            finish(i + 3, s3);
+        }
+        for (; i < m; ++i) {
+            const T* r = a + i * lda;
+            reg acc = S::zero();
+            std::size_t j = 0;
+            for (; j + W <= n; j += W) acc = S::fmadd(S::load(r + j), S::load(x + j), acc);
+            double s = S::hsum(acc);
+            for (; j < n; ++j) s += r[j] * x[j];
+            finish(i, s);
+        }
+    }
+
+    // y[0, n) += alpha * A^T x, streaming A row by row and touching y once per kGemvRows rows
+    template <class S>
+    void gemv_t(const std::size_t m, const std::size_t n, const typename S::T alpha,
+                const typename S::T* a, const std::size_t lda, const typename S::T* x,
+                typename S::T* y) {
+        using T = typename S::T;
+        using reg = typename S::reg;
+        constexpr std::size_t W = S::W;
+
+        std::size_t i = 0;
+        for (; i + kGemvRows <= m; i += kGemvRows) {
+            const T* r0 = a + i * lda;
+            const T* r1 = r0 + lda;
+            const T* r2 = r1 + lda;
+            const T* r3 = r2 + lda;
+            const T x0 = alpha * x[i], x1 = alpha * x[i + 1], x2 = alpha * x[i + 2], x3 = alpha * x[i + 3];
+            const reg v0 = S::set1(x0), v1 = S::set1(x1), v2 = S::set1(x2), v3 = S::set1(x3);
+            std::size_t j = 0;
+            for (; j + W <= n; j += W) {
+                reg yv = S::load(y + j);
+                yv = S::fmadd(v0, S::load(r0 + j), yv);
+                yv = S::fmadd(v1, S::load(r1 + j), yv);
+                yv = S::fmadd(v2, S::load(r2 + j), yv);
+                yv = S::fmadd(v3, S::load(r3 + j), yv);
+                S::store(y + j, yv);
+            }
+            for (; j < n; ++j) y[j] += x0 * r0[j] + x1 * r1[j] + x2 * r2[j] + x3 * r3[j];
+        }
+        for (; i < m; ++i) {
+            const T* r = a + i * lda;
+            const T xi = alpha * x[i];
+            const reg v = S::set1(xi);
+            std::size_t j = 0;
+            for (; j + W <= n; j += W) S::store(y + j, S::fmadd(v, S::load(r + j), S::load(y + j)));
+            for (; j < n; ++j) y[j] += xi * r[j];
+        }
+    }
+
+    template <class S>
+    constexpr GemvTable<typename S::T> make_gemv_table() {
+        return {&gemv_n<S>, &gemv_t<S>};
+    }
+
+}
+}
+
+#endif //AXIOM_GEMV_IMPL_HPP
@@ -0,0 +1,102 @@
+// compiled with -mavx2 -mfma, selected when core::active_isa() == Isa::kAvx2
+
+#include <immintrin.h>
+
+#include "reduce_impl.hpp"
+#include "gemm_impl.hpp"
+#include "gemv_impl.hpp"
+#include "batch_impl.hpp"
+
+namespace axiom::linalg::kernels {
+namespace {
+
+    struct Avx2F64 {
+        using T = double;
+        using reg = __m256d;
+        static constexpr std::size_t W = 4;
+
+        static reg zero() { return _mm256_setzero_pd(); }
+        static reg set1(const T v) { return _mm256_set1_pd(v); }
+        static reg load(const double* p) { return _mm256_loadu_pd(p); }
+        static reg load(const float* p) { return _mm256_cvtps_pd(_mm_loadu_ps(p)); }
+        static void store(double* p, const reg v) { _mm256_storeu_pd(p, v); }
+        static reg add(const reg a, const reg b) { return _mm256_add_pd(a, b); }
+        static reg sub(const reg a, const reg b) { return _mm256_sub_pd(a, b); }
+        static reg mul(const reg a, const reg b) { return _mm256_mul_pd(a, b); }
+        static reg div(const reg a, const reg b) { return _mm256_div_pd(a, b); }
+        static reg sqrt(const reg a) { return _mm256_sqrt_pd(a); }
+        static reg fmadd(const reg a, const reg b, const reg c) { return _mm256_fmadd_pd(a, b, c); }
+        static reg abs(const reg a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+        static reg min(const reg a, const reg b) { return _mm256_min_pd(a, b); }
+        static reg max(const reg a, const reg b) { return _mm256_max_pd(a, b); }
+        static T hsum(const reg a) {
+            const __m128d h = _mm_add_pd(_mm256_castpd256_pd128(a), _mm256_extractf128_pd(a, 1));
+            return _mm_cvtsd_f64(_mm_add_sd(h, _mm_unpackhi_pd(h, h)));
+        }
+        static T hmin(const reg a) {
+            const __m128d h = _mm_min_pd(_mm256_castpd256_pd128(a), _mm256_extractf128_pd(a, 1));
+            return _mm_cvtsd_f64(_mm_min_sd(h, _mm_unpackhi_pd(h, h)));
+        }
+        static T hmax(const reg a) {
+            const __m128d h = _mm_max_pd(_mm256_castpd256_pd128(a), _mm256_extractf128_pd(a, 1));
+            return _mm_cvtsd_f64(_mm_max_sd(h, _mm_unpackhi_pd(h, h)));
+        }
+        static bool any_eq(const reg a, const reg b) {
+            return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)) != 0;
+        }
+    };
+
+    struct Avx2F32 {
+        using T = float;
+        using reg = __m256;
+        static constexpr std::size_t W = 8;
+
+        static reg zero() { return _mm256_setzero_ps(); }
+        static reg set1(const T v) { return _mm256_set1_ps(v); }
+        static reg load(const float* p) { return _mm256_loadu_ps(p); }
+        static void store(float* p, const reg v) { _mm256_storeu_ps(p, v); }
+        static reg add(const reg a, const reg b) { return _mm256_add_ps(a, b); }
+        static reg sub(const reg a, const reg b) { return _mm256_sub_ps(a, b); }
+        static reg mul(const reg a, const reg b) { return _mm256_mul_ps(a, b); }
+        static reg div(const reg a, const reg b) { return _mm256_div_ps(a, b); }
+        static reg sqrt(const reg a) { return _mm256_sqrt_ps(a); }
+        static reg fmadd(const reg a, const reg b, const reg c) { return _mm256_fmadd_ps(a, b, c); }
+        static reg abs(const reg a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+        static reg min(const reg a, const reg b) { return _mm256_min_ps(a, b); }
+        static reg max(const reg a, const reg b) { return _mm256_max_ps(a, b); }
+        static T hsum(const reg a) {
+            __m128 h = _mm_add_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+            h = _mm_add_ps(h, _mm_movehl_ps(h, h));
+            return _mm_cvtss_f32(_mm_add_ss(h, _mm_shuffle_ps(h, h, 0x55)));
+        }
+        static T hmin(const reg a) {
+            __m128 h = _mm_min_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+            h = _mm_min_ps(h, _mm_movehl_ps(h, h));
+            return _mm_cvtss_f32(_mm_min_ss(h, _mm_shuffle_ps(h, h, 0x55)));
+        }
+        static T hmax(const reg a) {
+            __m128 h = _mm_max_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+            h = _mm_max_ps(h, _mm_movehl_ps(h, h));
+            return _mm_cvtss_f32(_mm_max_ss(h, _mm_shuffle_ps(h, h, 0x55)));
+        }
+        static bool any_eq(const reg a, const reg b) {
+            return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)) != 0;
+        }
+    };
+
+}
+
+    namespace avx2 {
+        const IsaKernels table = {
+            make_reduce_table<Avx2F64, Avx2F64>(),
+            make_reduce_table<Avx2F32, Avx2F64>(),
+            make_gemm_table<Avx2F64, 6, 2>(),
+            make_gemm_table<Avx2F32, 6, 2>(),
+            make_gemv_table<Avx2F64>(),
+            make_gemv_table<Avx2F32>(),
+            make_batch_table<Avx2F64>(),
+            make_batch_table<Avx2F32>(),
+        };
+    }
+
+}
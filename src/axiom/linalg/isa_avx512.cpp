@@ -0,0 +1,77 @@
+// compiled with -mavx512f -mavx2 -mfma, selected when core::active_isa() == Isa::kAvx512
+
+#include <immintrin.h>
+
+#include "reduce_impl.hpp"
+#include "gemm_impl.hpp"
+#include "gemv_impl.hpp"
+#include "batch_impl.hpp"
+
+namespace axiom::linalg::kernels {
+namespace {
+
+    struct Avx512F64 {
+        using T = double;
+        using reg = __m512d;
+        static constexpr std::size_t W = 8;
+
+        static reg zero() { return _mm512_setzero_pd(); }
+        static reg set1(const T v) { return _mm512_set1_pd(v); }
+        static reg load(const double* p) { return _mm512_loadu_pd(p); }
+        static reg load(const float* p) { return _mm512_cvtps_pd(_mm256_loadu_ps(p)); }
+        static void store(double* p, const reg v) { _mm512_storeu_pd(p, v); }
+        static reg add(const reg a, const reg b) { return _mm512_add_pd(a, b); }
+        static reg sub(const reg a, const reg b) { return _mm512_sub_pd(a, b); }
+        static reg mul(const reg a, const reg b) { return _mm512_mul_pd(a, b); }
+        static reg div(const reg a, const reg b) { return _mm512_div_pd(a, b); }
+        static reg sqrt(const reg a) { return _mm512_sqrt_pd(a); }
+        static reg fmadd(const reg a, const reg b, const reg c) { return _mm512_fmadd_pd(a, b, c); }
+        static reg abs(const reg a) { return _mm512_abs_pd(a); }
+        static reg min(const reg a, const reg b) { return _mm512_min_pd(a, b); }
+        static reg max(const reg a, const reg b) { return _mm512_max_pd(a, b); }
+        static T hsum(const reg a) { return _mm512_reduce_add_pd(a); }
+        static T hmin(const reg a) { return _mm512_reduce_min_pd(a); }
+        static T hmax(const reg a) { return _mm512_reduce_max_pd(a); }
+        static bool any_eq(const reg a, const reg b) { return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ) != 0; }
+    };
+
+    struct Avx512F32 {
+        using T = float;
+        using reg = __m512;
+        static constexpr std::size_t W = 16;
+
+        static reg zero() { return _mm512_setzero_ps(); }
+        static reg set1(const T v) { return _mm512_set1_ps(v); }
+        static reg load(const float* p) { return _mm512_loadu_ps(p); }
+        static void store(float* p, const reg v) { _mm512_storeu_ps(p, v); }
+        static reg add(const reg a, const reg b) { return _mm512_add_ps(a, b); }
+        static reg sub(const reg a, const reg b) { return _mm512_sub_ps(a, b); }
+        static reg mul(const reg a, const reg b) { return _mm512_mul_ps(a, b); }
+        static reg div(const reg a, const reg b) { return _mm512_div_ps(a, b); }
+        static reg sqrt(const reg a) { return _mm512_sqrt_ps(a); }
+        static reg fmadd(const reg a, const reg b, const reg c) { return _mm512_fmadd_ps(a, b, c); }
+        static reg abs(const reg a) { return _mm512_abs_ps(a); }
+        static reg min(const reg a, const reg b) { return _mm512_min_ps(a, b); }
+        static reg max(const reg a, const reg b) { return _mm512_max_ps(a, b); }
+        static T hsum(const reg a) { return _mm512_reduce_add_ps(a); }
+        static T hmin(const reg a) { return _mm512_reduce_min_ps(a); }
+        static T hmax(const reg a) { return _mm512_reduce_max_ps(a); }
+        static bool any_eq(const reg a, const reg b) { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ) != 0; }
+    };
+
+}
+
+    namespace avx512 {
+        const IsaKernels table = {
+            make_reduce_table<Avx512F64, Avx512F64>(),
+            make_reduce_table<Avx512F32, Avx512F64>(),
+            make_gemm_table<Avx512F64, 12, 2>(),
+            make_gemm_table<Avx512F32, 12, 2>(),
+            make_gemv_table<Avx512F64>(),
+            make_gemv_table<Avx512F32>(),
+            make_batch_table<Avx512F64>(),
+            make_batch_table<Avx512F32>(),
+        };
+    }
+
+}
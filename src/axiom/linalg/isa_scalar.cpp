@@ -0,0 +1,55 @@
+// portable fallback kernels, also used on non-x86 targets
+
+#include <cmath>
+
+#include "reduce_impl.hpp"
+#include "gemm_impl.hpp"
+#include "gemv_impl.hpp"
+#include "batch_impl.hpp"
+
+namespace axiom::linalg::kernels {
+namespace {
+
+    // lanes are double for both element types, so float data is accumulated in double
+    template <typename Elem>
+    struct ScalarOps {
+        using T = Elem;
+        using reg = double;
+        static constexpr std::size_t W = 1;
+
+        static reg zero() { return 0.0; }
+        static reg set1(const T v) { return v; }
+        static reg load(const double* p) { return *p; }
+        static reg load(const float* p) { return *p; }
+        static void store(T* p, const reg v) { *p = static_cast<T>(v); }
+        static reg add(const reg a, const reg b) { return a + b; }
+        static reg sub(const reg a, const reg b) { return a - b; }
+        static reg mul(const reg a, const reg b) { return a * b; }
+        static reg div(const reg a, const reg b) { return a / b; }
+        static reg sqrt(const reg a) { return std::sqrt(a); }
+        static reg fmadd(const reg a, const reg b, const reg c) { return a * b + c; }
+        static reg abs(const reg a) { return a < 0.0 ? -a : a; }
+        static reg min(const reg a, const reg b) { return a < b ? a : b; }
+        static reg max(const reg a, const reg b) { return a > b ? a : b; }
+        static reg hsum(const reg a) { return a; }
+        static T hmin(const reg a) { return static_cast<T>(a); }
+        static T hmax(const reg a) { return static_cast<T>(a); }
+        static bool any_eq(const reg a, const reg b) { return a == b; }
+    };
+
+}
+
+    namespace scalar {
+        const IsaKernels table = {
+            make_reduce_table<ScalarOps<double>, ScalarOps<double>>(),
+            make_reduce_table<ScalarOps<float>, ScalarOps<double>>(),
+            make_gemm_table<ScalarOps<double>, 4, 4>(),
+            make_gemm_table<ScalarOps<float>, 4, 4>(),
+            make_gemv_table<ScalarOps<double>>(),
+            make_gemv_table<ScalarOps<float>>(),
+            make_batch_table<ScalarOps<double>>(),
+            make_batch_table<ScalarOps<float>>(),
+        };
+    }
+
+}
@@ -0,0 +1,88 @@
+// compiled with -msse2, selected when core::active_isa() == Isa::kSse2
+
+#include <emmintrin.h>
+
+#include "reduce_impl.hpp"
+#include "gemm_impl.hpp"
+#include "gemv_impl.hpp"
+#include "batch_impl.hpp"
+
+namespace axiom::linalg::kernels {
+namespace {
+
+    struct Sse2F64 {
+        using T = double;
+        using reg = __m128d;
+        static constexpr std::size_t W = 2;
+
+        static reg zero() { return _mm_setzero_pd(); }
+        static reg set1(const T v) { return _mm_set1_pd(v); }
+        static reg load(const double* p) { return _mm_loadu_pd(p); }
+        static reg load(const float* p) {
+            return _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p))));
+        }
+        static void store(double* p, const reg v) { _mm_storeu_pd(p, v); }
+        static reg add(const reg a, const reg b) { return _mm_add_pd(a, b); }
+        static reg sub(const reg a, const reg b) { return _mm_sub_pd(a, b); }
+        static reg mul(const reg a, const reg b) { return _mm_mul_pd(a, b); }
+        static reg div(const reg a, const reg b) { return _mm_div_pd(a, b); }
+        static reg sqrt(const reg a) { return _mm_sqrt_pd(a); }
+        static reg fmadd(const reg a, const reg b, const reg c) { return _mm_add_pd(_mm_mul_pd(a, b), c); }
+        static reg abs(const reg a) { return _mm_andnot_pd(_mm_set1_pd(-0.0), a); }
+        static reg min(const reg a, const reg b) { return _mm_min_pd(a, b); }
+        static reg max(const reg a, const reg b) { return _mm_max_pd(a, b); }
+        static T hsum(const reg a) { return _mm_cvtsd_f64(_mm_add_sd(a, _mm_unpackhi_pd(a, a))); }
+        static T hmin(const reg a) { return _mm_cvtsd_f64(_mm_min_sd(a, _mm_unpackhi_pd(a, a))); }
+        static T hmax(const reg a) { return _mm_cvtsd_f64(_mm_max_sd(a, _mm_unpackhi_pd(a, a))); }
+        static bool any_eq(const reg a, const reg b) { return _mm_movemask_pd(_mm_cmpeq_pd(a, b)) != 0; }
+    };
+
+    struct Sse2F32 {
+        using T = float;
+        using reg = __m128;
+        static constexpr std::size_t W = 4;
+
+        static reg zero() { return _mm_setzero_ps(); }
+        static reg set1(const T v) { return _mm_set1_ps(v); }
+        static reg load(const float* p) { return _mm_loadu_ps(p); }
+        static void store(float* p, const reg v) { _mm_storeu_ps(p, v); }
+        static reg add(const reg a, const reg b) { return _mm_add_ps(a, b); }
+        static reg sub(const reg a, const reg b) { return _mm_sub_ps(a, b); }
+        static reg mul(const reg a, const reg b) { return _mm_mul_ps(a, b); }
+        static reg div(const reg a, const reg b) { return _mm_div_ps(a, b); }
+        static reg sqrt(const reg a) { return _mm_sqrt_ps(a); }
+        static reg fmadd(const reg a, const reg b, const reg c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+        static reg abs(const reg a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+        static reg min(const reg a, const reg b) { return _mm_min_ps(a, b); }
+        static reg max(const reg a, const reg b) { return _mm_max_ps(a, b); }
+        static T hsum(const reg a) {
+            const reg h = _mm_add_ps(a, _mm_movehl_ps(a, a));
+            return _mm_cvtss_f32(_mm_add_ss(h, _mm_shuffle_ps(h, h, 0x55)));
+        }
+        static T hmin(const reg a) {
+            const reg h = _mm_min_ps(a, _mm_movehl_ps(a, a));
+            return _mm_cvtss_f32(_mm_min_ss(h, _mm_shuffle_ps(h, h, 0x55)));
+        }
+        static T hmax(const reg a) {
+            const reg h = _mm_max_ps(a, _mm_movehl_ps(a, a));
+            return _mm_cvtss_f32(_mm_max_ss(h, _mm_shuffle_ps(h, h, 0x55)));
+        }
+        static bool any_eq(const reg a, const reg b) { return _mm_movemask_ps(_mm_cmpeq_ps(a, b)) != 0; }
+    };
+
+}
+
+    namespace sse2 {
+        const IsaKernels table = {
+            make_reduce_table<Sse2F64, Sse2F64>(),
+            make_reduce_table<Sse2F32, Sse2F64>(),
+            make_gemm_table<Sse2F64, 4, 2>(),
+            make_gemm_table<Sse2F32, 4, 2>(),
+            make_gemv_table<Sse2F64>(),
+            make_gemv_table<Sse2F32>(),
+            make_batch_table<Sse2F64>(),
+            make_batch_table<Sse2F32>(),
+        };
+    }
+
+}
@@ -0,0 +1,129 @@
+#include "axiom/linalg/kernels.hpp"
+
+#include <limits>
+
+#include "axiom/core/cpu.hpp"
+#include "axiom/core/profile.hpp"
+#include "dispatch.hpp"
+
+namespace axiom::linalg::kernels {
+    const IsaKernels& active_kernels() noexcept {
+        switch (core::active_isa()) {
+#if AXIOM_HAVE_X86_KERNELS
+            case core::Isa::kAvx512: return avx512::table;
+            case core::Isa::kAvx2: return avx2::table;
+            case core::Isa::kSse2: return sse2::table;
+#endif
+            default: return scalar::table;
+        }
+    }
+
+    namespace {
+        template <typename T>
+        const ReduceTable<T>& reduce_table() noexcept {
+            return active_kernels().reduce<T>();
+        }
+
+        template <typename T>
+        core::index arg_extreme(const T* a, const core::index n, const bool max) {
+            // one pass for the value, one (usually short) pass for its first position
+            const ReduceTable<T>& table = reduce_table<T>();
+            const T value = max ? table.max(a, n) : table.min(a, n);
+            const bool found = max ? value > std::numeric_limits<T>::lowest()
+                                   : value < std::numeric_limits<T>::max();
+            if (!found) return 0;
+            return table.find(a, n, value);
+        }
+    }
+
+    double dot(const double* a, const double* b, const core::index n) {
+        AXIOM_PROFILE_KERNEL("kernels::dot", 2 * n, sizeof(double) * 2 * n);
+        return reduce_table<double>().dot(a, b, n);
+    }
+    float dot(const float* a, const float* b, const core::index n) {
+        AXIOM_PROFILE_KERNEL("kernels::dot", 2 * n, sizeof(float) * 2 * n);
+        return reduce_table<float>().dot(a, b, n);
+    }
+
+    double sum(const double* a, const core::index n) {
+        AXIOM_PROFILE_KERNEL("kernels::sum", n, sizeof(double) * n);
+        return reduce_table<double>().sum(a, n);
+    }
+    float sum(const float* a, const core::index n) {
+        AXIOM_PROFILE_KERNEL("kernels::sum", n, sizeof(float) * n);
+        return reduce_table<float>().sum(a, n);
+    }
+
+    double sum_abs(const double* a, const core::index n) {
+        AXIOM_PROFILE_KERNEL("kernels::sum_abs", 2 * n, sizeof(double) * n);
+        return reduce_table<double>().sum_abs(a, n);
+    }
+    float sum_abs(const float* a, const core::index n) {
+        AXIOM_PROFILE_KERNEL("kernels::sum_abs", 2 * n, sizeof(float) * n);
+        return reduce_table<float>().sum_abs(a, n);
+    }
+
+    double max_abs(const double* a, const core::index n) {
+        AXIOM_PROFILE_KERNEL("kernels::max_abs", 2 * n, sizeof(double) * n);
+        return reduce_table<double>().max_abs(a, n);
+    }
+    float max_abs(const float* a, const core::index n) {
+        AXIOM_PROFILE_KERNEL("kernels::max_abs", 2 * n, sizeof(float) * n);
+        return reduce_table<float>().max_abs(a, n);
+    }
+
+    double sum_sq(const double* a, const core::index n) {
+        AXIOM_PROFILE_KERNEL("kernels::sum_sq", 2 * n, sizeof(double) * n);
+        return reduce_table<double>().sum_sq(a, n);
+    }
+    double sum_sq(const float* a, const core::index n) {
+        AXIOM_PROFILE_KERNEL("kernels::sum_sq", 2 * n, sizeof(float) * n);
+        return reduce_table<float>().sum_sq(a, n);
+    }
+
+    double dist_sq(const double* a, const double* b, const core::index n) {
+        AXIOM_PROFILE_KERNEL("kernels::dist_sq", 3 * n, sizeof(double) * 2 * n);
+        return reduce_table<double>().dist_sq(a, b, n);
+    }
+    float dist_sq(const float* a, const float* b, const core::index n) {
+        AXIOM_PROFILE_KERNEL("kernels::dist_sq", 3 * n, sizeof(float) * 2 * n);
+        return reduce_table<float>().dist_sq(a, b, n);
+    }
+
+    double min(const double* a, const core::index n) {
+        AXIOM_PROFILE_KERNEL("kernels::min", n, sizeof(double) * n);
+        return reduce_table<double>().min(a, n);
+    }
+    float min(const float* a, const core::index n) {
+        AXIOM_PROFILE_KERNEL("kernels::min", n, sizeof(float) * n);
+        return reduce_table<float>().min(a, n);
+    }
+
+    double max(const double* a, const core::index n) {
+        AXIOM_PROFILE_KERNEL("kernels::max", n, sizeof(double) * n);
+        return reduce_table<double>().max(a, n);
+    }
+    float max(const float* a, const core::index n) {
+        AXIOM_PROFILE_KERNEL("kernels::max", n, sizeof(float) * n);
+        return reduce_table<float>().max(a, n);
+    }
+
+    core::index argmin(const double* a, const core::index n) {
+        AXIOM_PROFILE_KERNEL("kernels::argmin", n, sizeof(double) * n);
+        return arg_extreme(a, n, false);
+    }
+    core::index argmin(const float* a, const core::index n) {
+        AXIOM_PROFILE_KERNEL("kernels::argmin", n, sizeof(float) * n);
+        return arg_extreme(a, n, false);
+    }
+
+    core::index argmax(const double* a, const core::index n) {
+        AXIOM_PROFILE_KERNEL("kernels::argmax", n, sizeof(double) * n);
+        return arg_extreme(a, n, true);
+    }
+    core::index argmax(const float* a, const core::index n) {
+        AXIOM_PROFILE_KERNEL("kernels::argmax", n, sizeof(float) * n);
+        return arg_extreme(a, n, true);
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,127 @@
+#include "axiom/linalg/mixed.hpp"
+
+#include <cmath>
+
+#include "axiom/core/profile.hpp"
+#include "axiom/linalg/ops.hpp"
+
+namespace axiom::linalg {
+    MixedSolver::MixedSolver(Mat<double> A, const RefineOptions& opts) : a_(std::move(A)), opts_(opts) {
+        if (a_.rows() != a_.cols()) {
+            throw core::Error(core::ErrorCode::kShapeMismatch, "MixedSolver(): matrix must be square");
+        }
+        double max_entry = 0.0;
+        for (core::index i = 0; i < size(); ++i) {
+            const auto row = a_.row(i);
+            a_norm_ = std::max(a_norm_, row.l1_norm());
+            max_entry = std::max(max_entry, row.infty_norm());
+        }
+        // entries float cannot hold go straight to double, with fallback off they round to inf
+        // and the refinement reports kNotConverged
+        if (opts_.fallback && !(max_entry <= std::numeric_limits<float>::max())) {
+            factor_high();
+            return;
+        }
+        factor_low();
+    }
+
+    void MixedSolver::factor_low() {
+        const core::index n = size();
+        Mat<float> low(n, n);
+        for (core::index i = 0; i < n; ++i) {
+            for (core::index j = 0; j < n; ++j) low(i, j) = static_cast<float>(a_(i, j));
+        }
+        if (opts_.factorization == Factorization::kCholesky) {
+            try {
+                chol32_.emplace(opts_.policy, std::move(low), opts_.block);
+            } catch (const core::Error& e) {
+                // not positive definite in float may still be in double
+                if (!opts_.fallback || e.code() != core::ErrorCode::kNotPositiveDefinite) throw;
+                factor_high();
+            }
+            return;
+        }
+        lu32_.emplace(opts_.policy, std::move(low), opts_.block);
+        if (lu32_->is_singular() && opts_.fallback) {
+            lu32_.reset();
+            factor_high();
+        }
+    }
+
+    void MixedSolver::factor_high() {
+        if (opts_.factorization == Factorization::kCholesky) {
+            chol64_.emplace(opts_.policy, a_, opts_.block);
+        } else {
+            lu64_.emplace(opts_.policy, a_, opts_.block);
+        }
+    }
+
+    void MixedSolver::solve_low(Vec<float>& r) const {
+        if (chol32_) chol32_->solve_in_place(r);
+        else lu32_->solve_in_place(r);
+    }
+
+    void MixedSolver::solve_high(Vec<double>& r) const {
+        if (chol64_) chol64_->solve_in_place(r);
+        else lu64_->solve_in_place(r);
+    }
+
+    // r = b - A x, returns |r|_inf / (|A|_inf |x|_inf + |b|_inf)
+    double MixedSolver::backward_error(const VecView<const double> b, const Vec<double>& x, Vec<double>& r) const {
+        for (core::index i = 0; i < size(); ++i) r[i] = b[i];
+        gemv(opts_.policy, -1.0, a_, x, 1.0, r);
+        const double scale = a_norm_ * x.infty_norm() + b.infty_norm();
+        const double rn = r.infty_norm();
+        return scale == 0.0 ? rn : rn / scale;
+    }
+
+    RefineResult MixedSolver::solve_view(const VecView<const double> b, const VecView<double> x) {
+        const core::index n = size();
+        if (b.size() != n || x.size() != n) {
+            throw core::Error(core::ErrorCode::kShapeMismatch, "MixedSolver::solve(): b and x must have A.rows() elements");
+        }
+        AXIOM_PROFILE_SCOPE("linalg::MixedSolver::solve");
+        const double tolerance = opts_.tolerance > 0.0
+            ? opts_.tolerance
+            : std::sqrt(static_cast<double>(n)) * std::numeric_limits<double>::epsilon();
+
+        RefineResult result;
+        Vec<double> xd(n), r(n);
+        if (!fell_back()) {
+            // x0 = A^-1 b in float, then x += A^-1 (b - A x) with the residual in double
+            Vec<float> d(n);
+            for (core::index i = 0; i < n; ++i) d[i] = static_cast<float>(b[i]);
+            solve_low(d);
+            for (core::index i = 0; i < n; ++i) xd[i] = d[i];
+            result.residual = backward_error(b, xd, r);
+            while (!(result.residual <= tolerance) && result.iterations < opts_.max_iterations) {
+                for (core::index i = 0; i < n; ++i) d[i] = static_cast<float>(r[i]);
+                solve_low(d);
+                for (core::index i = 0; i < n; ++i) xd[i] += d[i];
+                ++result.iterations;
+                const double previous = result.residual;
+                result.residual = backward_error(b, xd, r);
+                if (!(result.residual < previous)) {
+                    // diverged, keep the better iterate
+                    for (core::index i = 0; i < n; ++i) xd[i] -= d[i];
+                    result.residual = previous;
+                    break;
+                }
+                if (result.residual > 0.5 * previous) break;
+            }
+            if (result.residual <= tolerance || !opts_.fallback) {
+                result.status = result.residual <= tolerance ? RefineStatus::kConverged : RefineStatus::kNotConverged;
+                for (core::index i = 0; i < n; ++i) x[i] = xd[i];
+                return result;
+            }
+            factor_high();
+        }
+
+        for (core::index i = 0; i < n; ++i) xd[i] = b[i];
+        solve_high(xd);
+        result.residual = backward_error(b, xd, r);
+        result.status = RefineStatus::kFallback;
+        for (core::index i = 0; i < n; ++i) x[i] = xd[i];
+        return result;
+    }
+}
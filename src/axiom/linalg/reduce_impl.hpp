@@ -0,0 +1,205 @@
+#ifndef AXIOM_REDUCE_IMPL_HPP
+#define AXIOM_REDUCE_IMPL_HPP
+
+#include <cfloat>
+#include <cstddef>
+
+#include "dispatch.hpp"
+
+namespace axiom::linalg::kernels {
+// reduction kernels written once against a SIMD traits type S and instantiated by every
+// isa_*.cpp, the unnamed namespace gives each instantiation internal linkage
+//
+// S provides: T, reg, W (lanes), zero, set1, load (T* and, for double traits, widening
+// float*), store, add, sub, mul, div, sqrt, fmadd(a, b, c) = a * b + c, abs, min, max
+// (returning the second operand when either is NaN, like minpd / maxpd), hsum, hmin, hmax
+// and any_eq
+namespace {
+
+    // elements per partial sum: small enough that each accumulator lane only adds
+    // a few dozen terms, large enough that the compensated combine is negligible
+    constexpr std::size_t kReduceBlock = 2048;
+
+    struct CompensatedSum {
+        double sum = 0.0;
+        double c = 0.0;
+
+        void add(const double x) {
+            const double t = sum + x;
+            const double abs_sum = sum < 0.0 ? -sum : sum;
+            const double abs_x = x < 0.0 ? -x : x;
+            if (abs_sum >= abs_x) c += (sum - t) + x;
+            else c += (x - t) + sum;
+            sum = t;
+        }
+
+        [[nodiscard]] double value() const { return sum + c; }
+    };
+
+    // step(acc, i) folds lanes [i, i + W) into acc, tail(i) returns element i as double
+    template <class S, class Step, class Tail>
+    double block_sum(const std::size_t n, Step step, Tail tail) {
+        constexpr std::size_t W = S::W;
+        typename S::reg acc0 = S::zero(), acc1 = S::zero(), acc2 = S::zero(), acc3 = S::zero();
+        std::size_t i = 0;
+        for (; i + 4 * W <= n; i += 4 * W) {
+            acc0 = step(acc0, i);
+            acc1 = step(acc1, i + W);
+            acc2 = step(acc2, i + 2 * W);
+            acc3 = step(acc3, i + 3 * W);
+        }
+        for (; i + W <= n; i += W) acc0 = step(acc0, i);
+        double s = static_cast<double>(S::hsum(S::add(S::add(acc0, acc1), S::add(acc2, acc3))));
+        for (; i < n; ++i) s += tail(i);
+        return s;
+    }
+
+    template <class Block>
+    double blocked(const std::size_t n, Block block) {
+        if (n <= kReduceBlock) return block(std::size_t{0}, n);
+        CompensatedSum acc;
+        for (std::size_t i = 0; i < n; i += kReduceBlock) {
+            acc.add(block(i, n - i < kReduceBlock ? n - i : kReduceBlock));
+        }
+        return acc.value();
+    }
+
+    template <class S>
+    typename S::T dot(const typename S::T* a, const typename S::T* b, const std::size_t n) {
+        using T = typename S::T;
+        return static_cast<T>(blocked(n, [&](const std::size_t off, const std::size_t len) {
+            const T* x = a + off;
+            const T* y = b + off;
+            return block_sum<S>(len,
+                [&](typename S::reg acc, std::size_t i) { return S::fmadd(S::load(x + i), S::load(y + i), acc); },
+                [&](std::size_t i) { return static_cast<double>(x[i] * y[i]); });
+        }));
+    }
+
+    template <class S>
+    typename S::T sum(const typename S::T* a, const std::size_t n) {
+        using T = typename S::T;
+        return static_cast<T>(blocked(n, [&](const std::size_t off, const std::size_t len) {
+            const T* x = a + off;
+            return block_sum<S>(len,
+                [&](typename S::reg acc, std::size_t i) { return S::add(acc, S::load(x + i)); },
+                [&](std::size_t i) { return static_cast<double>(x[i]); });
+        }));
+    }
+
+    template <class S>
+    typename S::T sum_abs(const typename S::T* a, const std::size_t n) {
+        using T = typename S::T;
+        return static_cast<T>(blocked(n, [&](const std::size_t off, const std::size_t len) {
+            const T* x = a + off;
+            return block_sum<S>(len,
+                [&](typename S::reg acc, std::size_t i) { return S::add(acc, S::abs(S::load(x + i))); },
+                [&](std::size_t i) { return static_cast<double>(x[i] < T{} ? -x[i] : x[i]); });
+        }));
+    }
+
+    // SW is the double-precision traits of the same ISA, In is double or float
+    template <class SW, class In>
+    double sum_sq(const In* a, const std::size_t n) {
+        return blocked(n, [&](const std::size_t off, const std::size_t len) {
+            const In* x = a + off;
+            return block_sum<SW>(len,
+                [&](typename SW::reg acc, std::size_t i) {
+                    const typename SW::reg v = SW::load(x + i);
+                    return SW::fmadd(v, v, acc);
+                },
+                [&](std::size_t i) {
+                    const double v = static_cast<double>(x[i]);
+                    return v * v;
+                });
+        });
+    }
+
+    template <class S>
+    typename S::T dist_sq(const typename S::T* a, const typename S::T* b, const std::size_t n) {
+        using T = typename S::T;
+        return static_cast<T>(blocked(n, [&](const std::size_t off, const std::size_t len) {
+            const T* x = a + off;
+            const T* y = b + off;
+            return block_sum<S>(len,
+                [&](typename S::reg acc, std::size_t i) {
+                    const typename S::reg d = S::sub(S::load(x + i), S::load(y + i));
+                    return S::fmadd(d, d, acc);
+                },
+                [&](std::size_t i) {
+                    const T d = x[i] - y[i];
+                    return static_cast<double>(d * d);
+                });
+        }));
+    }
+
+    // Max selects max vs min, Abs reduces |a_i| instead of a_i
+    template <class S, bool Max, bool Abs>
+    typename S::T extreme(const typename S::T* a, const std::size_t n, const typename S::T init) {
+        using T = typename S::T;
+        using reg = typename S::reg;
+        constexpr std::size_t W = S::W;
+        const auto pick = [](reg x, reg acc) { return Max ? S::max(x, acc) : S::min(x, acc); };
+        const auto load = [&](std::size_t i) { return Abs ? S::abs(S::load(a + i)) : S::load(a + i); };
+        reg acc0 = S::set1(init), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+        std::size_t i = 0;
+        for (; i + 4 * W <= n; i += 4 * W) {
+            acc0 = pick(load(i), acc0);
+            acc1 = pick(load(i + W), acc1);
+            acc2 = pick(load(i + 2 * W), acc2);
+            acc3 = pick(load(i + 3 * W), acc3);
+        }
+        for (; i + W <= n; i += W) acc0 = pick(load(i), acc0);
+        const reg acc = pick(pick(acc0, acc1), pick(acc2, acc3));
+        T r = Max ? S::hmax(acc) : S::hmin(acc);
+        for (; i < n; ++i) {
+            const T x = Abs ? (a[i] < T{} ? -a[i] : a[i]) : a[i];
+            if (Max ? x > r : x < r) r = x;
+        }
+        return r;
+    }
+
+    template <class S>
+    typename S::T max_abs(const typename S::T* a, const std::size_t n) {
+        return extreme<S, true, true>(a, n, typename S::T{});
+    }
+
+    template <class S>
+    typename S::T min_value(const typename S::T* a, const std::size_t n) {
+        using T = typename S::T;
+        if constexpr (sizeof(T) == sizeof(double)) return extreme<S, false, false>(a, n, DBL_MAX);
+        else return extreme<S, false, false>(a, n, FLT_MAX);
+    }
+
+    template <class S>
+    typename S::T max_value(const typename S::T* a, const std::size_t n) {
+        using T = typename S::T;
+        if constexpr (sizeof(T) == sizeof(double)) return extreme<S, true, false>(a, n, -DBL_MAX);
+        else return extreme<S, true, false>(a, n, -FLT_MAX);
+    }
+
+    template <class S>
+    std::size_t find(const typename S::T* a, const std::size_t n, const typename S::T v) {
+        constexpr std::size_t W = S::W;
+        const typename S::reg needle = S::set1(v);
+        std::size_t i = 0;
+        for (; i + W <= n; i += W) {
+            if (!S::any_eq(S::load(a + i), needle)) continue;
+            for (std::size_t k = i; k < i + W; ++k) if (a[k] == v) return k;
+        }
+        for (; i < n; ++i) if (a[i] == v) return i;
+        return n;
+    }
+
+    template <class S, class SW>
+    constexpr ReduceTable<typename S::T> make_reduce_table() {
+        return {
+            &dot<S>, &sum<S>, &sum_abs<S>, &max_abs<S>, &sum_sq<SW, typename S::T>,
+            &dist_sq<S>, &min_value<S>, &max_value<S>, &find<S>
+        };
+    }
+
+}
+}
+
+#endif //AXIOM_REDUCE_IMPL_HPP
\ No newline at end of file
@@ -0,0 +1,73 @@
+#include <catch2/catch_test_macros.hpp>
+#include "catch2/catch_approx.hpp"
+#include <cmath>
+
+#include "axiom/ad/dual.hpp"
+#include "axiom/linalg/fixed.hpp"
+#include "axiom/linalg/ops.hpp"
+
+#include "../test_util.hpp"
+
+using axiom::ad::Dual;
+using axiom::linalg::Vec;
+using axiom::test::rosenbrock;
+
+TEST_CASE("dual numbers carry exact derivatives", "[ad][dual]") {
+    using std::exp;
+    using std::sin;
+    using std::sqrt;
+    const auto f = [](const auto x) { return sin(x) * exp(x) / sqrt(x) + pow(x, 3.0) - 2 * x; };
+    const double x = 0.7;
+    const double expected = std::cos(x) * std::exp(x) / std::sqrt(x) + std::sin(x) * std::exp(x) / std::sqrt(x)
+        - 0.5 * std::sin(x) * std::exp(x) / (x * std::sqrt(x)) + 3 * x * x - 2;
+    REQUIRE(axiom::ad::derivative(f, x) == Catch::Approx(expected).epsilon(1e-14));
+    REQUIRE(f(Dual<double>(x)).val == Catch::Approx(f(x)));
+
+    const Dual<float> t(0.5f, 1.0f);
+    REQUIRE(tanh(t).eps == Catch::Approx(1.0f - std::tanh(0.5f) * std::tanh(0.5f)));
+    REQUIRE(log(t).eps == Catch::Approx(2.0f));
+    REQUIRE(abs(-t).eps == Catch::Approx(1.0f));
+    REQUIRE(pow(Dual<double>(2.0), Dual<double>(3.0, 1.0)).eps == Catch::Approx(8.0 * std::log(2.0)));
+
+    REQUIRE(Dual<double>(1.0, 5.0) < 2.0);
+    REQUIRE(Dual<double>(1.0, 5.0) == Dual<double>(1.0, -1.0));
+}
+
+TEST_CASE("dual numbers work as the scalar of Vec and ops", "[ad][dual]") {
+    using D = Dual<double>;
+    Vec<D> a(3), b(3);
+    for (std::size_t i = 0; i < 3; ++i) {
+        a[i] = D(1.0 + i, i == 1 ? 1.0 : 0.0);
+        b[i] = D(2.0 * i);
+    }
+    // d/da_1 (a . b) = b_1
+    REQUIRE(axiom::linalg::dot(a, b).eps == 2.0);
+    const Vec<D> c = a + 2.0 * b;
+    REQUIRE(c[1].val == 6.0);
+    REQUIRE(c[1].eps == 1.0);
+
+    using V3 = Vec<D, 3>;
+    const V3 u(D(1.0, 1.0), D(0.0), D(0.0));
+    const V3 v(D(0.0), D(1.0), D(0.0));
+    REQUIRE(axiom::linalg::cross(u, v)[2].eps == 1.0);
+}
+
+TEST_CASE("forward gradients match the hand-written one", "[ad][dual]") {
+    auto fg = axiom::ad::forward_gradient<double>(4, [](const auto& x) { return rosenbrock(x); });
+    Vec<double> x(4), g(4);
+    for (std::size_t i = 0; i < 4; ++i) x[i] = 0.3 * static_cast<double>(i) - 0.5;
+    const double f = fg(x, g);
+    REQUIRE(f == Catch::Approx(rosenbrock(x)));
+    for (std::size_t i = 0; i < 4; ++i) {
+        double expected = 0.0;
+        if (i + 1 < 4) expected += -400.0 * (x[i + 1] - x[i] * x[i]) * x[i] - 2.0 * (1.0 - x[i]);
+        if (i > 0) expected += 200.0 * (x[i] - x[i - 1] * x[i - 1]);
+        REQUIRE(g[i] == Catch::Approx(expected).epsilon(1e-13));
+    }
+
+    // J v in one pass equals g . v
+    const Vec<double> v = Vec<double>::ones(4);
+    REQUIRE(fg.directional(x, v) == Catch::Approx(g[0] + g[1] + g[2] + g[3]));
+    Vec<double> wrong(3);
+    REQUIRE_THROWS_AS(fg(x, wrong), axiom::core::Error);
+}
@@ -0,0 +1,122 @@
+#include <catch2/catch_test_macros.hpp>
+#include "catch2/catch_approx.hpp"
+#include <cmath>
+
+#include "axiom/ad/dual.hpp"
+#include "axiom/ad/tape.hpp"
+#include "axiom/core/memory.hpp"
+#include "axiom/linalg/ops.hpp"
+#include "axiom/opt/lbfgs.hpp"
+
+#include "../test_util.hpp"
+
+using axiom::ad::Tape;
+using axiom::ad::Var;
+using axiom::linalg::Vec;
+using axiom::test::rosenbrock;
+
+namespace {
+    // a bit of everything the tape records
+    template <typename S>
+    S mixed(const Vec<S>& x) {
+        using std::exp;
+        using std::log;
+        using std::cos;
+        using std::tanh;
+        return exp(x[0]) * cos(x[1]) + log(x[2]) / x[0] - tanh(x[1] * x[2]) + pow(x[2], 2.5) + pow(x[0], x[2]);
+    }
+}
+
+TEST_CASE("one backward pass gives the whole gradient", "[ad][tape]") {
+    Tape<double> tape;
+    const Var<double> x = tape.variable(2.0), y = tape.variable(3.0);
+    const Var<double> f = x * y + sin(x) - y / x;
+    tape.backward(f);
+    REQUIRE(tape.value(f) == Catch::Approx(6.0 + std::sin(2.0) - 1.5));
+    REQUIRE(tape.adjoint(x) == Catch::Approx(3.0 + std::cos(2.0) + 3.0 / 4.0));
+    REQUIRE(tape.adjoint(y) == Catch::Approx(2.0 - 0.5));
+
+    // reverse and forward mode agree
+    Vec<double> p(3);
+    p[0] = 0.8;
+    p[1] = -0.4;
+    p[2] = 1.7;
+    Vec<double> gr(3), gf(3);
+    auto reverse = axiom::ad::reverse_gradient<double>(3, [](const auto& v) { return mixed(v); });
+    auto forward = axiom::ad::forward_gradient<double>(3, [](const auto& v) { return mixed(v); });
+    REQUIRE(reverse(p, gr) == Catch::Approx(forward(p, gf)));
+    for (std::size_t i = 0; i < 3; ++i) REQUIRE(gr[i] == Catch::Approx(gf[i]).epsilon(1e-13));
+}
+
+TEST_CASE("variables work as the scalar of Vec and ops", "[ad][tape]") {
+    Tape<double> tape;
+    Vec<Var<double>> a(4), b(4);
+    for (std::size_t i = 0; i < 4; ++i) {
+        a[i] = tape.variable(static_cast<double>(i));
+        b[i] = 2.0 * static_cast<double>(i) + 1.0;      // constants
+    }
+    const Var<double> d = axiom::linalg::dot(a, b);
+    tape.backward(d);
+    Vec<double> g(4);
+    tape.gradient(std::span<const Var<double>>(&a[0], 4), g);
+    for (std::size_t i = 0; i < 4; ++i) REQUIRE(g[i] == 2.0 * static_cast<double>(i) + 1.0);
+
+    // constants alone never touch a tape
+    const Var<double> c = Var<double>(2.0) * 3.0;
+    REQUIRE(c.is_constant());
+    REQUIRE(c.value() == 6.0);
+}
+
+TEST_CASE("a static graph is replayed without recording", "[ad][tape]") {
+    auto fg = axiom::ad::reverse_gradient<double>(6, [](const auto& x) { return rosenbrock(x); }, true);
+    Vec<double> x = Vec<double>::ones(6), g(6);
+    REQUIRE(fg(x, g) == 0.0);
+    const auto recorded = fg.tape().size();
+    REQUIRE(recorded > 6);
+
+    axiom::core::reset_memory_stats();
+    for (int k = 0; k < 5; ++k) {
+        for (std::size_t i = 0; i < 6; ++i) x[i] = 0.1 * (k + 1) * static_cast<double>(i) - 0.3;
+        const double f = fg(x, g);
+        REQUIRE(f == Catch::Approx(rosenbrock(x)));
+        REQUIRE(g[1] == Catch::Approx(-400.0 * (x[2] - x[1] * x[1]) * x[1] - 2.0 * (1.0 - x[1])
+                                      + 200.0 * (x[1] - x[0] * x[0])));
+    }
+    const auto stats = axiom::core::memory_stats();
+    REQUIRE(stats.heap_allocations == 0);
+    REQUIRE(stats.arena_allocations == 0);
+    REQUIRE(fg.tape().size() == recorded);
+}
+
+TEST_CASE("re-recording reuses the arena blocks", "[ad][tape]") {
+    Tape<float> tape;
+    for (int round = 0; round < 3; ++round) {
+        tape.clear();
+        Var<float> s = tape.variable(1.0f);
+        const Var<float> x = s;
+        for (int i = 0; i < 3000; ++i) s = s * 1.0001f + x;
+        if (round == 0) axiom::core::reset_memory_stats();
+        tape.backward(s);
+        REQUIRE(tape.size() == 1 + 3000 * 3);      // constant, product, sum
+        REQUIRE(tape.adjoint(x) > 3000.0f);
+    }
+    REQUIRE(axiom::core::memory_stats().heap_allocations == 0);
+    REQUIRE(tape.capacity() >= tape.size());
+
+    Tape<float> other;
+    REQUIRE_THROWS_AS(other.backward(tape.variable(1.0f)), axiom::core::Error);
+    REQUIRE_THROWS_AS(other.set_value(tape.variable(1.0f), 2.0f), axiom::core::Error);
+    REQUIRE_THROWS_AS(tape.variable(1.0f) * other.variable(2.0f), axiom::core::Error);
+    REQUIRE_NOTHROW(other.variable(1.0f) + 2.0f);
+}
+
+TEST_CASE("tape gradients drive L-BFGS", "[ad][tape]") {
+    auto fg = axiom::ad::reverse_gradient<double>(10, [](const auto& x) { return rosenbrock(x); }, true);
+    Vec<double> x(10);
+    for (std::size_t i = 0; i < 10; ++i) x[i] = i % 2 == 0 ? -1.2 : 1.0;
+    axiom::opt::LbfgsOptions options;
+    options.grad_tol = 1e-8;
+    const auto r = axiom::opt::Lbfgs<double>(10, options).minimize(fg, x);
+    REQUIRE(r.converged());
+    for (std::size_t i = 0; i < 10; ++i) REQUIRE(x[i] == Catch::Approx(1.0).margin(1e-6));
+}
@@ -0,0 +1,102 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <vector>
+
+#include "axiom/core/memory.hpp"
+#include "axiom/linalg/ops.hpp"
+
+using axiom::core::ArenaScope;
+using axiom::linalg::Mat;
+using axiom::linalg::Vec;
+
+namespace {
+    bool aligned(const void* p) {
+        return reinterpret_cast<std::uintptr_t>(p) % axiom::core::kAlignment == 0;
+    }
+}
+
+TEST_CASE("Vec and Mat storage is 64-byte aligned", "[core][memory]") {
+    for (std::size_t n = 1; n < 40; ++n) {
+        REQUIRE(aligned(Vec<double>(n).data()));
+        REQUIRE(aligned(Vec<float>(n).data()));
+        REQUIRE(aligned(Mat<double>(n, 3).data()));
+    }
+    const Vec<double> v(std::vector<double>{1.0, 2.0, 3.0});
+    REQUIRE(aligned(v.data()));
+    REQUIRE(v[2] == 3.0);
+    REQUIRE(aligned(Mat<float>::identity(5).data()));
+}
+
+TEST_CASE("heap counters track Vec allocations", "[core][memory]") {
+    axiom::core::reset_memory_stats();
+    {
+        const Vec<double> a(100);
+        const Vec<double> b = a;
+        REQUIRE(axiom::core::memory_stats().heap_allocations == 2);
+        REQUIRE(axiom::core::memory_stats().heap_bytes == 2 * 100 * sizeof(double));
+    }
+    REQUIRE(axiom::core::memory_stats().heap_deallocations == 2);
+}
+
+TEST_CASE("arena scopes release scratch in bulk and reach zero heap traffic", "[core][memory]") {
+    const Vec<double> x = Vec<double>::ones(256);
+    const Mat<double> A = Mat<double>::ones(64, 64);
+    Vec<double> acc(256);
+
+    const auto iteration = [&] {
+        const ArenaScope scope;
+        const Vec<double> t = 2.0 * x + x;
+        const Mat<double> B = axiom::linalg::matmul(A, A);
+        REQUIRE(aligned(t.data()));
+        REQUIRE(aligned(B.data()));
+        acc += t;
+    };
+
+    iteration();  // warm-up grows the thread's arena
+    axiom::core::reset_memory_stats();
+    for (int i = 0; i < 10; ++i) iteration();
+
+    const auto stats = axiom::core::memory_stats();
+    REQUIRE(stats.heap_allocations == 0);
+    REQUIRE(stats.heap_deallocations == 0);
+    REQUIRE(stats.arena_allocations >= 20);
+    REQUIRE(acc[0] == 33.0);
+}
+
+TEST_CASE("arena rewinds to the enclosing scope and copies escape to the heap", "[core][memory]") {
+    axiom::core::Arena arena(1024);
+    Vec<double> kept(8);
+    {
+        const ArenaScope outer(arena);
+        const Vec<double> a(16);
+        const auto after_outer = arena.mark();
+        {
+            const ArenaScope inner(arena);
+            const Vec<double> big(4096);  // larger than a chunk
+            REQUIRE(aligned(big.data()));
+            REQUIRE(arena.capacity() >= 4096 * sizeof(double));
+        }
+        REQUIRE(arena.mark().ptr == after_outer.ptr);
+
+        Vec<double> scratch = Vec<double>::ones(8);
+        kept = std::move(scratch);  // kept keeps its own storage
+        REQUIRE(kept.data() != scratch.data());
+
+        axiom::core::reset_memory_stats();
+        const Vec<double> copy = a;  // copies bind the current resource, still the arena here
+        REQUIRE(axiom::core::memory_stats().heap_allocations == 0);
+    }
+    REQUIRE(axiom::core::current_resource() == axiom::core::aligned_resource());
+    REQUIRE(kept[7] == 1.0);
+
+    const std::size_t cap = arena.capacity();
+    {
+        const ArenaScope again(arena);
+        const Vec<double> a(16);
+        const Vec<double> b(4096);
+    }
+    REQUIRE(arena.capacity() == cap);
+
+    arena.release();
+    REQUIRE(arena.capacity() == 0);
+}
@@ -0,0 +1,129 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "axiom/exec/exec.hpp"
+#include "axiom/core/profile.hpp"
+#include "axiom/linalg/ops.hpp"
+
+namespace profile = axiom::core::profile;
+using axiom::linalg::Vec;
+
+namespace {
+    const profile::Stats* find(const std::vector<profile::Stats>& stats, const std::string& name) {
+        for (const auto& s : stats) {
+            if (s.name == name) return &s;
+        }
+        return nullptr;
+    }
+
+    std::string read_file(const std::string& path) {
+        std::ifstream in(path);
+        std::stringstream text;
+        text << in.rdbuf();
+        return text.str();
+    }
+
+    void inner_scope() {
+        AXIOM_PROFILE_SCOPE("spec::inner");
+        const Vec<double> v(64);
+        (void)v;
+    }
+}
+
+TEST_CASE("profile scopes count calls, time and allocations", "[core][profile]") {
+    profile::reset();
+    {
+        AXIOM_PROFILE_SCOPE("spec::outer");
+        for (int i = 0; i < 3; ++i) inner_scope();
+        const Vec<double> w(16);
+        (void)w;
+    }
+    const auto stats = profile::snapshot();
+    if (!profile::enabled()) {
+        REQUIRE(stats.empty());
+        return;
+    }
+
+    const auto* outer = find(stats, "spec::outer");
+    const auto* inner = find(stats, "spec::inner");
+    REQUIRE(outer != nullptr);
+    REQUIRE(inner != nullptr);
+    REQUIRE(outer->calls == 1);
+    REQUIRE(inner->calls == 3);
+    REQUIRE(inner->threads == 1);
+    REQUIRE(inner->min_seconds <= inner->max_seconds);
+    REQUIRE(outer->seconds >= inner->seconds);
+
+    // inclusive: the outer scope also sees the three inner buffers
+    REQUIRE(inner->allocations == 3);
+    REQUIRE(inner->alloc_bytes >= 3 * 64 * sizeof(double));
+    REQUIRE(outer->allocations == 4);
+    REQUIRE(outer->alloc_bytes >= inner->alloc_bytes + 16 * sizeof(double));
+
+    profile::reset();
+    REQUIRE(profile::snapshot().empty());
+}
+
+TEST_CASE("kernels report their flop and byte counts", "[core][profile]") {
+    profile::reset();
+    const auto x = Vec<double>::ones(1000);
+    const auto y = Vec<double>::ones(1000);
+    REQUIRE(axiom::linalg::dot(x, y) == 1000.0);
+    REQUIRE(axiom::linalg::dot(x, y) == 1000.0);
+
+    const auto stats = profile::snapshot();
+    if (!profile::enabled()) {
+        REQUIRE(stats.empty());
+        return;
+    }
+    const auto* dot = find(stats, "kernels::dot");
+    REQUIRE(dot != nullptr);
+    REQUIRE(dot->calls == 2);
+    REQUIRE(dot->flops == 2.0 * 2000.0);
+    REQUIRE(dot->bytes == 2.0 * 2000.0 * sizeof(double));
+}
+
+TEST_CASE("per-thread records are merged by name", "[core][profile]") {
+    profile::reset();
+    axiom::exec::parallel_for(axiom::exec::on_threads(4), 8, [](const axiom::core::index lo, const axiom::core::index hi) {
+        for (axiom::core::index t = lo; t < hi; ++t) {
+            AXIOM_PROFILE_SCOPE("spec::task");
+        }
+    });
+    const auto stats = profile::snapshot();
+    if (!profile::enabled()) {
+        REQUIRE(stats.empty());
+        return;
+    }
+    const auto* task = find(stats, "spec::task");
+    REQUIRE(task != nullptr);
+    REQUIRE(task->calls == 8);
+    REQUIRE(task->threads >= 1);
+    REQUIRE(profile::summary().find("spec::task") != std::string::npos);
+}
+
+TEST_CASE("chrome trace output", "[core][profile]") {
+    profile::reset();
+    {
+        AXIOM_PROFILE_KERNEL("spec::traced", 10, 80);
+    }
+    const std::string path = "axiom_profile_spec_trace.json";
+    profile::write_chrome_trace(path);
+    const std::string trace = read_file(path);
+    std::remove(path.c_str());
+
+    REQUIRE(trace.find("\"traceEvents\"") != std::string::npos);
+    REQUIRE(trace.back() == '\n');
+    if (profile::enabled()) {
+        REQUIRE(trace.find("\"name\": \"spec::traced\", \"ph\": \"X\"") != std::string::npos);
+        REQUIRE(trace.find("\"flops\": 10") != std::string::npos);
+        REQUIRE(trace.find("thread_name") != std::string::npos);
+    } else {
+        REQUIRE(trace.find("spec::traced") == std::string::npos);
+        REQUIRE(profile::summary().find("disabled") != std::string::npos);
+    }
+}
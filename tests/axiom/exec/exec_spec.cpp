@@ -0,0 +1,176 @@
+#include <catch2/catch_test_macros.hpp>
+#include "catch2/catch_approx.hpp"
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "axiom/exec/exec.hpp"
+#include "axiom/linalg/ops.hpp"
+
+using axiom::core::index;
+using axiom::exec::Parallel;
+using axiom::exec::Sequential;
+using axiom::exec::ThreadPool;
+using axiom::linalg::Vec;
+
+namespace {
+    // values spread over many magnitudes, so the summation order shows in the last bits
+    Vec<double> spread(const std::size_t n) {
+        Vec<double> v(n);
+        for (std::size_t i = 0; i < n; ++i) v[i] = std::sin(static_cast<double>(i)) * std::pow(10.0, i % 9);
+        return v;
+    }
+}
+
+TEST_CASE("ThreadPool covers every index exactly once", "[exec][pool]") {
+    ThreadPool pool(4);
+    REQUIRE(pool.size() == 4);
+    for (const index n : {index{1}, index{7}, index{1000}, index{100003}}) {
+        for (const index grain : {index{1}, index{16}, index{5000}}) {
+            std::vector<std::atomic<int>> hits(n);
+            std::atomic<index> bad{0};
+            pool.run(n, grain, 0, [&](const index lo, const index hi, const index id) {
+                if (hi - lo > grain || id >= 4) ++bad;
+                for (index i = lo; i < hi; ++i) ++hits[i];
+            });
+            REQUIRE(bad == 0);
+            for (index i = 0; i < n; ++i) REQUIRE(hits[i] == 1);
+        }
+    }
+
+    pool.reserve(6);
+    REQUIRE(pool.size() == 6);
+    std::atomic<index> total{0};
+    pool.run(10000, 1, 6, [&](const index lo, const index hi, index) { total += hi - lo; });
+    REQUIRE(total == 10000);
+}
+
+TEST_CASE("ThreadPool rethrows and runs nested jobs serially", "[exec][pool]") {
+    ThreadPool pool(3);
+    REQUIRE_THROWS_AS(pool.run(1000, 1, 0, [](const index lo, index, index) {
+        if (lo == 500) throw std::runtime_error("boom");
+    }), std::runtime_error);
+
+    // the pool is usable after a failed job, inner calls do not deadlock
+    std::atomic<index> inner{0}, bad{0};
+    pool.run(8, 1, 0, [&](index, index, index) {
+        if (!ThreadPool::in_job()) ++bad;
+        pool.run(100, 10, 0, [&](const index lo, const index hi, const index id) {
+            if (id != 0) ++bad;
+            inner += hi - lo;
+        });
+    });
+    REQUIRE(bad == 0);
+    REQUIRE(inner == 800);
+    REQUIRE_FALSE(ThreadPool::in_job());
+}
+
+TEST_CASE("on_threads runs every index on the pool whatever the size", "[exec][pool]") {
+    std::vector<int> hits(7, 0);
+    std::atomic<int> chunks{0};
+    axiom::exec::parallel_for(axiom::exec::on_threads(3), hits.size(), [&](const index lo, const index hi) {
+        ++chunks;
+        for (index t = lo; t < hi; ++t) ++hits[t];
+    });
+    for (const int h : hits) REQUIRE(h == 1);
+    REQUIRE(chunks == 7);
+    REQUIRE(axiom::exec::concurrency(axiom::exec::on_threads(3), 7) == 3);
+    REQUIRE(axiom::exec::concurrency(axiom::exec::on_threads(3), 1) == 1);
+    REQUIRE(axiom::exec::concurrency(axiom::exec::seq, 1000000) == 1);
+    REQUIRE(axiom::exec::concurrency(axiom::exec::par, 1000) == 1);
+}
+
+TEST_CASE("parallel_for keeps small inputs serial", "[exec]") {
+    std::atomic<int> calls{0};
+    axiom::exec::parallel_for(axiom::exec::par, 1000, [&](const index lo, const index hi) {
+        ++calls;
+        REQUIRE(lo == 0);
+        REQUIRE(hi == 1000);
+    });
+    REQUIRE(calls == 1);
+
+    std::vector<int> hits(50000, 0);
+    calls = 0;
+    axiom::exec::parallel_for(Parallel{.threads = 4, .grain = 1000}, hits.size(), [&](const index lo, const index hi) {
+        ++calls;
+        for (index i = lo; i < hi; ++i) ++hits[i];
+    });
+    REQUIRE(calls >= 50);
+    for (const int h : hits) REQUIRE(h == 1);
+
+    axiom::exec::parallel_for(axiom::exec::seq, 0, [](index, index) { FAIL("empty range"); });
+}
+
+TEST_CASE("parallel_reduce matches the serial result", "[exec]") {
+    const std::size_t n = 200001;
+    const Vec<double> v = spread(n);
+    double serial = 0.0;
+    for (std::size_t i = 0; i < n; ++i) serial += v[i];
+
+    const auto body = [&](const index lo, const index hi) {
+        double s = 0.0;
+        for (index i = lo; i < hi; ++i) s += v[i];
+        return s;
+    };
+    const auto plus = [](const double a, const double b) { return a + b; };
+
+    REQUIRE(axiom::exec::parallel_reduce(axiom::exec::seq, n, 0.0, body, plus) == serial);
+    for (const index threads : {index{2}, index{3}, index{8}}) {
+        const double r = axiom::exec::parallel_reduce(Parallel{.threads = threads}, n, 0.0, body, plus);
+        REQUIRE(r == Catch::Approx(serial).epsilon(1e-12));
+    }
+    REQUIRE(axiom::exec::parallel_reduce(axiom::exec::par, 0, 5.0, body, plus) == 5.0);
+    REQUIRE(axiom::exec::parallel_reduce(Parallel{.threads = 4}, n, -1.0e300, [&](const index lo, const index hi) {
+        double m = -1.0e300;
+        for (index i = lo; i < hi; ++i) m = std::max(m, v[i]);
+        return m;
+    }, [](const double a, const double b) { return std::max(a, b); }) == maxCoeff(v));
+}
+
+TEST_CASE("reproducible reductions are bitwise identical for any thread count", "[exec]") {
+    const Vec<double> v = spread(1000003);
+    const auto body = [&](const index lo, const index hi) {
+        double s = 0.0;
+        for (index i = lo; i < hi; ++i) s += v[i];
+        return s;
+    };
+    const auto plus = [](const double a, const double b) { return a + b; };
+
+    const double ref = axiom::exec::parallel_reduce(Sequential{.reproducible = true}, v.size(), 0.0, body, plus);
+    for (const index threads : {index{1}, index{2}, index{3}, index{5}, index{8}}) {
+        const Parallel policy{.threads = threads, .reproducible = true};
+        REQUIRE(axiom::exec::parallel_reduce(policy, v.size(), 0.0, body, plus) == ref);
+        REQUIRE(axiom::linalg::sum(policy, v) == axiom::linalg::sum(Sequential{.reproducible = true}, v));
+        REQUIRE(axiom::linalg::dot(policy, v, v) == axiom::linalg::dot(Sequential{.reproducible = true}, v, v));
+        REQUIRE(axiom::linalg::norm(policy, v, 2) == axiom::linalg::norm(Sequential{.reproducible = true}, v, 2));
+    }
+}
+
+TEST_CASE("ops accept execution policies", "[exec][ops]") {
+    const Vec<double> v = spread(100000);
+    const Vec<double> w = spread(100001).view().segment(1, 100000);
+    const Parallel par4{.threads = 4};
+
+    REQUIRE(axiom::linalg::sum(axiom::exec::seq, v) == axiom::linalg::sum(v));
+    REQUIRE(axiom::linalg::sum(par4, v) == Catch::Approx(axiom::linalg::sum(v)).epsilon(1e-12));
+    REQUIRE(axiom::linalg::dot(par4, v, w) == Catch::Approx(axiom::linalg::dot(v, w)).epsilon(1e-12));
+    for (const std::size_t order : {0, 1, 2}) {
+        REQUIRE(axiom::linalg::norm(par4, v, order) == Catch::Approx(axiom::linalg::norm(v, order)).epsilon(1e-12));
+    }
+    REQUIRE(axiom::linalg::minCoeff(par4, v) == axiom::linalg::minCoeff(v));
+    REQUIRE(axiom::linalg::maxCoeff(par4, v) == axiom::linalg::maxCoeff(v));
+    REQUIRE_THROWS_AS(axiom::linalg::norm(par4, v, 3), axiom::core::Error);
+
+    // strided operands take the generic loop per chunk
+    const Vec<double> both = spread(200000);
+    const axiom::linalg::VecView<const double> evens(both.data(), 100000, 2);
+    REQUIRE(axiom::linalg::sum(par4, evens) == Catch::Approx(axiom::linalg::sum(evens)).epsilon(1e-12));
+
+    REQUIRE(axiom::linalg::is_approx(axiom::linalg::abs(par4, v), axiom::linalg::abs(v)));
+    REQUIRE(axiom::linalg::is_approx(axiom::linalg::clamp(par4, v, -1.0, 1.0), axiom::linalg::clamp(v, -1.0, 1.0)));
+    REQUIRE(axiom::linalg::is_approx(axiom::linalg::floor(par4, v), axiom::linalg::floor(v)));
+    REQUIRE(axiom::linalg::is_approx(axiom::linalg::min(par4, v, w), axiom::linalg::min(v, w)));
+    REQUIRE(axiom::linalg::is_approx(axiom::linalg::max(par4, v, w), axiom::linalg::max(v, w)));
+    REQUIRE_THROWS_AS(axiom::linalg::max(par4, v, spread(3)), axiom::core::Error);
+}
\ No newline at end of file
@@ -0,0 +1,133 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "axiom/core/memory.hpp"
+#include "axiom/io/binary.hpp"
+
+#include "../test_util.hpp"
+
+namespace io = axiom::io;
+using axiom::core::ErrorCode;
+using axiom::linalg::Mat;
+using axiom::linalg::MatView;
+using axiom::test::TempFile;
+
+namespace {
+    template <typename T>
+    Mat<T> numbered(const axiom::core::index rows, const axiom::core::index cols) {
+        Mat<T> m(rows, cols);
+        for (axiom::core::index r = 0; r < rows; ++r) {
+            for (axiom::core::index c = 0; c < cols; ++c) m(r, c) = static_cast<T>(r * 100 + c) + T(0.5);
+        }
+        return m;
+    }
+
+    ErrorCode error_of(void (*fn)(const std::string&), const std::string& path) {
+        try {
+            fn(path);
+        } catch (const axiom::core::Error& e) {
+            return e.code();
+        }
+        FAIL("no error thrown");
+        return ErrorCode::kInvalidArgument;
+    }
+}
+
+TEST_CASE("save_matrix / map_matrix round trip without copying", "[io][binary]") {
+    const TempFile file("axiom_binary_spec_roundtrip.axm");
+    const Mat<double> m = numbered<double>(37, 19);
+    io::save_matrix(file.path, m);
+
+    const io::ArrayInfo info = io::read_matrix_info(file.path);
+    REQUIRE(info.dtype == io::DType::kFloat64);
+    REQUIRE(info.rows == 37);
+    REQUIRE(info.cols == 19);
+    REQUIRE(info.offset % axiom::core::kAlignment == 0);
+
+    axiom::core::reset_memory_stats();
+    const io::MappedMat<double> mapped = io::map_matrix<double>(file.path);
+    REQUIRE(axiom::core::memory_stats().heap_allocations == 0);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(mapped.data()) % axiom::core::kAlignment == 0);
+
+    const MatView<const double> v = mapped.view();
+    REQUIRE(v.rows() == 37);
+    REQUIRE(v.cols() == 19);
+    for (axiom::core::index r = 0; r < 37; ++r) {
+        for (axiom::core::index c = 0; c < 19; ++c) REQUIRE(v(r, c) == m(r, c));
+    }
+
+    // copies share the mapping
+    const io::MappedMat<double> copy = mapped;
+    REQUIRE(copy.data() == mapped.data());
+    REQUIRE(copy(36, 18) == m(36, 18));
+}
+
+TEST_CASE("strided views are written densely and load_matrix converts dtypes", "[io][binary]") {
+    const TempFile file("axiom_binary_spec_block.axm");
+    const Mat<float> m = numbered<float>(10, 12);
+    io::save_matrix(file.path, m.block(2, 3, 5, 4));
+
+    const Mat<float> f = io::load_matrix<float>(file.path);
+    REQUIRE(f.rows() == 5);
+    REQUIRE(f.cols() == 4);
+    REQUIRE(f(4, 3) == m(6, 6));
+
+    const Mat<double> d = io::load_matrix<double>(file.path);
+    for (axiom::core::index r = 0; r < 5; ++r) {
+        for (axiom::core::index c = 0; c < 4; ++c) REQUIRE(d(r, c) == static_cast<double>(m(r + 2, c + 3)));
+    }
+
+    // a transposed (column-strided) view goes through the row buffer
+    const TempFile transposed("axiom_binary_spec_transposed.axm");
+    io::save_matrix(transposed.path, MatView<const float>(m.data(), 12, 10, 1, 12));
+    const io::MappedMat<float> t = io::map_matrix<float>(transposed.path);
+    REQUIRE(t.rows() == 12);
+    REQUIRE(t(7, 3) == m(3, 7));
+}
+
+TEST_CASE("malformed matrix files are rejected", "[io][binary]") {
+    REQUIRE(error_of([](const std::string& p) { (void)io::map_matrix<double>(p); },
+                     "axiom_binary_spec_missing.axm") == ErrorCode::kIoError);
+
+    const TempFile file("axiom_binary_spec_bad.axm");
+    io::save_matrix(file.path, numbered<double>(8, 8));
+
+    // wrong dtype for a zero-copy view
+    REQUIRE(error_of([](const std::string& p) { (void)io::map_matrix<float>(p); }, file.path)
+            == ErrorCode::kInvalidArgument);
+
+    // truncated data
+    {
+        std::ifstream in(file.path, std::ios::binary);
+        const std::vector<char> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        std::ofstream out(file.path, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size() - 8));
+    }
+    REQUIRE(error_of([](const std::string& p) { (void)io::load_matrix<double>(p); }, file.path)
+            == ErrorCode::kIoError);
+
+    // a header whose rows * cols wraps around must not pass the size check
+    io::save_matrix(file.path, numbered<double>(8, 2));
+    {
+        std::fstream f(file.path, std::ios::binary | std::ios::in | std::ios::out);
+        const std::uint64_t rows = (std::uint64_t{1} << 60) + 1, cols = 16;
+        f.seekp(16);
+        f.write(reinterpret_cast<const char*>(&rows), sizeof rows);
+        f.write(reinterpret_cast<const char*>(&cols), sizeof cols);
+    }
+    REQUIRE(error_of([](const std::string& p) { (void)io::map_matrix<double>(p); }, file.path)
+            == ErrorCode::kIoError);
+    REQUIRE(error_of([](const std::string& p) { (void)io::load_matrix<double>(p); }, file.path)
+            == ErrorCode::kIoError);
+
+    // not an axiom file at all
+    {
+        std::ofstream out(file.path, std::ios::trunc);
+        out << "1,2,3\n4,5,6\n";
+    }
+    REQUIRE(error_of([](const std::string& p) { (void)io::read_matrix_info(p); }, file.path) == ErrorCode::kIoError);
+}
@@ -0,0 +1,156 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "axiom/io/npy.hpp"
+
+#include "../test_util.hpp"
+
+namespace io = axiom::io;
+using axiom::linalg::Mat;
+using axiom::linalg::Vec;
+using axiom::test::TempFile;
+
+namespace {
+    std::string read_bytes(const std::string& path) {
+        std::ifstream in(path, std::ios::binary);
+        return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+    }
+
+    // an .npy file the way numpy lays it out: magic, version, header length, dict padded with
+    // spaces and a newline, then the raw little-endian data
+    template <typename T>
+    void write_numpy_file(const std::string& path, const unsigned major, const std::string& dict,
+                          const std::vector<T>& data) {
+        const std::size_t preamble = major == 1 ? 10 : 12;
+        std::string header = dict;
+        while ((preamble + header.size() + 1) % 16 != 0) header += ' ';
+        header += '\n';
+
+        std::string out = "\x93NUMPY";
+        out += static_cast<char>(major);
+        out += '\0';
+        for (std::size_t i = 0; i < preamble - 8; ++i) out += static_cast<char>((header.size() >> (8 * i)) & 0xff);
+        out += header;
+        out.append(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(T));
+        std::ofstream(path, std::ios::binary) << out;
+    }
+}
+
+TEST_CASE("save_npy writes numpy's version 1.0 layout", "[io][npy]") {
+    const TempFile file("axiom_npy_spec_layout.npy");
+    Mat<double> m(2, 3);
+    for (axiom::core::index i = 0; i < 6; ++i) m(i / 3, i % 3) = static_cast<double>(i);
+    io::save_npy(file.path, m);
+
+    const std::string bytes = read_bytes(file.path);
+    REQUIRE(bytes.substr(0, 8) == std::string("\x93NUMPY\x01\x00", 8));
+    const std::size_t length = static_cast<unsigned char>(bytes[8]) | static_cast<unsigned char>(bytes[9]) << 8;
+    REQUIRE((10 + length) % 64 == 0);
+    REQUIRE(bytes[10 + length - 1] == '\n');
+    REQUIRE(bytes.find("{'descr': '<f8', 'fortran_order': False, 'shape': (2, 3), }") == 10);
+    REQUIRE(bytes.size() == 10 + length + 6 * sizeof(double));
+
+    double last;
+    std::memcpy(&last, bytes.data() + bytes.size() - sizeof(double), sizeof(double));
+    REQUIRE(last == 5.0);
+}
+
+TEST_CASE("npy round trips for matrices and vectors", "[io][npy]") {
+    const TempFile file("axiom_npy_spec_roundtrip.npy");
+    Mat<float> m(33, 7);
+    for (axiom::core::index r = 0; r < 33; ++r) {
+        for (axiom::core::index c = 0; c < 7; ++c) m(r, c) = static_cast<float>(r) - 0.25f * static_cast<float>(c);
+    }
+    io::save_npy(file.path, m);
+
+    const io::MappedMat<float> mapped = io::map_npy<float>(file.path);
+    REQUIRE(mapped.rows() == 33);
+    REQUIRE(mapped.cols() == 7);
+    REQUIRE(mapped.info().offset % 64 == 0);
+    REQUIRE(mapped(32, 6) == m(32, 6));
+
+    const Mat<double> d = io::load_npy<double>(file.path);
+    REQUIRE(d(10, 3) == static_cast<double>(m(10, 3)));
+
+    // strided vector, written 1-D
+    const TempFile vfile("axiom_npy_spec_vec.npy");
+    io::save_npy(vfile.path, m.col(2));
+    const io::ArrayInfo info = io::read_npy_info(vfile.path);
+    REQUIRE(info.ndim == 1);
+    REQUIRE(info.rows == 33);
+    REQUIRE(info.cols == 1);
+    REQUIRE(read_bytes(vfile.path).find("'shape': (33,), }") != std::string::npos);
+
+    const Vec<float> v = io::load_npy_vec<float>(vfile.path);
+    REQUIRE(v.size() == 33);
+    for (axiom::core::index i = 0; i < 33; ++i) REQUIRE(v[i] == m(i, 2));
+}
+
+TEST_CASE("numpy-written files load, including Fortran order and version 2.0", "[io][npy]") {
+    const TempFile file("axiom_npy_spec_numpy.npy");
+
+    // np.asfortranarray(np.arange(6.).reshape(2, 3)) stores the columns contiguously
+    write_numpy_file<double>(file.path, 1, "{'descr': '<f8', 'fortran_order': True, 'shape': (2, 3), }",
+                             {0.0, 3.0, 1.0, 4.0, 2.0, 5.0});
+    const io::MappedMat<double> f = io::map_npy<double>(file.path);
+    REQUIRE(f.rows() == 2);
+    REQUIRE(f.cols() == 3);
+    REQUIRE(f.view().row_stride() == 1);
+    REQUIRE(f.view().col_stride() == 2);
+    for (axiom::core::index i = 0; i < 6; ++i) REQUIRE(f(i / 3, i % 3) == static_cast<double>(i));
+
+    const Mat<double> copy = io::load_npy<double>(file.path);
+    REQUIRE(copy(1, 2) == 5.0);
+    REQUIRE(copy(0, 1) == 1.0);
+
+    write_numpy_file<float>(file.path, 2, "{'descr': '<f4', 'fortran_order': False, 'shape': (4,), }",
+                            {1.0f, 2.0f, 3.0f, 4.0f});
+    const Vec<double> v = io::load_npy_vec<double>(file.path);
+    REQUIRE(v.size() == 4);
+    REQUIRE(v[3] == 4.0);
+}
+
+TEST_CASE("unsupported npy files are rejected", "[io][npy]") {
+    const TempFile file("axiom_npy_spec_bad.npy");
+    const auto code = [&] {
+        try {
+            (void)io::load_npy<double>(file.path);
+        } catch (const axiom::core::Error& e) {
+            return e.code();
+        }
+        FAIL("no error thrown");
+        return axiom::core::ErrorCode::kInvalidArgument;
+    };
+
+    write_numpy_file<double>(file.path, 1, "{'descr': '>f8', 'fortran_order': False, 'shape': (2,), }", {1.0, 2.0});
+    REQUIRE(code() == axiom::core::ErrorCode::kIoError);
+
+    write_numpy_file<double>(file.path, 1, "{'descr': '<i8', 'fortran_order': False, 'shape': (2,), }", {1.0, 2.0});
+    REQUIRE(code() == axiom::core::ErrorCode::kIoError);
+
+    write_numpy_file<double>(file.path, 1, "{'descr': '<f8', 'fortran_order': False, 'shape': (1, 1, 2), }",
+                             {1.0, 2.0});
+    REQUIRE(code() == axiom::core::ErrorCode::kIoError);
+
+    write_numpy_file<double>(file.path, 1, "{'descr': '<f8', 'fortran_order': False, 'shape': (3, 2), }",
+                             {1.0, 2.0});
+    REQUIRE(code() == axiom::core::ErrorCode::kIoError);
+
+    // shapes that do not fit in an index, or whose span wraps around, never reach the data
+    write_numpy_file<double>(file.path, 1,
+                             "{'descr': '<f8', 'fortran_order': True, 'shape': (99999999999999999999999, 4), }",
+                             {1.0, 2.0, 3.0, 4.0});
+    REQUIRE(code() == axiom::core::ErrorCode::kIoError);
+    REQUIRE_THROWS_AS(io::map_npy<double>(file.path), axiom::core::Error);
+    write_numpy_file<double>(file.path, 1,
+                             "{'descr': '<f8', 'fortran_order': True, 'shape': (4611686018427387905, 4), }",
+                             {1.0, 2.0, 3.0, 4.0});
+    REQUIRE(code() == axiom::core::ErrorCode::kIoError);
+    REQUIRE_THROWS_AS(io::map_npy<double>(file.path), axiom::core::Error);
+
+    REQUIRE_THROWS_AS(io::map_npy<float>("axiom_npy_spec_missing.npy"), axiom::core::Error);
+}
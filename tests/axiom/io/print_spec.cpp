@@ -0,0 +1,77 @@
+#include <catch2/catch_test_macros.hpp>
+#include <charconv>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "axiom/io/print.hpp"
+
+namespace io = axiom::io;
+using axiom::linalg::Mat;
+using axiom::linalg::Vec;
+
+TEST_CASE("values print in their shortest round-trip form by default", "[io][print]") {
+    std::string s;
+    io::append(s, 0.1);
+    REQUIRE(s == "0.1");
+    s.clear();
+    io::append(s, 1.0 / 3.0);
+    REQUIRE(std::stod(s) == 1.0 / 3.0);
+    s.clear();
+    io::append(s, 0.1f);
+    REQUIRE(s == "0.1");
+
+    s.clear();
+    io::append(s, 3.14159, {.precision = 3, .format = std::chars_format::fixed});
+    REQUIRE(s == "3.142");
+    s.clear();
+    io::append(s, 12345.0, {.precision = 2, .format = std::chars_format::scientific});
+    REQUIRE(s == "1.23e+04");
+}
+
+TEST_CASE("vectors print on one line, matrices one row per line", "[io][print]") {
+    const Vec<double> v(std::vector<double>{1.0, -2.5, 3.0});
+    REQUIRE(io::to_string(v) == "1 -2.5 3");
+    REQUIRE(io::to_string(v, {.delimiter = ','}) == "1,-2.5,3");
+
+    const Mat<double> m(std::vector<double>{1, 2, 3, 4, 5, 6}, 3);
+    REQUIRE(io::to_string(m) == "1 2 3\n4 5 6\n");
+    REQUIRE(io::to_string(m.col(1)) == "2 5");
+    REQUIRE(io::to_string(m.block(0, 1, 2, 2)) == "2 3\n5 6\n");
+
+    std::ostringstream os;
+    os << v << '|' << m;
+    REQUIRE(os.str() == "1 -2.5 3|1 2 3\n4 5 6\n");
+}
+
+TEST_CASE("edge_items abbreviates large matrices", "[io][print]") {
+    Mat<float> m(6, 5);
+    for (axiom::core::index r = 0; r < 6; ++r) {
+        for (axiom::core::index c = 0; c < 5; ++c) m(r, c) = static_cast<float>(10 * r + c);
+    }
+    REQUIRE(io::to_string(m, {.edge_items = 1}) == "0 ... 4\n... ... ...\n50 ... 54\n");
+    REQUIRE(io::to_string(m, {.edge_items = 3}) == io::to_string(m));
+}
+
+TEST_CASE("multithreaded formatting matches the serial output", "[io][print]") {
+    Mat<double> m(600, 70);
+    for (axiom::core::index r = 0; r < 600; ++r) {
+        for (axiom::core::index c = 0; c < 70; ++c) m(r, c) = static_cast<double>(r) / static_cast<double>(c + 1);
+    }
+    const std::string serial = io::to_string(axiom::exec::seq, m);
+    REQUIRE(io::to_string(axiom::exec::Parallel{.threads = 4, .min_size = 1}, m) == serial);
+
+    // and reads back exactly
+    const char* p = serial.data();
+    const char* end = p + serial.size();
+    for (axiom::core::index r = 0; r < 600; ++r) {
+        for (axiom::core::index c = 0; c < 70; ++c) {
+            double x = 0.0;
+            const auto [q, ec] = std::from_chars(p, end, x);
+            REQUIRE(ec == std::errc{});
+            REQUIRE(x == m(r, c));
+            p = q + 1;
+        }
+    }
+    REQUIRE(p == end);
+}
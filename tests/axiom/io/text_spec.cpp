@@ -0,0 +1,166 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "axiom/io/text.hpp"
+
+#include "../test_util.hpp"
+
+namespace io = axiom::io;
+using axiom::core::ErrorCode;
+using axiom::linalg::CsrMat;
+using axiom::linalg::Mat;
+using axiom::linalg::Triplet;
+using axiom::test::TempFile;
+
+namespace {
+    template <typename F>
+    std::string io_error(F&& f) {
+        try {
+            f();
+        } catch (const axiom::core::Error& e) {
+            if (e.code() == ErrorCode::kIoError) return e.what();
+        }
+        return "";
+    }
+}
+
+TEST_CASE("parse_csv reads numeric CSV", "[io][text]") {
+    const Mat<double> m = io::parse_csv<double>("1,2.5,-3\n\n +4e2 , 5,6\r\n7,8,inf\n");
+    REQUIRE(m.rows() == 3);
+    REQUIRE(m.cols() == 3);
+    REQUIRE(m(0, 1) == 2.5);
+    REQUIRE(m(1, 0) == 400.0);
+    REQUIRE(m(1, 2) == 6.0);
+    REQUIRE(std::isinf(m(2, 2)));
+
+    const Mat<float> h = io::parse_csv<float>("a;b\n1;2\n3;4", {.delimiter = ';', .header = true});
+    REQUIRE(h.rows() == 2);
+    REQUIRE(h(1, 1) == 4.0f);
+
+    const Mat<double> w = io::parse_csv<double>("1  2\t3\n 4 5 6 \n", {.delimiter = ' '});
+    REQUIRE(w.rows() == 2);
+    REQUIRE(w.cols() == 3);
+    REQUIRE(w(1, 2) == 6.0);
+}
+
+TEST_CASE("parse_csv reports the offending line", "[io][text]") {
+    REQUIRE(io_error([] { (void)io::parse_csv<double>("1,2\n3,x\n"); }).find("line 2: not a number: 'x'")
+            != std::string::npos);
+    REQUIRE(io_error([] { (void)io::parse_csv<double>("1,2\n\n3\n"); }).find("line 3") != std::string::npos);
+    REQUIRE(io_error([] { (void)io::parse_csv<double>("1,2\n3,4,5\n"); }).find("line 2") != std::string::npos);
+    REQUIRE(io_error([] { (void)io::parse_csv<double>("h\n1,2\n3;4\n", {.header = true}); }).find("line 3")
+            != std::string::npos);
+    REQUIRE_THROWS_AS(io::parse_csv<double>("\n\n"), axiom::core::Error);
+}
+
+TEST_CASE("large CSV files parse the same on several threads", "[io][text]") {
+    Mat<double> m(3000, 9);
+    for (axiom::core::index r = 0; r < 3000; ++r) {
+        for (axiom::core::index c = 0; c < 9; ++c) m(r, c) = static_cast<double>(r) * 0.37 - static_cast<double>(c) / 7.0;
+    }
+    const TempFile file("axiom_text_spec_large.csv");
+    io::write_csv(file.path, m);
+
+    const Mat<double> serial = io::read_csv<double>(axiom::exec::seq, file.path);
+    const Mat<double> parallel = io::read_csv<double>(axiom::exec::Parallel{.threads = 4, .min_size = 1}, file.path);
+    REQUIRE(serial.rows() == 3000);
+    REQUIRE(parallel.rows() == 3000);
+    for (axiom::core::index r = 0; r < 3000; ++r) {
+        for (axiom::core::index c = 0; c < 9; ++c) {
+            REQUIRE(serial(r, c) == m(r, c));
+            REQUIRE(parallel(r, c) == m(r, c));
+        }
+    }
+
+    // an error deep in the file still names its line
+    std::string text;
+    {
+        std::ifstream in(file.path);
+        text.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    const std::size_t at = text.find('\n', text.size() / 2) + 1;
+    axiom::core::index line = 1;
+    for (std::size_t i = 0; i < at; ++i) line += text[i] == '\n';
+    text.insert(at, "1,2\n");
+    REQUIRE(io_error([&] { (void)io::parse_csv<double>(axiom::exec::Parallel{.threads = 4, .min_size = 1}, text); })
+            .find("line " + std::to_string(line) + ":") != std::string::npos);
+}
+
+TEST_CASE("Matrix Market coordinate files", "[io][text]") {
+    const std::string general =
+        "%%MatrixMarket matrix coordinate real general\n"
+        "% a comment\n"
+        "3 4 4\n"
+        "1 1 1.5\n"
+        "3 4 -2\n"
+        "2 2 7\n"
+        "1 1 0.5\n";
+    const CsrMat<double> a = io::parse_matrix_market<double>(general);
+    REQUIRE(a.rows() == 3);
+    REQUIRE(a.cols() == 4);
+    REQUIRE(a.nnz() == 3);
+    REQUIRE(a(0, 0) == 2.0);
+    REQUIRE(a(2, 3) == -2.0);
+
+    const std::string symmetric =
+        "%%MatrixMarket matrix coordinate integer symmetric\n"
+        "3 3 3\n"
+        "1 1 4\n"
+        "3 1 2\n"
+        "3 2 -1\n";
+    const Mat<float> s = io::parse_matrix_market_dense<float>(symmetric);
+    REQUIRE(s(0, 2) == 2.0f);
+    REQUIRE(s(2, 0) == 2.0f);
+    REQUIRE(s(1, 2) == -1.0f);
+
+    const CsrMat<double> p = io::parse_matrix_market<double>(
+        "%%MatrixMarket matrix coordinate pattern skew-symmetric\n2 2 1\n2 1\n");
+    REQUIRE(p(1, 0) == 1.0);
+    REQUIRE(p(0, 1) == -1.0);
+
+    REQUIRE(io_error([] { (void)io::parse_matrix_market<double>(
+        "%%MatrixMarket matrix coordinate real general\n2 2 2\n1 1 1\n"); }).find("expected 2 entries")
+        != std::string::npos);
+    REQUIRE(io_error([] { (void)io::parse_matrix_market<double>(
+        "%%MatrixMarket matrix coordinate real general\n2 2 1\n3 1 1\n"); }).find("line 3") != std::string::npos);
+    REQUIRE(io_error([] { (void)io::parse_matrix_market<double>(
+        "%%MatrixMarket matrix coordinate complex general\n1 1 1\n1 1 1 0\n"); }).find("complex")
+        != std::string::npos);
+}
+
+TEST_CASE("Matrix Market array files", "[io][text]") {
+    // column-major values
+    const Mat<double> a = io::parse_matrix_market_dense<double>(
+        "%%MatrixMarket matrix array real general\n2 3\n1\n4\n2\n5\n3\n6\n");
+    REQUIRE(a.rows() == 2);
+    REQUIRE(a(0, 1) == 2.0);
+    REQUIRE(a(1, 2) == 6.0);
+
+    // lower triangle only
+    const CsrMat<double> s = io::parse_matrix_market<double>(
+        "%%MatrixMarket matrix array real symmetric\n2 2\n1\n2\n3\n");
+    REQUIRE(s(0, 1) == 2.0);
+    REQUIRE(s(1, 0) == 2.0);
+    REQUIRE(s(1, 1) == 3.0);
+}
+
+TEST_CASE("write_matrix_market round trips through the parser", "[io][text]") {
+    std::vector<Triplet<double>> entries;
+    for (axiom::core::index i = 0; i < 4000; ++i) entries.push_back({(i * 37) % 500, (i * 11) % 300, 0.1 * i});
+    const CsrMat<double> a = CsrMat<double>::from_triplets(500, 300, entries);
+
+    const TempFile file("axiom_text_spec_roundtrip.mtx");
+    io::write_matrix_market(file.path, a);
+    const CsrMat<double> b = io::read_matrix_market<double>(axiom::exec::Parallel{.threads = 4, .min_size = 1}, file.path);
+    REQUIRE(b.rows() == 500);
+    REQUIRE(b.cols() == 300);
+    REQUIRE(b.nnz() == a.nnz());
+    for (axiom::core::index k = 0; k < a.nnz(); ++k) {
+        REQUIRE(b.col_idx()[k] == a.col_idx()[k]);
+        REQUIRE(b.values()[k] == a.values()[k]);
+    }
+}
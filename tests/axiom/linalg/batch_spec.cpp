@@ -0,0 +1,171 @@
+#include <catch2/catch_test_macros.hpp>
+#include "catch2/catch_approx.hpp"
+#include "catch2/catch_template_test_macros.hpp"
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "axiom/core/memory.hpp"
+#include "axiom/linalg/batch.hpp"
+#include "axiom/linalg/ops.hpp"
+
+#include "../test_util.hpp"
+
+using axiom::linalg::Batch3;
+using axiom::linalg::Vec;
+using axiom::test::for_each_isa;
+
+namespace {
+    template <typename T>
+    Batch3<T> random_batch(const std::size_t n, const unsigned seed) {
+        std::mt19937_64 rng(seed);
+        std::uniform_real_distribution<T> dist(T{-1}, T{1});
+        Batch3<T> b(n);
+        for (std::size_t i = 0; i < n; ++i) b.set(i, Vec<T, 3>(dist(rng), dist(rng), dist(rng)));
+        return b;
+    }
+
+    template <typename T>
+    bool close(const Vec<T, 3>& a, const Vec<T, 3>& b) {
+        const T eps = std::is_same_v<T, float> ? T(1e-5) : T(1e-12);
+        for (std::size_t c = 0; c < 3; ++c) {
+            if (std::abs(a[c] - b[c]) > eps * (1 + std::abs(b[c]))) return false;
+        }
+        return true;
+    }
+}
+
+TEMPLATE_TEST_CASE("Batch3 stores lanes separately and aligned", "[linalg][batch]", float, double) {
+    Batch3<TestType> b(21);
+    REQUIRE(b.size() == 21);
+    b.set(20, Vec<TestType, 3>(1, 2, 3));
+    REQUIRE(b.x()[20] == 1);
+    REQUIRE(b.y()[20] == 2);
+    REQUIRE(b.z()[20] == 3);
+    REQUIRE(b[0][1] == 0);
+    for (const auto* p : {b.x().data(), b.y().data(), b.z().data()}) {
+        REQUIRE(reinterpret_cast<std::uintptr_t>(p) % axiom::core::kAlignment == 0);
+    }
+
+    b.resize(40);
+    REQUIRE(b.at(20)[2] == 3);
+    REQUIRE(b.at(39)[0] == 0);
+    REQUIRE_THROWS_AS(b.at(40), axiom::core::Error);
+
+    const axiom::linalg::Mat<TestType> rows = b.to_rows();
+    REQUIRE(rows.rows() == 40);
+    REQUIRE(rows(20, 1) == 2);
+    const Batch3<TestType> back = Batch3<TestType>::from_rows(rows);
+    REQUIRE(back[20][2] == 3);
+
+    const std::vector<Vec<TestType, 3>> aos = {{1, 0, 0}, {0, 1, 0}};
+    REQUIRE(Batch3<TestType>::from_vectors(aos)[1][1] == 1);
+}
+
+TEMPLATE_TEST_CASE("batched ops match the single-vector ops", "[linalg][batch]", float, double) {
+    using T = TestType;
+    for_each_isa([] {
+        for (const std::size_t n : {1u, 7u, 16u, 37u, 1000u}) {
+            const Batch3<T> a = random_batch<T>(n, 1);
+            const Batch3<T> b = random_batch<T>(n, 2);
+            Batch3<T> normals(n);
+            normalize(b, normals);
+
+            Vec<T> d(n);
+            Batch3<T> c(n), u(n), r(n);
+            dot(a, b, d);
+            cross(a, b, c);
+            normalize(a, u);
+            reflect(a, normals, r);
+
+            for (std::size_t i = 0; i < n; ++i) {
+                const Vec<T, 3> ai = a[i], bi = b[i];
+                REQUIRE(d[i] == Catch::Approx(axiom::linalg::dot(ai, bi)).epsilon(1e-5).margin(1e-6));
+                REQUIRE(close<T>(c[i], axiom::linalg::cross(ai, bi)));
+                REQUIRE(close<T>(u[i], axiom::linalg::normalize(ai)));
+                REQUIRE(close<T>(r[i], axiom::linalg::reflect(ai, normals[i])));
+            }
+        }
+    });
+}
+
+TEMPLATE_TEST_CASE("the tail of a batch gets the same arithmetic as the blocks", "[linalg][batch]", float, double) {
+    using T = TestType;
+    for_each_isa([] {
+        // one vector repeated, every result has to be bitwise the first one
+        const std::size_t n = 37;
+        const Vec<T, 3> v(T(0.1), T(-0.7), T(0.3)), w(T(0.9), T(0.2), T(-0.4));
+        Batch3<T> a(n), b(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            a.set(i, v);
+            b.set(i, w);
+        }
+        Vec<T> d(n);
+        Batch3<T> u(n), r(n);
+        dot(a, b, d);
+        normalize(a, u);
+        reflect(a, u, r);
+        for (std::size_t i = 1; i < n; ++i) {
+            REQUIRE(d[i] == d[0]);
+            for (std::size_t c = 0; c < 3; ++c) {
+                REQUIRE(u[i][c] == u[0][c]);
+                REQUIRE(r[i][c] == r[0][c]);
+            }
+        }
+    });
+}
+
+TEST_CASE("batched ops work in place and keep zero vectors", "[linalg][batch]") {
+    Batch3<double> a = random_batch<double>(50, 3);
+    const Batch3<double> original = a;
+    a.set(10, Vec<double, 3>(0, 0, 0));
+    normalize(a, a);
+    REQUIRE(a[10][0] == 0.0);
+    REQUIRE(a[10][1] == 0.0);
+    REQUIRE(a[10][2] == 0.0);
+    REQUIRE(axiom::linalg::len(a[11]) == Catch::Approx(1.0));
+    REQUIRE(close<double>(a[11], axiom::linalg::normalize(original[11])));
+
+    Batch3<double> b = original;
+    cross(b, original, b);
+    REQUIRE(axiom::linalg::len(b[5]) == Catch::Approx(0.0).margin(1e-15));
+
+    Batch3<double> empty;
+    REQUIRE(empty.empty());
+    cross(axiom::exec::par, empty, empty, empty);
+    normalize(empty, empty);
+}
+
+TEST_CASE("batched ops check sizes once and do not allocate", "[linalg][batch]") {
+    const Batch3<double> a = random_batch<double>(64, 4);
+    const Batch3<double> b = random_batch<double>(63, 5);
+    Batch3<double> out(64);
+    Vec<double> d(64);
+    REQUIRE_THROWS_AS(cross(a, b, out), axiom::core::Error);
+    REQUIRE_THROWS_AS(normalize(b, out), axiom::core::Error);
+    REQUIRE_THROWS_AS(dot(a, b, d), axiom::core::Error);
+
+    axiom::core::reset_memory_stats();
+    dot(a, a, d);
+    cross(a, a, out);
+    normalize(a, out);
+    reflect(a, out, out);
+    REQUIRE(axiom::core::memory_stats().heap_allocations == 0);
+}
+
+TEST_CASE("parallel batched ops match the sequential result", "[linalg][batch]") {
+    const std::size_t n = 100000;
+    const Batch3<float> a = random_batch<float>(n, 6);
+    const Batch3<float> b = random_batch<float>(n, 7);
+    Batch3<float> seq(n), par(n);
+    cross(a, b, seq);
+    cross(axiom::exec::Parallel{.threads = 4}, a, b, par);
+    Vec<float> ds(n), dp(n);
+    dot(a, b, ds);
+    dot(axiom::exec::par, a, b, dp);
+    for (std::size_t i = 0; i < n; ++i) {
+        REQUIRE(par[i][0] == seq[i][0]);
+        REQUIRE(par[i][2] == seq[i][2]);
+        REQUIRE(dp[i] == ds[i]);
+    }
+}
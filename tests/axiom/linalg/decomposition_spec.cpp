@@ -0,0 +1,292 @@
+#include <catch2/catch_test_macros.hpp>
+#include "catch2/catch_approx.hpp"
+#include "catch2/catch_template_test_macros.hpp"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include "axiom/linalg/decomposition.hpp"
+
+#include "../test_util.hpp"
+
+using axiom::linalg::LU;
+using axiom::linalg::Mat;
+using axiom::linalg::Vec;
+using axiom::test::random_mat;
+
+namespace {
+    // max |A X - B| relative to the size of the entries
+    template <typename T>
+    double residual(const Mat<T>& A, const Mat<T>& X, const Mat<T>& B) {
+        const Mat<T> AX = axiom::linalg::matmul(A, X);
+        double worst = 0.0;
+        for (std::size_t i = 0; i < B.rows(); ++i) {
+            for (std::size_t j = 0; j < B.cols(); ++j) {
+                worst = std::max(worst, std::abs(double(AX(i, j)) - double(B(i, j))));
+            }
+        }
+        return worst;
+    }
+}
+
+TEMPLATE_TEST_CASE("blocked LU reconstructs P A across block boundaries", "[linalg][lu]", float, double) {
+    using T = TestType;
+    const double tol = std::is_same_v<T, float> ? 1e-4 : 1e-11;
+    for (const std::size_t n : {1, 5, 63, 64, 65, 130}) {
+        const Mat<T> A = random_mat<T>(n, n, static_cast<unsigned>(n));
+        const LU<T> f(A, 16);
+        REQUIRE_FALSE(f.is_singular());
+
+        Mat<T> PA = A;
+        for (std::size_t i = 0; i < n; ++i) {
+            const std::size_t p = f.pivots()[i];
+            for (std::size_t j = 0; j < n; ++j) std::swap(PA(i, j), PA(p, j));
+        }
+        const Mat<T> LU_ = axiom::linalg::matmul(f.lower(), f.upper());
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = 0; j < n; ++j) REQUIRE(std::abs(double(LU_(i, j)) - double(PA(i, j))) < tol * n);
+        }
+        // partial pivoting keeps every multiplier in [-1, 1]
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = 0; j < i; ++j) REQUIRE(std::abs(f.packed()(i, j)) <= T{1});
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("LU solves many right-hand sides with one factorization", "[linalg][lu]", float, double) {
+    using T = TestType;
+    const double tol = std::is_same_v<T, float> ? 1e-3 : 1e-10;
+    const std::size_t n = 150;
+    const Mat<T> A = random_mat<T>(n, n, 7);
+    const auto f = axiom::linalg::lu(A, 32);
+
+    const Mat<T> B = random_mat<T>(n, 9, 8);
+    REQUIRE(residual(A, f.solve(B), B) < tol);
+
+    // vectors and strided views solve to the same answer as the matrix columns
+    const Mat<T> X = f.solve(B);
+    const Vec<T> x = f.solve(B.col(4));
+    for (std::size_t i = 0; i < n; ++i) REQUIRE(double(x[i]) == Catch::Approx(double(X(i, 4))).margin(tol));
+
+    const Vec<T> y = axiom::linalg::solve(A, Vec<T>(B.col(0)));
+    for (std::size_t i = 0; i < n; ++i) REQUIRE(double(y[i]) == Catch::Approx(double(X(i, 0))).margin(tol));
+
+    // unblocked and blocked factorizations agree
+    const LU<T> g(A, n);
+    const Mat<T> Xg = g.solve(B);
+    for (std::size_t i = 0; i < n; ++i) REQUIRE(double(Xg(i, 2)) == Catch::Approx(double(X(i, 2))).margin(tol));
+}
+
+TEST_CASE("determinant and inverse", "[linalg][lu]") {
+    const Mat<double> A(std::vector<double>{0.0, 2.0, 1.0,
+                                            1.0, 1.0, 0.0,
+                                            3.0, 0.0, 4.0}, 3);
+    REQUIRE(axiom::linalg::det(A) == Catch::Approx(-11.0));
+    REQUIRE(axiom::linalg::det(Mat<double>::identity(5)) == Catch::Approx(1.0));
+
+    const Mat<double> inv = axiom::linalg::inverse(A);
+    const Mat<double> I = axiom::linalg::matmul(A, inv);
+    for (std::size_t i = 0; i < 3; ++i) {
+        for (std::size_t j = 0; j < 3; ++j) REQUIRE(I(i, j) == Catch::Approx(i == j ? 1.0 : 0.0).margin(1e-12));
+    }
+
+    const Mat<double> R = random_mat<double>(90, 90, 3);
+    const Mat<double> Ri = axiom::linalg::inverse(R);
+    REQUIRE(residual(R, Ri, Mat<double>::identity(90)) < 1e-9);
+    REQUIRE(axiom::linalg::det(axiom::linalg::matmul(R, R)) ==
+            Catch::Approx(axiom::core::sq(axiom::linalg::det(R))).epsilon(1e-8));
+}
+
+TEST_CASE("singular and non-square inputs are reported", "[linalg][lu]") {
+    const Mat<double> S(std::vector<double>{1.0, 2.0, 3.0,
+                                            2.0, 4.0, 6.0,
+                                            1.0, 0.0, 1.0}, 3);
+    const auto f = axiom::linalg::lu(S);
+    REQUIRE(f.is_singular());
+    REQUIRE(f.determinant() == 0.0);
+    REQUIRE_THROWS_AS(f.solve(Vec<double>::ones(3)), axiom::core::Error);
+    try {
+        (void)f.inverse();
+        FAIL("inverse() of a singular matrix must throw");
+    } catch (const axiom::core::Error& e) {
+        REQUIRE(e.code() == axiom::core::ErrorCode::kSingularMatrix);
+    }
+
+    REQUIRE_THROWS_AS(axiom::linalg::lu(Mat<double>(3, 4)), axiom::core::Error);
+    REQUIRE_THROWS_AS(axiom::linalg::lu(Mat<double>::identity(3)).solve(Vec<double>::ones(4)), axiom::core::Error);
+}
+
+namespace {
+    // A^T A + n I is symmetric positive definite and well conditioned
+    template <typename T>
+    Mat<T> random_spd(const std::size_t n, const unsigned seed) {
+        const Mat<T> R = random_mat<T>(n, n, seed);
+        const axiom::linalg::MatView<const T> Rt(R.data(), n, n, 1, n);
+        Mat<T> A = axiom::linalg::matmul(Rt, R);
+        for (std::size_t i = 0; i < n; ++i) A(i, i) += static_cast<T>(n);
+        return A;
+    }
+}
+
+TEMPLATE_TEST_CASE("blocked Cholesky reconstructs A", "[linalg][cholesky]", float, double) {
+    using T = TestType;
+    const double tol = std::is_same_v<T, float> ? 1e-4 : 1e-12;
+    for (const std::size_t n : {1, 7, 32, 33, 100}) {
+        const Mat<T> A = random_spd<T>(n, static_cast<unsigned>(n) + 11);
+        const auto f = axiom::linalg::cholesky(A, 16);
+        const Mat<T>& L = f.lower();
+        const axiom::linalg::MatView<const T> Lt(L.data(), n, n, 1, n);
+        const Mat<T> LLt = axiom::linalg::matmul(L, Lt);
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                REQUIRE(std::abs(double(LLt(i, j)) - double(A(i, j))) < tol * n * n);
+                if (j > i) REQUIRE(L(i, j) == T{});
+            }
+            REQUIRE(L(i, i) > T{});
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("Cholesky solves agree with LU and across thread counts", "[linalg][cholesky]", float, double) {
+    using T = TestType;
+    const double tol = std::is_same_v<T, float> ? 1e-4 : 1e-11;
+    const std::size_t n = 140;
+    const Mat<T> A = random_spd<T>(n, 5);
+    const Mat<T> B = random_mat<T>(n, 6, 6);
+
+    const axiom::linalg::Cholesky<T> f(A, 24);
+    const Mat<T> X = f.solve(B);
+    REQUIRE(residual(A, X, B) < tol * n);
+
+    const Mat<T> Xlu = axiom::linalg::lu(A).solve(B);
+    const axiom::linalg::Cholesky<T> par(A, 24, 4);
+    const Mat<T> Xpar = par.solve(B);
+    const Mat<T> Xpol = axiom::linalg::cholesky(axiom::exec::Parallel{.threads = 4, .min_size = 1}, A, 24).solve(B);
+    REQUIRE(std::equal(Xpar.begin(), Xpar.end(), Xpol.begin()));
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < 6; ++j) {
+            REQUIRE(double(X(i, j)) == Catch::Approx(double(Xlu(i, j))).margin(tol));
+            REQUIRE(double(Xpar(i, j)) == Catch::Approx(double(X(i, j))).margin(tol));
+        }
+    }
+
+    const Vec<T> x = f.solve(B.col(3));
+    for (std::size_t i = 0; i < n; ++i) REQUIRE(double(x[i]) == Catch::Approx(double(X(i, 3))).margin(tol));
+    // det(A) overflows float here, log |det| from the LU diagonal does not
+    const auto g = axiom::linalg::lu(A);
+    double log_det = 0.0;
+    for (std::size_t i = 0; i < n; ++i) log_det += std::log(std::abs(double(g.packed()(i, i))));
+    REQUIRE(double(f.log_determinant()) == Catch::Approx(log_det).epsilon(1e-4));
+}
+
+TEST_CASE("Cholesky factors in place and rejects non-SPD input", "[linalg][cholesky]") {
+    Mat<double> A(std::vector<double>{4.0, 2.0, 2.0,
+                                      2.0, 5.0, 3.0,
+                                      2.0, 3.0, 6.0}, 3);
+    const double* buffer = A.data();
+    const axiom::linalg::Cholesky<double> f(std::move(A));
+    REQUIRE(f.lower().data() == buffer);
+    REQUIRE(f.lower()(0, 0) == Catch::Approx(2.0));
+    REQUIRE(f.lower()(1, 0) == Catch::Approx(1.0));
+    REQUIRE(f.determinant() == Catch::Approx(4.0 * 5.0 * 6.0 + 2 * 2.0 * 3.0 * 2.0 - 4.0 * 9.0 - 5.0 * 4.0 - 6.0 * 4.0));
+    const Mat<double> inv = f.inverse();
+    const Vec<double> e = axiom::linalg::matvec(inv, Vec<double>(std::vector<double>{4.0, 2.0, 2.0}));
+    REQUIRE(e[0] == Catch::Approx(1.0));
+    REQUIRE(e[1] == Catch::Approx(0.0).margin(1e-12));
+
+    // indefinite, with the failing pivot in a later block
+    Mat<double> S = random_spd<double>(50, 9);
+    S(40, 40) = -1000.0;
+    try {
+        (void)axiom::linalg::cholesky(S, 8);
+        FAIL("an indefinite matrix must be rejected");
+    } catch (const axiom::core::Error& err) {
+        REQUIRE(err.code() == axiom::core::ErrorCode::kNotPositiveDefinite);
+    }
+    REQUIRE_THROWS_AS(axiom::linalg::cholesky(Mat<double>(std::vector<double>{1.0, 2.0, 2.0, 1.0}, 2)),
+                      axiom::core::Error);
+    REQUIRE_THROWS_AS(axiom::linalg::cholesky(Mat<double>(2, 3)), axiom::core::Error);
+}
+
+TEMPLATE_TEST_CASE("blocked QR has orthonormal Q and reconstructs A", "[linalg][qr]", float, double) {
+    using T = TestType;
+    const double tol = std::is_same_v<T, float> ? 1e-4 : 1e-12;
+    for (const auto& [m, n] : {std::pair<std::size_t, std::size_t>{1, 1}, {9, 4}, {50, 20}, {200, 33}, {40, 40}}) {
+        const Mat<T> A = random_mat<T>(m, n, static_cast<unsigned>(m + n));
+        const auto f = axiom::linalg::qr(A, 8);
+        const Mat<T> Q = f.q();
+        const Mat<T> R = f.r();
+
+        const Mat<T> QR_ = axiom::linalg::matmul(Q, R);
+        const axiom::linalg::MatView<const T> Qt(Q.data(), n, m, 1, n);
+        const Mat<T> QtQ = axiom::linalg::matmul(Qt, Q);
+        for (std::size_t i = 0; i < m; ++i) {
+            for (std::size_t j = 0; j < n; ++j) REQUIRE(std::abs(double(QR_(i, j)) - double(A(i, j))) < tol * m);
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                REQUIRE(std::abs(double(QtQ(i, j)) - (i == j ? 1.0 : 0.0)) < tol * m);
+                if (j < i) REQUIRE(R(i, j) == T{});
+            }
+        }
+    }
+}
+
+TEST_CASE("lstsq matches the normal equations on a well conditioned problem", "[linalg][qr]") {
+    const std::size_t m = 3000, n = 12;
+    const Mat<double> A = random_mat<double>(m, n, 21);
+    const Mat<double> noise = random_mat<double>(m, 1, 22);
+    Vec<double> truth(n);
+    for (std::size_t j = 0; j < n; ++j) truth[j] = 0.5 * static_cast<double>(j) - 2.0;
+    const Vec<double> b(axiom::linalg::matvec(A, truth) + 0.01 * Vec<double>(noise.col(0)));
+
+    const Vec<double> x = axiom::linalg::lstsq(A, b);
+    const auto normal = axiom::linalg::cholesky(axiom::linalg::matmul(
+        axiom::linalg::MatView<const double>(A.data(), n, m, 1, n), A));
+    const Vec<double> xn = normal.solve(axiom::linalg::matvec_t(A, b));
+    for (std::size_t j = 0; j < n; ++j) {
+        REQUIRE(x[j] == Catch::Approx(xn[j]).margin(1e-10));
+        REQUIRE(x[j] == Catch::Approx(truth[j]).margin(1e-2));
+    }
+
+    // the residual is orthogonal to the columns of A
+    const Vec<double> r = b - axiom::linalg::matvec(A, x);
+    const Vec<double> g = axiom::linalg::matvec_t(A, r);
+    for (std::size_t j = 0; j < n; ++j) REQUIRE(std::abs(g[j]) < 1e-9);
+
+    // TSQR over row blocks gives the same answer, for several right-hand sides too
+    const Vec<double> xt = axiom::linalg::lstsq(A, b, 4);
+    for (std::size_t j = 0; j < n; ++j) REQUIRE(xt[j] == Catch::Approx(x[j]).margin(1e-11));
+    const Vec<double> xp = axiom::linalg::lstsq(axiom::exec::Parallel{.threads = 4, .min_size = 1}, A, b);
+    for (std::size_t j = 0; j < n; ++j) REQUIRE(xp[j] == xt[j]);
+    const Mat<double> Bm = random_mat<double>(m, 3, 23);
+    const Mat<double> X1 = axiom::linalg::lstsq(A, Bm);
+    const Mat<double> X4 = axiom::linalg::lstsq(A, Bm, 4);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < 3; ++j) REQUIRE(X4(i, j) == Catch::Approx(X1(i, j)).margin(1e-11));
+    }
+}
+
+TEST_CASE("QR beats the normal equations on an ill conditioned problem", "[linalg][qr]") {
+    // Vandermonde columns 1, t, t^2, ... on [0, 1] with an exact polynomial fit
+    const std::size_t m = 200, n = 9;
+    Mat<double> A(m, n);
+    Vec<double> b(m);
+    for (std::size_t i = 0; i < m; ++i) {
+        const double t = static_cast<double>(i) / static_cast<double>(m - 1);
+        double p = 1.0;
+        for (std::size_t j = 0; j < n; ++j, p *= t) {
+            A(i, j) = p;
+            b[i] += p;
+        }
+    }
+    const Vec<double> x = axiom::linalg::lstsq(A, b);
+    for (std::size_t j = 0; j < n; ++j) REQUIRE(x[j] == Catch::Approx(1.0).margin(1e-6));
+
+    REQUIRE_THROWS_AS(axiom::linalg::qr(Mat<double>(3, 5)), axiom::core::Error);
+    REQUIRE_THROWS_AS(axiom::linalg::lstsq(A, Vec<double>(m + 1)), axiom::core::Error);
+    Mat<double> D(6, 2);
+    for (std::size_t i = 0; i < 6; ++i) D(i, 0) = 1.0;
+    REQUIRE_THROWS_AS(axiom::linalg::lstsq(D, Vec<double>::ones(6)), axiom::core::Error);
+}
@@ -0,0 +1,132 @@
+#include <catch2/catch_test_macros.hpp>
+#include "catch2/catch_approx.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "axiom/core/memory.hpp"
+#include "axiom/linalg/distance.hpp"
+
+using axiom::core::index;
+using axiom::linalg::Mat;
+
+namespace {
+    // deterministic points in [-1, 1)^d
+    template <typename T>
+    Mat<T> points(const index n, const index d, const unsigned seed) {
+        Mat<T> P(n, d);
+        unsigned s = seed * 2654435761u + 1u;
+        for (index i = 0; i < n; ++i) {
+            for (index j = 0; j < d; ++j) {
+                s = s * 1664525u + 1013904223u;
+                P(i, j) = static_cast<T>(s >> 8) / static_cast<T>(1u << 23) - T{1};
+            }
+        }
+        return P;
+    }
+
+    // indices of Y sorted by distance to x, ties by index
+    std::vector<index> brute_force(const Mat<double>& Y, const Mat<double>& X, const index i) {
+        std::vector<index> order(Y.rows());
+        std::iota(order.begin(), order.end(), index{0});
+        std::vector<double> d(Y.rows());
+        for (index j = 0; j < Y.rows(); ++j) d[j] = axiom::linalg::distanceSquared(X.row(i), Y.row(j));
+        std::stable_sort(order.begin(), order.end(), [&](const index a, const index b) { return d[a] < d[b]; });
+        return order;
+    }
+}
+
+TEST_CASE("pairwise squared distances match distanceSquared", "[linalg][distance]") {
+    const Mat<double> X = points<double>(150, 7, 1), Y = points<double>(300, 7, 2);
+    const Mat<double> D = axiom::linalg::pairwise_sq_distances(X, Y);
+    REQUIRE(D.rows() == 150);
+    REQUIRE(D.cols() == 300);
+    for (index i = 0; i < 150; i += 7) {
+        for (index j = 0; j < 300; ++j) {
+            REQUIRE(D(i, j) == Catch::Approx(axiom::linalg::distanceSquared(X.row(i), Y.row(j))).margin(1e-12));
+        }
+    }
+
+    // into a caller-owned matrix, split over the pool, row blocks do not change the result
+    Mat<double> P(150, 300);
+    axiom::linalg::pairwise_sq_distances(axiom::exec::Parallel{.threads = 4, .min_size = 1}, X, Y, P);
+    REQUIRE(std::equal(D.begin(), D.end(), P.begin()));
+
+    // against itself the diagonal is 0 up to round-off and never negative
+    const Mat<float> F = points<float>(90, 3, 3);
+    const Mat<float> S = axiom::linalg::pairwise_sq_distances(F, F.view());
+    for (index i = 0; i < 90; ++i) {
+        REQUIRE(S(i, i) >= 0.0f);
+        REQUIRE(S(i, i) < 1e-5f);
+    }
+    REQUIRE(*std::min_element(S.begin(), S.end()) >= 0.0f);
+}
+
+TEST_CASE("knn finds the nearest rows in order", "[linalg][distance][knn]") {
+    const Mat<double> X = points<double>(130, 5, 4), Y = points<double>(1000, 5, 5);
+    const auto r = axiom::linalg::knn(X, Y, 6);
+    REQUIRE(r.indices.rows() == 130);
+    REQUIRE(r.indices.cols() == 6);
+    for (index i = 0; i < 130; ++i) {
+        const std::vector<index> expected = brute_force(Y, X, i);
+        for (index j = 0; j < 6; ++j) {
+            REQUIRE(r.indices(i, j) == expected[j]);
+            REQUIRE(r.distances(i, j) ==
+                    Catch::Approx(axiom::linalg::distanceSquared(X.row(i), Y.row(expected[j]))).margin(1e-12));
+        }
+    }
+
+    const auto p = axiom::linalg::knn(axiom::exec::Parallel{.threads = 3, .min_size = 1}, X, Y, 6);
+    REQUIRE(std::equal(r.indices.begin(), r.indices.end(), p.indices.begin()));
+    REQUIRE(std::equal(r.distances.begin(), r.distances.end(), p.distances.begin()));
+
+    // k = M sorts every reference, duplicates come out by index
+    Mat<double> Z = points<double>(4, 2, 6);
+    Z.row(3) = Z.row(1);
+    const auto all = axiom::linalg::knn(Z.row_range(1, 1), Z, 4);
+    REQUIRE(all.indices(0, 0) == 1);
+    REQUIRE(all.indices(0, 1) == 3);
+    REQUIRE(all.distances(0, 1) == Catch::Approx(0.0).margin(1e-12));
+}
+
+TEST_CASE("NaN coordinates propagate and rank last", "[linalg][distance][knn]") {
+    const Mat<double> X = points<double>(3, 4, 12);
+    Mat<double> Y = points<double>(5, 4, 13);
+    Y.row(2) = X.row(0);
+    Y(2, 1) = std::numeric_limits<double>::quiet_NaN();
+
+    const Mat<double> D = axiom::linalg::pairwise_sq_distances(X, Y);
+    for (index i = 0; i < 3; ++i) REQUIRE(std::isnan(D(i, 2)));
+    REQUIRE(std::isnan(axiom::linalg::distanceSquared(X.row(0), Y.row(2))));
+
+    const auto nearest = axiom::linalg::knn(X, Y, 1);
+    for (index i = 0; i < 3; ++i) REQUIRE(nearest.indices(i, 0) != 2);
+    const auto all = axiom::linalg::knn(X, Y, 5);
+    for (index i = 0; i < 3; ++i) {
+        REQUIRE(all.indices(i, 4) == 2);
+        REQUIRE(std::isnan(all.distances(i, 4)));
+    }
+}
+
+TEST_CASE("knn only allocates its result", "[linalg][distance][knn]") {
+    const Mat<float> X = points<float>(200, 16, 7), Y = points<float>(2000, 16, 8);
+    (void)axiom::linalg::knn(X, Y, 3);       // warms the thread arena
+    axiom::core::reset_memory_stats();
+    const auto r = axiom::linalg::knn(X, Y, 3);
+    // indices, distances and the two row-norm vectors, never an N x M matrix
+    REQUIRE(axiom::core::memory_stats().heap_allocations == 4);
+    REQUIRE(r.distances(0, 0) <= r.distances(0, 2));
+}
+
+TEST_CASE("distance queries report bad input", "[linalg][distance]") {
+    const Mat<double> X = points<double>(5, 3, 9), Y = points<double>(8, 4, 10);
+    REQUIRE_THROWS_AS(axiom::linalg::pairwise_sq_distances(X, Y), axiom::core::Error);
+    REQUIRE_THROWS_AS(axiom::linalg::knn(X, Y, 1), axiom::core::Error);
+    const Mat<double> W = points<double>(8, 3, 11);
+    REQUIRE_THROWS_AS(axiom::linalg::knn(X, W, 0), axiom::core::Error);
+    REQUIRE_THROWS_AS(axiom::linalg::knn(X, W, 9), axiom::core::Error);
+    Mat<double> D(5, 7);
+    REQUIRE_THROWS_AS(axiom::linalg::pairwise_sq_distances(X, W, D), axiom::core::Error);
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+#include <catch2/catch_test_macros.hpp>
+#include "catch2/catch_approx.hpp"
+#include <type_traits>
+#include <vector>
+
+#include "axiom/linalg/ops.hpp"
+
+using axiom::linalg::Vec;
+using axiom::linalg::Mat;
+
+TEST_CASE("vec expressions are lazy and evaluate elementwise", "[linalg][expr]") {
+    Vec<double> a(std::vector<double>{1.0, 2.0, 3.0});
+    Vec<double> b(std::vector<double>{4.0, 5.0, 6.0});
+
+    auto e = a + 2.0 * b;
+    STATIC_REQUIRE_FALSE(std::is_same_v<decltype(e), Vec<double>>);
+    REQUIRE(e.size() == 3);
+
+    Vec<double> r = e;
+    REQUIRE(r[0] == Catch::Approx(9.0));
+    REQUIRE(r[1] == Catch::Approx(12.0));
+    REQUIRE(r[2] == Catch::Approx(15.0));
+
+    Vec<double> s = -(a - b) / 3.0;
+    REQUIRE(s[0] == Catch::Approx(1.0));
+    REQUIRE(s[2] == Catch::Approx(1.0));
+}
+
+TEST_CASE("vec compound assignment from an expression", "[linalg][expr]") {
+    Vec<double> y = Vec<double>::ones(4);
+    Vec<double> x(std::vector<double>{1.0, 2.0, 3.0, 4.0});
+    Vec<double> z(std::vector<double>{1.0, 1.0, 1.0, 1.0});
+
+    y += 2.0 * x + 3.0 * z;
+    REQUIRE(y[0] == Catch::Approx(6.0));
+    REQUIRE(y[3] == Catch::Approx(12.0));
+
+    y -= x;
+    REQUIRE(y[3] == Catch::Approx(8.0));
+
+    // aliasing the destination is safe since evaluation is elementwise
+    y = y + y;
+    REQUIRE(y[3] == Catch::Approx(16.0));
+}
+
+TEST_CASE("vec expressions check shapes and divisors eagerly", "[linalg][expr]") {
+    Vec<double> a(3), b(4);
+    REQUIRE_THROWS_AS(a + b, axiom::core::Error);
+    REQUIRE_THROWS_AS(a / 0.0, axiom::core::Error);
+
+    Vec<double> y(3);
+    REQUIRE_THROWS_AS(y += a - a + b, axiom::core::Error);
+}
+
+TEST_CASE("reflect and proj produce fused results", "[linalg][expr]") {
+    Vec<double> v(std::vector<double>{1.0, -1.0, 0.0});
+    Vec<double> n(std::vector<double>{0.0, 1.0, 0.0});
+
+    Vec<double> r = axiom::linalg::reflect(v, n);
+    REQUIRE(r[0] == Catch::Approx(1.0));
+    REQUIRE(r[1] == Catch::Approx(1.0));
+
+    Vec<double> p = axiom::linalg::proj(v, n);
+    REQUIRE(p[1] == Catch::Approx(-1.0));
+    REQUIRE(p[0] == Catch::Approx(0.0));
+}
+
+TEST_CASE("mat elementwise expressions", "[linalg][expr][mat]") {
+    Mat<double> A = Mat<double>::ones(2, 3);
+    Mat<double> B = Mat<double>::identity(2);
+    Mat<double> I = Mat<double>::identity(3);
+
+    Mat<double> C = 3.0 * A - A / 2.0;
+    REQUIRE(C.rows() == 2);
+    REQUIRE(C.cols() == 3);
+    REQUIRE(C(1, 2) == Catch::Approx(2.5));
+
+    C += A;
+    C *= 2.0;
+    REQUIRE(C(0, 0) == Catch::Approx(7.0));
+
+    B = -B + B * 4.0;
+    REQUIRE(B(0, 0) == Catch::Approx(3.0));
+    REQUIRE(B(0, 1) == Catch::Approx(0.0));
+
+    REQUIRE_THROWS_AS(A + I, axiom::core::Error);
+    REQUIRE_THROWS_AS(C -= I, axiom::core::Error);
+}
\ No newline at end of file
@@ -0,0 +1,158 @@
+#include <catch2/catch_test_macros.hpp>
+#include "catch2/catch_approx.hpp"
+#include <type_traits>
+#include <vector>
+
+#include "axiom/core/memory.hpp"
+#include "axiom/linalg/ops.hpp"
+
+using axiom::linalg::Mat;
+using axiom::linalg::Mat2d;
+using axiom::linalg::Mat3d;
+using axiom::linalg::Vec;
+using axiom::linalg::Vec3d;
+using axiom::linalg::Vec3f;
+
+namespace {
+    template <typename A, typename B>
+    concept addable = requires(const A& a, const B& b) { a + b; };
+
+    template <typename A, typename B>
+    concept dottable = requires(const A& a, const B& b) { axiom::linalg::dot(a, b); };
+
+    template <typename A, typename B>
+    concept multipliable = requires(const A& a, const B& b) { axiom::linalg::matmul(a, b); };
+}
+
+TEST_CASE("fixed-size vectors and matrices are usable in constant expressions", "[linalg][fixed]") {
+    constexpr Vec3d a{1.0, 2.0, 3.0};
+    constexpr Vec3d b{4.0, 5.0, 6.0};
+    constexpr Vec3d c(a + 2.0 * b);
+    STATIC_REQUIRE(c[2] == 15.0);
+    STATIC_REQUIRE(axiom::linalg::dot(a, b) == 32.0);
+    STATIC_REQUIRE(axiom::linalg::sum(a) == 6.0);
+    STATIC_REQUIRE(axiom::linalg::maxCoeff(b) == 6.0);
+    STATIC_REQUIRE(axiom::linalg::distanceSquared(a, b) == 27.0);
+    STATIC_REQUIRE(axiom::linalg::cross(a, b) == Vec3d{-3.0, 6.0, -3.0});
+
+    constexpr Mat2d M{1.0, 2.0,
+                      3.0, 4.0};
+    constexpr Mat2d P = axiom::linalg::matmul(M, Mat2d::identity());
+    STATIC_REQUIRE(P == M);
+    STATIC_REQUIRE(axiom::linalg::matvec(M, Vec<double, 2>{1.0, 1.0}) == Vec<double, 2>{3.0, 7.0});
+    STATIC_REQUIRE(axiom::linalg::matvec_t(M, Vec<double, 2>{1.0, 1.0}) == Vec<double, 2>{4.0, 6.0});
+
+    STATIC_REQUIRE(sizeof(Vec3f) == 3 * sizeof(float));
+    STATIC_REQUIRE(std::is_trivially_copyable_v<Mat3d>);
+}
+
+TEST_CASE("fixed-size ops return fixed-size results without allocating", "[linalg][fixed]") {
+    Vec3d u{1.0, 0.0, 0.0};
+    const Vec3d v{0.0, 1.0, 0.0};
+    Mat3d R{0.0, -1.0, 0.0,
+            1.0,  0.0, 0.0,
+            0.0,  0.0, 1.0};
+
+    axiom::core::reset_memory_stats();
+    const auto w = axiom::linalg::cross(u, v);
+    const auto n = axiom::linalg::normalize(Vec3d(u + v));
+    const auto r = axiom::linalg::reflect(u, v);
+    const auto Ru = axiom::linalg::matvec(R, u);
+    const auto RR = axiom::linalg::matmul(R, R);
+    u += 2.0 * v;
+    REQUIRE(axiom::core::memory_stats().heap_allocations == 0);
+
+    STATIC_REQUIRE(std::is_same_v<std::remove_const_t<decltype(w)>, Vec3d>);
+    STATIC_REQUIRE(std::is_same_v<std::remove_const_t<decltype(n)>, Vec3d>);
+    STATIC_REQUIRE(std::is_same_v<std::remove_const_t<decltype(RR)>, Mat3d>);
+    REQUIRE(w == Vec3d{0.0, 0.0, 1.0});
+    REQUIRE(n[0] == Catch::Approx(1.0 / std::sqrt(2.0)));
+    REQUIRE(r == Vec3d{1.0, 0.0, 0.0});
+    REQUIRE(Ru == Vec3d{0.0, 1.0, 0.0});
+    REQUIRE(RR(0, 0) == -1.0);
+    REQUIRE(u == Vec3d{1.0, 2.0, 0.0});
+}
+
+TEST_CASE("fixed and dynamic containers interoperate", "[linalg][fixed]") {
+    const Vec3d a{1.0, 2.0, 3.0};
+    const Vec<double> d(std::vector<double>{1.0, 1.0, 1.0});
+
+    // fixed to dynamic is implicit, dynamic to fixed is explicit and checked at run time
+    const Vec<double> widened = a;
+    REQUIRE(widened.size() == 3);
+    REQUIRE(widened[2] == 3.0);
+    const Vec3d narrowed(d);
+    REQUIRE(narrowed[1] == 1.0);
+    REQUIRE_THROWS_AS((Vec<double, 4>(d)), axiom::core::Error);
+    STATIC_REQUIRE_FALSE(std::is_convertible_v<const Vec<double>&, Vec3d>);
+    STATIC_REQUIRE(std::is_convertible_v<const Vec3d&, Vec<double>>);
+
+    // mixed operands use the dynamic path and the runtime size checks
+    REQUIRE(axiom::linalg::dot(a, d) == Catch::Approx(6.0));
+    const Vec<double> e = a - d;
+    REQUIRE(e[2] == 2.0);
+    REQUIRE_THROWS_AS(axiom::linalg::dot(a, Vec<double>(4)), axiom::core::Error);
+
+    // cross of dynamic operands returns a dynamic Vec of size 3
+    const Vec<double> x(std::vector<double>{1.0, 0.0, 0.0});
+    const Vec<double> y(std::vector<double>{0.0, 1.0, 0.0});
+    const auto z = axiom::linalg::cross(x, y);
+    STATIC_REQUIRE(std::is_same_v<std::remove_const_t<decltype(z)>, Vec<double>>);
+    REQUIRE(z.size() == 3);
+    REQUIRE(z[2] == 1.0);
+    REQUIRE(axiom::linalg::cross(d, a)[0] == 1.0);
+    REQUIRE_THROWS_AS(axiom::linalg::cross(Vec<double>(3), Vec<double>(4)), axiom::core::Error);
+
+    // fixed containers hand out ordinary views
+    Mat3d M = Mat3d::identity();
+    M.row(0) = a;
+    REQUIRE(M(0, 2) == 3.0);
+    REQUIRE(axiom::linalg::sum(M.col(2)) == Catch::Approx(4.0));
+    const Mat<double> big = Mat<double>::ones(3, 2);
+    const Mat<double> prod = axiom::linalg::matmul(M, big);
+    REQUIRE(prod(0, 1) == Catch::Approx(6.0));
+    REQUIRE(axiom::linalg::norm(a, 2) == Catch::Approx(std::sqrt(14.0)));
+}
+
+TEST_CASE("mismatched fixed sizes are rejected at compile time", "[linalg][fixed]") {
+    STATIC_REQUIRE(addable<Vec3d, Vec3d>);
+    STATIC_REQUIRE_FALSE(addable<Vec3d, Vec<double, 4>>);
+    STATIC_REQUIRE(addable<Vec3d, Vec<double>>);
+    STATIC_REQUIRE_FALSE(addable<Mat3d, Mat2d>);
+    STATIC_REQUIRE_FALSE(addable<Mat<double, 2, 3>, Mat<double, 3, 2>>);
+
+    STATIC_REQUIRE(dottable<Vec3d, Vec3d>);
+    STATIC_REQUIRE_FALSE(dottable<Vec3d, Vec<double, 2>>);
+    STATIC_REQUIRE_FALSE(dottable<Vec3d, Vec3f>);
+
+    STATIC_REQUIRE(multipliable<Mat<double, 2, 3>, Mat<double, 3, 4>>);
+    STATIC_REQUIRE_FALSE(multipliable<Mat<double, 2, 3>, Mat<double, 2, 3>>);
+    STATIC_REQUIRE(std::is_same_v<decltype(axiom::linalg::matmul(Mat<double, 2, 3>{}, Mat<double, 3, 4>{})),
+                                  Mat<double, 2, 4>>);
+}
+
+TEST_CASE("fixed-size products agree with the dynamic kernels", "[linalg][fixed]") {
+    Mat<double, 4, 5> A;
+    Mat<double, 5, 3> B;
+    Vec<double, 5> x;
+    for (std::size_t i = 0; i < A.size(); ++i) A.data()[i] = 0.25 * static_cast<double>(i) - 2.0;
+    for (std::size_t i = 0; i < B.size(); ++i) B.data()[i] = 1.0 / (1.0 + static_cast<double>(i));
+    for (std::size_t i = 0; i < x.size(); ++i) x[i] = static_cast<double>(i) - 1.5;
+
+    const Mat<double> Ad = A, Bd = B;
+    const Vec<double> xd = x;
+    const auto C = axiom::linalg::matmul(A, B);
+    const Mat<double> Cd = axiom::linalg::matmul(Ad, Bd);
+    for (std::size_t r = 0; r < 4; ++r) {
+        for (std::size_t c = 0; c < 3; ++c) REQUIRE(C(r, c) == Catch::Approx(Cd(r, c)));
+    }
+
+    const auto y = axiom::linalg::matvec(A, x);
+    const Vec<double> yd = axiom::linalg::matvec(Ad, xd);
+    for (std::size_t i = 0; i < 4; ++i) REQUIRE(y[i] == Catch::Approx(yd[i]));
+
+    Vec<double, 5> z = Vec<double, 5>::ones();
+    axiom::linalg::gemv_t(2.0, A, y, 0.5, z);
+    const Vec<double> zd = axiom::linalg::matvec_t(Ad, yd);
+    for (std::size_t i = 0; i < 5; ++i) REQUIRE(z[i] == Catch::Approx(2.0 * zd[i] + 0.5));
+}
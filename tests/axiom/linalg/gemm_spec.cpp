@@ -0,0 +1,108 @@
+#include <catch2/catch_test_macros.hpp>
+#include "catch2/catch_approx.hpp"
+#include "catch2/catch_template_test_macros.hpp"
+#include <cmath>
+#include <vector>
+
+#include "axiom/core/cpu.hpp"
+#include "axiom/linalg/ops.hpp"
+
+#include "../test_util.hpp"
+
+using axiom::core::Isa;
+using axiom::linalg::Mat;
+using axiom::test::random_mat;
+
+namespace {
+    template <typename T>
+    Mat<T> reference(const T alpha, const Mat<T>& A, const Mat<T>& B, const T beta, const Mat<T>& C) {
+        Mat<T> R(C.rows(), C.cols());
+        for (std::size_t i = 0; i < A.rows(); ++i) {
+            for (std::size_t j = 0; j < B.cols(); ++j) {
+                double acc = 0.0;
+                for (std::size_t p = 0; p < A.cols(); ++p) acc += double(A(i, p)) * double(B(p, j));
+                R(i, j) = static_cast<T>(alpha * acc + beta * C(i, j));
+            }
+        }
+        return R;
+    }
+
+    template <typename T>
+    void require_close(const Mat<T>& got, const Mat<T>& want, const std::size_t k) {
+        const double tol = (std::is_same_v<T, float> ? 1e-5 : 1e-13) * static_cast<double>(k + 1);
+        for (std::size_t i = 0; i < got.rows(); ++i) {
+            for (std::size_t j = 0; j < got.cols(); ++j) {
+                INFO("at (" << i << ", " << j << ")");
+                REQUIRE(std::abs(got(i, j) - want(i, j)) <= tol);
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("gemm matches the triple loop on every ISA", "[linalg][gemm]", float, double) {
+    using T = TestType;
+    struct Shape { std::size_t m, n, k; };
+    const std::vector<Shape> shapes{{1, 1, 1}, {3, 5, 7}, {13, 17, 1}, {24, 32, 64},
+                                    {37, 29, 300}, {150, 70, 260}, {7, 300, 9}};
+
+    const Isa saved = axiom::core::active_isa();
+    for (const Isa isa : {Isa::kScalar, Isa::kSse2, Isa::kAvx2, Isa::kAvx512}) {
+        if (isa > axiom::core::detected_isa()) break;
+        axiom::core::set_active_isa(isa);
+        for (const auto [m, n, k] : shapes) {
+            INFO(axiom::core::isa_name(isa) << " m=" << m << " n=" << n << " k=" << k);
+            const Mat<T> A = random_mat<T>(m, k, 1);
+            const Mat<T> B = random_mat<T>(k, n, 2);
+            const Mat<T> C0 = random_mat<T>(m, n, 3);
+
+            Mat<T> C = C0;
+            axiom::linalg::gemm(T{2}, A, B, T{-0.5}, C);
+            require_close(C, reference(T{2}, A, B, T{-0.5}, C0), k);
+
+            require_close(axiom::linalg::matmul(A, B), reference(T{1}, A, B, T{0}, C0), k);
+        }
+    }
+    axiom::core::set_active_isa(saved);
+}
+
+TEST_CASE("gemm threaded path agrees with the serial one", "[linalg][gemm]") {
+    const Mat<double> A = random_mat<double>(301, 123, 4);
+    const Mat<double> B = random_mat<double>(123, 97, 5);
+    const Mat<double> serial = axiom::linalg::matmul(A, B, 1);
+    const Mat<double> threaded = axiom::linalg::matmul(A, B, 4);
+    require_close(threaded, serial, 0);
+
+    // wide product splits along N instead
+    const Mat<double> W = random_mat<double>(97, 301, 6);
+    require_close(axiom::linalg::matmul(B, W, 3), axiom::linalg::matmul(B, W, 1), 0);
+}
+
+TEST_CASE("gemm with beta = 0 ignores NaN in C and k-loop edge cases", "[linalg][gemm]") {
+    const Mat<double> A = Mat<double>::ones(5, 4);
+    const Mat<double> B = Mat<double>::ones(4, 6);
+    Mat<double> C(5, 6);
+    C.fill(std::nan(""));
+    axiom::linalg::gemm(1.0, A, B, 0.0, C);
+    REQUIRE(C(4, 5) == Catch::Approx(4.0));
+
+    axiom::linalg::gemm(0.0, A, B, 2.0, C);
+    REQUIRE(C(0, 0) == Catch::Approx(8.0));
+}
+
+TEST_CASE("gemm falls back to a generic loop for other element types", "[linalg][gemm]") {
+    const Mat<int> A(std::vector<int>{1, 2, 3, 4, 5, 6}, 3);
+    const Mat<int> B(std::vector<int>{1, 0, 0, 1, 1, 1}, 2);
+    const Mat<int> C = axiom::linalg::matmul(A, B);
+    REQUIRE(C(0, 0) == 4);
+    REQUIRE(C(0, 1) == 5);
+    REQUIRE(C(1, 0) == 10);
+    REQUIRE(C(1, 1) == 11);
+}
+
+TEST_CASE("gemm rejects mismatched shapes and aliasing", "[linalg][gemm]") {
+    Mat<double> A(3, 4), B(5, 2), C(3, 2);
+    REQUIRE_THROWS_AS(axiom::linalg::gemm(1.0, A, B, 0.0, C), axiom::core::Error);
+
+    Mat<double> S = Mat<double>::identity(3);
+    REQUIRE_THROWS_AS(axiom::linalg::gemm(1.0, S, S, 0.0, S), axiom::core::Error);
+}
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include <catch2/catch_test_macros.hpp>
+#include "catch2/catch_approx.hpp"
+#include "catch2/catch_template_test_macros.hpp"
+#include <cmath>
+#include <vector>
+
+#include "axiom/core/cpu.hpp"
+#include "axiom/linalg/ops.hpp"
+
+#include "../test_util.hpp"
+
+using axiom::core::Isa;
+using axiom::linalg::Mat;
+using axiom::linalg::Vec;
+using axiom::test::random_mat;
+using axiom::test::random_vec;
+
+TEMPLATE_TEST_CASE("gemv and gemv_t match reference loops on every ISA", "[linalg][gemv]", float, double) {
+    using T = TestType;
+    const double tol = std::is_same_v<T, float> ? 1e-4 : 1e-12;
+    const Isa saved = axiom::core::active_isa();
+    for (const Isa isa : {Isa::kScalar, Isa::kSse2, Isa::kAvx2, Isa::kAvx512}) {
+        if (isa > axiom::core::detected_isa()) break;
+        axiom::core::set_active_isa(isa);
+        for (const auto& [m, n] : std::vector<std::pair<std::size_t, std::size_t>>{{1, 1}, {3, 5}, {9, 33}, {130, 67}, {300, 400}}) {
+            INFO(axiom::core::isa_name(isa) << " m=" << m << " n=" << n);
+            const Mat<T> A = random_mat<T>(m, n, 1);
+            const Vec<T> x = random_vec<T>(n, 2);
+            const Vec<T> xt = random_vec<T>(m, 3);
+            const Vec<T> y0 = random_vec<T>(m, 4);
+            const Vec<T> yt0 = random_vec<T>(n, 5);
+
+            Vec<T> y = y0;
+            axiom::linalg::gemv(T{2}, A, x, T{0.5}, y);
+            Vec<T> yt = yt0;
+            axiom::linalg::gemv_t(T{-1}, A, xt, T{3}, yt);
+
+            for (std::size_t i = 0; i < m; ++i) {
+                double s = 0;
+                for (std::size_t j = 0; j < n; ++j) s += double(A(i, j)) * double(x[j]);
+                REQUIRE(std::abs(y[i] - (2 * s + 0.5 * y0[i])) <= tol * double(n));
+            }
+            for (std::size_t j = 0; j < n; ++j) {
+                double s = 0;
+                for (std::size_t i = 0; i < m; ++i) s += double(A(i, j)) * double(xt[i]);
+                REQUIRE(std::abs(yt[j] - (-s + 3 * yt0[j])) <= tol * double(m));
+            }
+        }
+    }
+    axiom::core::set_active_isa(saved);
+}
+
+TEST_CASE("threaded gemv partitions agree with the serial kernels", "[linalg][gemv]") {
+    const std::size_t m = 517, n = 389;
+    const Mat<double> A = random_mat<double>(m, n, 7);
+    const Vec<double> x = random_vec<double>(n, 8);
+    const Vec<double> xt = random_vec<double>(m, 9);
+
+    const Vec<double> y1 = axiom::linalg::matvec(A, x, 1);
+    const Vec<double> y4 = axiom::linalg::matvec(A, x, 4);
+    for (std::size_t i = 0; i < m; ++i) REQUIRE(y4[i] == y1[i]);
+
+    const Vec<double> t1 = axiom::linalg::matvec_t(A, xt, 1);
+    const Vec<double> t4 = axiom::linalg::matvec_t(A, xt, 4);
+    for (std::size_t j = 0; j < n; ++j) REQUIRE(t4[j] == t1[j]);
+}
+
+TEST_CASE("gemv with beta = 0 ignores the previous contents of y", "[linalg][gemv]") {
+    const Mat<double> A = Mat<double>::ones(4, 3);
+    const Vec<double> x = Vec<double>::ones(3);
+    Vec<double> y(4);
+    y.fill(std::nan(""));
+    axiom::linalg::gemv(1.0, A, x, 0.0, y);
+    REQUIRE(y[3] == Catch::Approx(3.0));
+
+    Vec<double> yt(3);
+    yt.fill(std::nan(""));
+    axiom::linalg::gemv_t(1.0, A, Vec<double>::ones(4), 0.0, yt);
+    REQUIRE(yt[2] == Catch::Approx(4.0));
+}
+
+TEST_CASE("gemv generic path and argument checks", "[linalg][gemv]") {
+    const Mat<int> A(std::vector<int>{1, 2, 3, 4, 5, 6}, 3);
+    const Vec<int> y = axiom::linalg::matvec(A, Vec<int>(std::vector<int>{1, 0, -1}));
+    REQUIRE(y[0] == -2);
+    REQUIRE(y[1] == -2);
+    const Vec<int> yt = axiom::linalg::matvec_t(A, Vec<int>(std::vector<int>{1, 1}));
+    REQUIRE(yt[2] == 9);
+
+    const Mat<double> B(3, 3);
+    Vec<double> v(3), w(4);
+    REQUIRE_THROWS_AS(axiom::linalg::gemv(1.0, B, v, 0.0, w), axiom::core::Error);
+    REQUIRE_THROWS_AS(axiom::linalg::gemv_t(1.0, B, v, 0.0, v), axiom::core::Error);
+}
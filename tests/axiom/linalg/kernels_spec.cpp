@@ -0,0 +1,132 @@
+#include <catch2/catch_test_macros.hpp>
+#include "catch2/catch_approx.hpp"
+#include "catch2/catch_template_test_macros.hpp"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "axiom/core/cpu.hpp"
+#include "axiom/linalg/ops.hpp"
+
+#include "../test_util.hpp"
+
+using axiom::core::Isa;
+using axiom::linalg::Vec;
+using axiom::test::for_each_isa;
+using axiom::test::random_vec;
+
+namespace {
+    // relative tolerance against the previous long double accumulation
+    template <typename T>
+    long double tolerance() {
+        return std::is_same_v<T, float> ? 1e-5L : 1e-13L;
+    }
+}
+
+TEMPLATE_TEST_CASE("simd reductions match long double reference", "[linalg][kernels]", float, double) {
+    using T = TestType;
+    const std::vector<std::size_t> sizes{1, 2, 3, 5, 7, 8, 15, 16, 17, 31, 33, 64, 65, 127,
+                                         1000, 2047, 2048, 2049, 4097, 100003};
+
+    for_each_isa([&] {
+        for (const std::size_t n : sizes) {
+            INFO("n = " << n);
+            const Vec<T> a = random_vec<T>(n, 7u + static_cast<unsigned>(n));
+            const Vec<T> b = random_vec<T>(n, 11u + static_cast<unsigned>(n));
+
+            long double dot = 0, dot_mag = 0, sum = 0, l1 = 0, sq = 0, dist = 0;
+            T infty{};
+            for (std::size_t i = 0; i < n; ++i) {
+                const long double x = a[i], y = b[i];
+                dot += x * y;
+                dot_mag += std::fabs(x * y);
+                sum += x;
+                l1 += std::fabs(x);
+                sq += x * x;
+                dist += (x - y) * (x - y);
+                infty = std::max(infty, std::abs(a[i]));
+            }
+            const long double tol = tolerance<T>();
+
+            REQUIRE(std::fabs(axiom::linalg::dot(a, b) - dot) <= tol * dot_mag);
+            REQUIRE(std::fabs(axiom::linalg::sum(a) - sum) <= tol * l1);
+            REQUIRE(std::fabs(a.l1_norm() - l1) <= tol * l1);
+            REQUIRE(std::fabs(axiom::linalg::len_squared(a) - sq) <= 1e-13L * sq);
+            REQUIRE(std::fabs(a.l2_norm() - std::sqrt(sq)) <= 1e-13L * std::sqrt(sq));
+            REQUIRE(std::fabs(axiom::linalg::distanceSquared(a, b) - dist) <= tol * dist);
+            REQUIRE(a.infty_norm() == infty);
+        }
+    });
+}
+
+TEMPLATE_TEST_CASE("simd min / max / argmin / argmax match the scalar loops", "[linalg][kernels]", float, double) {
+    using T = TestType;
+    for_each_isa([&] {
+        for (const std::size_t n : {1, 3, 9, 40, 1001, 5000}) {
+            INFO("n = " << n);
+            Vec<T> v = random_vec<T>(n, 3u + static_cast<unsigned>(n));
+            // duplicate extremes, the first occurrence must win
+            if (n > 4) {
+                v[n - 1] = v[n / 2] = T{-2};
+                v[n - 2] = v[n / 3] = T{2};
+            }
+            T lo = std::numeric_limits<T>::max(), hi = std::numeric_limits<T>::lowest();
+            std::size_t lo_idx = 0, hi_idx = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                if (v[i] < lo) { lo = v[i]; lo_idx = i; }
+                if (v[i] > hi) { hi = v[i]; hi_idx = i; }
+            }
+            REQUIRE(axiom::linalg::minCoeff(v) == lo);
+            REQUIRE(axiom::linalg::maxCoeff(v) == hi);
+            REQUIRE(axiom::linalg::argMin(v) == lo_idx);
+            REQUIRE(axiom::linalg::argMax(v) == hi_idx);
+        }
+    });
+}
+
+TEMPLATE_TEST_CASE("simd extremes ignore NaN like the std::min based loops", "[linalg][kernels]", float, double) {
+    using T = TestType;
+    const T nan = std::numeric_limits<T>::quiet_NaN();
+    for_each_isa([&] {
+        Vec<T> v = Vec<T>::ones(37);
+        v[0] = nan;
+        v[5] = T{-3};
+        v[20] = nan;
+        v[30] = T{4};
+        REQUIRE(axiom::linalg::minCoeff(v) == T{-3});
+        REQUIRE(axiom::linalg::maxCoeff(v) == T{4});
+        REQUIRE(axiom::linalg::argMin(v) == 5);
+        REQUIRE(axiom::linalg::argMax(v) == 30);
+        REQUIRE(v.infty_norm() == T{4});
+    });
+}
+
+TEST_CASE("compensated accumulation stays accurate without long double", "[linalg][kernels]") {
+    for_each_isa([&] {
+        // 0.1 is not representable, naive summation drifts by ~1e-6 (double) and ~1% (float)
+        const Vec<double> v(std::vector<double>(1'000'000, 0.1));
+        REQUIRE(std::fabs(axiom::linalg::sum(v) - 100000.0) < 1e-8);
+        REQUIRE(std::fabs(axiom::linalg::len_squared(v) - 10000.0) < 1e-9);
+
+        const Vec<float> f(std::vector<float>(1'000'000, 0.1f));
+        REQUIRE(axiom::linalg::sum(f) == Catch::Approx(1e6 * static_cast<double>(0.1f)).epsilon(1e-5));
+    });
+}
+
+TEST_CASE("kernels handle empty ranges", "[linalg][kernels]") {
+    const double* none = nullptr;
+    REQUIRE(axiom::linalg::kernels::sum(none, 0) == 0.0);
+    REQUIRE(axiom::linalg::kernels::sum_sq(none, 0) == 0.0);
+    REQUIRE(axiom::linalg::kernels::argmin(none, 0) == 0);
+    REQUIRE(axiom::linalg::kernels::min(none, 0) == std::numeric_limits<double>::max());
+}
+
+TEST_CASE("isa override is bounded by detection", "[core][cpu]") {
+    const Isa detected = axiom::core::detected_isa();
+    if (detected < Isa::kAvx512) {
+        REQUIRE_THROWS_AS(axiom::core::set_active_isa(Isa::kAvx512), axiom::core::Error);
+    }
+    REQUIRE_NOTHROW(axiom::core::set_active_isa(Isa::kScalar));
+    REQUIRE(axiom::core::active_isa() == Isa::kScalar);
+    axiom::core::set_active_isa(detected);
+}
\ No newline at end of file
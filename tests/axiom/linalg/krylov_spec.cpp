@@ -0,0 +1,200 @@
+#include <catch2/catch_test_macros.hpp>
+#include "catch2/catch_approx.hpp"
+#include <cmath>
+#include <vector>
+
+#include "axiom/core/memory.hpp"
+#include "axiom/linalg/krylov.hpp"
+
+using axiom::core::index;
+using axiom::linalg::CsrMat;
+using axiom::linalg::KrylovOptions;
+using axiom::linalg::Mat;
+using axiom::linalg::Triplet;
+using axiom::linalg::Vec;
+
+namespace {
+    // 5-point Laplacian on a g x g grid plus a first-order convection term c (nonsymmetric for c != 0)
+    CsrMat<double> laplacian(const index g, const double c = 0.0) {
+        std::vector<Triplet<double>> t;
+        for (index i = 0; i < g; ++i) {
+            for (index j = 0; j < g; ++j) {
+                const index r = i * g + j;
+                t.push_back({r, r, 4.0});
+                if (i > 0) t.push_back({r, r - g, -1.0 - c});
+                if (i + 1 < g) t.push_back({r, r + g, -1.0 + c});
+                if (j > 0) t.push_back({r, r - 1, -1.0 - c});
+                if (j + 1 < g) t.push_back({r, r + 1, -1.0 + c});
+            }
+        }
+        return CsrMat<double>::from_triplets(g * g, g * g, t);
+    }
+
+    double true_residual(const CsrMat<double>& A, const Vec<double>& b, const Vec<double>& x) {
+        Vec<double> r(b.size());
+        axiom::linalg::gemv(1.0, A, x, 0.0, r);
+        r -= b;
+        return r.l2_norm() / b.l2_norm();
+    }
+
+    Vec<double> rhs(const index n) {
+        Vec<double> b(n);
+        for (index i = 0; i < n; ++i) b[i] = std::sin(0.1 * static_cast<double>(i)) + 1.0;
+        return b;
+    }
+}
+
+TEST_CASE("matrices, sparse matrices and callables are linear operators", "[linalg][krylov]") {
+    STATIC_REQUIRE(axiom::linalg::LinearOperator<Mat<double>, double>);
+    STATIC_REQUIRE(axiom::linalg::LinearOperator<CsrMat<float>, float>);
+    STATIC_REQUIRE(axiom::linalg::LinearOperator<axiom::linalg::CscMat<double>, double>);
+    STATIC_REQUIRE_FALSE(axiom::linalg::LinearOperator<Vec<double>, double>);
+    STATIC_REQUIRE(axiom::linalg::Preconditioner<axiom::linalg::Jacobi<double>, double>);
+    STATIC_REQUIRE(axiom::linalg::Preconditioner<axiom::linalg::IdentityPreconditioner, float>);
+
+    const auto twice = axiom::linalg::make_operator<double>(3, 3, [](const Vec<double>& x, Vec<double>& y) {
+        for (index i = 0; i < x.size(); ++i) y[i] = 2.0 * x[i];
+    });
+    STATIC_REQUIRE(axiom::linalg::LinearOperator<decltype(twice), double>);
+    Vec<double> y(3);
+    axiom::linalg::apply(twice, Vec<double>::ones(3), y);
+    REQUIRE(y[2] == 2.0);
+}
+
+TEST_CASE("preconditioned CG solves the Poisson problem", "[linalg][krylov][cg]") {
+    const index g = 24, n = g * g;
+    const CsrMat<double> A = laplacian(g);
+    const Vec<double> b = rhs(n);
+    axiom::linalg::Cg<double> cg(n, {.tolerance = 1e-10});
+
+    Vec<double> x(n);
+    const auto plain = cg.solve(A, b, x);
+    REQUIRE(plain.converged);
+    REQUIRE(plain.residual <= 1e-10);
+    REQUIRE(true_residual(A, b, x) < 1e-9);
+
+    Vec<double> xj(n);
+    const auto jacobi = cg.solve(A, b, xj, axiom::linalg::Jacobi<double>(A));
+    REQUIRE(jacobi.converged);
+    REQUIRE(true_residual(A, b, xj) < 1e-9);
+
+    Vec<double> xi(n);
+    const auto ilu = cg.solve(A, b, xi, axiom::linalg::Ilu0<double>(A));
+    REQUIRE(ilu.converged);
+    REQUIRE(true_residual(A, b, xi) < 1e-9);
+    REQUIRE(ilu.iterations < plain.iterations);
+
+    // a converged x as initial guess needs no iterations
+    const auto again = cg.solve(A, b, xi);
+    REQUIRE(again.converged);
+    REQUIRE(again.iterations == 0);
+
+    // the same stencil without a matrix gives the same iterates
+    const auto stencil = axiom::linalg::make_operator<double>(n, n, [&](const Vec<double>& v, Vec<double>& out) {
+        axiom::linalg::gemv(1.0, A, v, 0.0, out);
+    });
+    Vec<double> xf(n);
+    const auto free = cg.solve(stencil, b, xf);
+    REQUIRE(free.iterations == plain.iterations);
+}
+
+TEST_CASE("solve() does not allocate", "[linalg][krylov]") {
+    const index g = 16, n = g * g;
+    const CsrMat<double> A = laplacian(g, 0.3);
+    const Vec<double> b = rhs(n);
+    const axiom::linalg::Ilu0<double> ilu(A);
+    axiom::linalg::Gmres<double> gmres(n, {.restart = 10});
+    axiom::linalg::Cg<double> cg(n);
+    Vec<double> x(n);
+    const CsrMat<double> S = laplacian(g);
+
+    axiom::core::reset_memory_stats();
+    const auto r1 = gmres.solve(A, b, x, ilu);
+    x.fill(0.0);
+    const auto r2 = cg.solve(S, b, x);
+    REQUIRE(axiom::core::memory_stats().heap_allocations == 0);
+    REQUIRE(r1.converged);
+    REQUIRE(r2.converged);
+}
+
+TEST_CASE("restarted GMRES solves a nonsymmetric system", "[linalg][krylov][gmres]") {
+    const index g = 20, n = g * g;
+    const CsrMat<double> A = laplacian(g, 0.4);
+    const Vec<double> b = rhs(n);
+
+    Vec<double> x(n);
+    const auto plain = axiom::linalg::gmres(A, b, x, axiom::linalg::IdentityPreconditioner{},
+                                            {.tolerance = 1e-10, .restart = 20});
+    REQUIRE(plain.converged);
+    REQUIRE(plain.iterations > 20);     // crossed at least one restart
+    REQUIRE(true_residual(A, b, x) < 1e-9);
+
+    Vec<double> xi(n);
+    const auto ilu = axiom::linalg::gmres(A, b, xi, axiom::linalg::Ilu0<double>(A), {.tolerance = 1e-10});
+    REQUIRE(ilu.converged);
+    REQUIRE(ilu.iterations < plain.iterations);
+    REQUIRE(true_residual(A, b, xi) < 1e-9);
+
+    // CG is not defined here, GMRES on a dense copy in float still converges
+    const Mat<float> dense = [&] {
+        Mat<float> m(n, n);
+        const Mat<double> d = A.to_dense();
+        for (index i = 0; i < n; ++i) {
+            for (index j = 0; j < n; ++j) m(i, j) = static_cast<float>(d(i, j));
+        }
+        return m;
+    }();
+    Vec<float> bf(n), xf(n);
+    for (index i = 0; i < n; ++i) bf[i] = static_cast<float>(b[i]);
+    const auto single = axiom::linalg::gmres(dense, bf, xf, axiom::linalg::Jacobi<float>(dense), {.tolerance = 1e-5});
+    REQUIRE(single.converged);
+    REQUIRE(single.residual <= 1e-5);
+
+    // running out of iterations is reported, not thrown
+    Vec<double> xs(n);
+    const auto capped = axiom::linalg::gmres(A, b, xs, axiom::linalg::IdentityPreconditioner{},
+                                             {.max_iterations = 5});
+    REQUIRE_FALSE(capped.converged);
+    REQUIRE(capped.iterations == 5);
+    REQUIRE(capped.residual == Catch::Approx(true_residual(A, b, xs)).epsilon(1e-8));
+}
+
+TEST_CASE("ILU(0) of a tridiagonal matrix is its exact LU", "[linalg][krylov]") {
+    const index n = 50;
+    std::vector<Triplet<double>> t;
+    for (index i = 0; i < n; ++i) {
+        t.push_back({i, i, 3.0});
+        if (i > 0) t.push_back({i, i - 1, -1.0});
+        if (i + 1 < n) t.push_back({i, i + 1, -1.5});
+    }
+    const CsrMat<double> A = CsrMat<double>::from_triplets(n, n, t);
+    const Vec<double> b = rhs(n);
+    Vec<double> x(n);
+    const auto result = axiom::linalg::gmres(A, b, x, axiom::linalg::Ilu0<double>(A), {.tolerance = 1e-12});
+    REQUIRE(result.converged);
+    REQUIRE(result.iterations == 1);
+}
+
+TEST_CASE("Krylov solvers report bad input", "[linalg][krylov]") {
+    const CsrMat<double> A = laplacian(4);
+    Vec<double> x(16);
+    REQUIRE_THROWS_AS(axiom::linalg::cg(A, Vec<double>::ones(15), x), axiom::core::Error);
+    REQUIRE_THROWS_AS(axiom::linalg::Gmres<double>(16, {.restart = 0}), axiom::core::Error);
+
+    // indefinite
+    Mat<double> D = Mat<double>::identity(3);
+    D(1, 1) = -1.0;
+    Vec<double> y(3);
+    REQUIRE_THROWS_AS(axiom::linalg::cg(D, Vec<double>::ones(3), y), axiom::core::Error);
+
+    std::vector<Triplet<double>> no_diag = {{0, 1, 1.0}, {1, 0, 1.0}};
+    REQUIRE_THROWS_AS(axiom::linalg::Ilu0<double>(CsrMat<double>::from_triplets(2, 2, no_diag)), axiom::core::Error);
+    REQUIRE_THROWS_AS(axiom::linalg::Jacobi<double>(CsrMat<double>::from_triplets(2, 2, no_diag)), axiom::core::Error);
+
+    // b = 0 is solved by x = 0 without iterating
+    Vec<double> z = Vec<double>::ones(16);
+    Vec<double> zero(16);
+    const auto result = axiom::linalg::cg(A, zero, z);
+    REQUIRE(result.converged);
+    REQUIRE(z.l2_norm() == 0.0);
+}
@@ -0,0 +1,120 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <limits>
+#include <random>
+
+#include "axiom/linalg/mixed.hpp"
+
+#include "../test_util.hpp"
+
+using axiom::linalg::Factorization;
+using axiom::linalg::Mat;
+using axiom::linalg::MixedSolver;
+using axiom::linalg::RefineStatus;
+using axiom::linalg::Vec;
+using axiom::test::random_vec;
+
+namespace {
+    // random with a dominant diagonal, condition number in the tens
+    Mat<double> well_conditioned(const std::size_t n, const unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> dist(-1.0, 1.0);
+        Mat<double> A(n, n);
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = 0; j < n; ++j) A(i, j) = dist(rng);
+            A(i, i) += static_cast<double>(n) / 4.0;
+        }
+        return A;
+    }
+
+    double max_diff(const Vec<double>& a, const Vec<double>& b) {
+        double worst = 0.0;
+        for (std::size_t i = 0; i < a.size(); ++i) worst = std::max(worst, std::abs(a[i] - b[i]));
+        return worst;
+    }
+}
+
+TEST_CASE("float LU with double refinement reaches double accuracy", "[linalg][mixed]") {
+    const std::size_t n = 150;
+    const Mat<double> A = well_conditioned(n, 1);
+    const Vec<double> b = random_vec<double>(n, 2);
+
+    const auto [x, report] = axiom::linalg::mixed_solve(A, b, {.block = 32});
+    REQUIRE(report.status == RefineStatus::kConverged);
+    REQUIRE(report.converged());
+    REQUIRE(report.iterations >= 1);
+    REQUIRE(report.iterations <= 5);
+    REQUIRE(report.residual <= std::sqrt(double(n)) * std::numeric_limits<double>::epsilon());
+
+    const Vec<double> exact = axiom::linalg::solve(A, b);
+    REQUIRE(max_diff(x, exact) < 1e-12);
+}
+
+TEST_CASE("a mixed solver is reused across right-hand sides", "[linalg][mixed]") {
+    const std::size_t n = 80;
+    Mat<double> A = well_conditioned(n, 3);
+    // symmetric positive definite: A + A^T with its dominant diagonal
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < i; ++j) A(i, j) = A(j, i) = A(i, j) + A(j, i);
+    }
+    MixedSolver solver(A, {.factorization = Factorization::kCholesky, .policy = axiom::exec::on_threads(2)});
+    REQUIRE(solver.size() == n);
+    for (unsigned seed = 0; seed < 4; ++seed) {
+        const Vec<double> b = random_vec<double>(n, 10 + seed);
+        Vec<double> x(n);
+        const auto report = solver.solve(b, x);
+        REQUIRE(report.status == RefineStatus::kConverged);
+        REQUIRE(max_diff(x, axiom::linalg::cholesky(A).solve(b)) < 1e-12);
+    }
+    REQUIRE_FALSE(solver.fell_back());
+
+    const Vec<double> short_b(n - 1);
+    REQUIRE_THROWS_AS(solver.solve(short_b), axiom::core::Error);
+}
+
+TEST_CASE("refinement that stalls falls back to a double factorization", "[linalg][mixed]") {
+    // Hilbert matrix, condition number about 1e13, far past what float can refine
+    const std::size_t n = 10;
+    Mat<double> H(n, n);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) H(i, j) = 1.0 / static_cast<double>(i + j + 1);
+    }
+    const Vec<double> b = Vec<double>::ones(n);
+
+    MixedSolver solver(H);
+    const auto [x, report] = solver.solve(b);
+    REQUIRE(report.status == RefineStatus::kFallback);
+    REQUIRE(report.converged());
+    REQUIRE(solver.fell_back());
+    REQUIRE(report.residual < 1e-14);
+    REQUIRE(max_diff(x, axiom::linalg::solve(H, b)) == 0.0);
+
+    // without the fallback the best float iterate is reported as not converged
+    const auto refined = axiom::linalg::mixed_solve(H, b, {.fallback = false});
+    REQUIRE(refined.report.status == RefineStatus::kNotConverged);
+    REQUIRE_FALSE(refined.report.converged());
+    REQUIRE(refined.report.residual > 1e-14);
+}
+
+TEST_CASE("matrices float cannot factor go straight to double", "[linalg][mixed]") {
+    // singular once rounded to float
+    Mat<double> A(2, 2);
+    A(0, 0) = 1.0;
+    A(0, 1) = 1.0;
+    A(1, 0) = 1.0;
+    A(1, 1) = 1.0 + 1e-12;
+    MixedSolver near_singular(A);
+    REQUIRE(near_singular.fell_back());
+    const auto [x, report] = near_singular.solve(Vec<double>::ones(2));
+    REQUIRE(report.status == RefineStatus::kFallback);
+    REQUIRE(report.iterations == 0);
+
+    // out of float range
+    Mat<double> big = Mat<double>::identity(3);
+    big(1, 1) = 1e300;
+    const auto huge = axiom::linalg::mixed_solve(big, Vec<double>::ones(3));
+    REQUIRE(huge.report.status == RefineStatus::kFallback);
+    REQUIRE(huge.x[1] == 1e-300);
+
+    REQUIRE_THROWS_AS(MixedSolver(Mat<double>(2, 3)), axiom::core::Error);
+}
@@ -0,0 +1,174 @@
+#include <catch2/catch_test_macros.hpp>
+#include "catch2/catch_approx.hpp"
+#include "catch2/catch_template_test_macros.hpp"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "axiom/core/memory.hpp"
+#include "axiom/linalg/sparse.hpp"
+
+#include "../test_util.hpp"
+
+using axiom::linalg::CscMat;
+using axiom::linalg::CsrMat;
+using axiom::linalg::Mat;
+using axiom::linalg::Triplet;
+using axiom::linalg::Vec;
+using axiom::test::random_vec;
+
+namespace {
+    // about `density` of the entries set, with some duplicated coordinates
+    template <typename T>
+    std::vector<Triplet<T>> random_triplets(const std::size_t rows, const std::size_t cols, const double density,
+                                            const unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<T> value(T{-1}, T{1});
+        std::uniform_int_distribution<std::size_t> row(0, rows - 1), col(0, cols - 1);
+        const auto count = static_cast<std::size_t>(density * static_cast<double>(rows * cols));
+        std::vector<Triplet<T>> out;
+        for (std::size_t k = 0; k < count; ++k) {
+            out.push_back({row(rng), col(rng), value(rng)});
+            if (k % 7 == 0) out.push_back({out.back().row, out.back().col, value(rng)});
+        }
+        return out;
+    }
+
+    template <typename T>
+    Mat<T> dense_of(const std::size_t rows, const std::size_t cols, const std::vector<Triplet<T>>& entries) {
+        Mat<T> D(rows, cols);
+        for (const auto& e : entries) D(e.row, e.col) += e.value;
+        return D;
+    }
+}
+
+TEST_CASE("triplets are sorted and duplicates summed", "[linalg][sparse]") {
+    const std::vector<Triplet<double>> entries{
+        {2, 1, 4.0}, {0, 3, 1.0}, {2, 0, -1.0}, {0, 3, 2.0}, {1, 2, 5.0}, {2, 1, 0.5}};
+    const auto A = CsrMat<double>::from_triplets(3, 4, entries);
+    REQUIRE(A.nnz() == 4);
+    REQUIRE(std::vector<std::size_t>(A.row_ptr().begin(), A.row_ptr().end()) == std::vector<std::size_t>{0, 1, 2, 4});
+    REQUIRE(std::vector<std::size_t>(A.col_idx().begin(), A.col_idx().end()) == std::vector<std::size_t>{3, 2, 0, 1});
+    REQUIRE(A(0, 3) == 3.0);
+    REQUIRE(A(2, 1) == 4.5);
+    REQUIRE(A(1, 1) == 0.0);
+    REQUIRE_THROWS_AS(A(3, 0), axiom::core::Error);
+
+    const auto C = CscMat<double>::from_triplets(3, 4, entries);
+    REQUIRE(C.nnz() == 4);
+    REQUIRE(std::vector<std::size_t>(C.col_ptr().begin(), C.col_ptr().end()) == std::vector<std::size_t>{0, 1, 2, 3, 4});
+    REQUIRE(C(2, 1) == 4.5);
+
+    const Mat<double> D = A.to_dense();
+    const Mat<double> Dc = C.to_dense();
+    const Mat<double> Dt = A.transpose().to_dense();
+    for (std::size_t r = 0; r < 3; ++r) {
+        for (std::size_t c = 0; c < 4; ++c) {
+            REQUIRE(D(r, c) == A(r, c));
+            REQUIRE(Dc(r, c) == D(r, c));
+            REQUIRE(Dt(c, r) == D(r, c));
+        }
+    }
+    REQUIRE(CsrMat<double>::from_dense(D).nnz() == 4);
+    REQUIRE(CscMat<double>::from_dense(D).to_csr()(2, 0) == -1.0);
+
+    REQUIRE_THROWS_AS(CsrMat<double>::from_triplets(3, 4, std::vector<Triplet<double>>{{3, 0, 1.0}}),
+                      axiom::core::Error);
+}
+
+TEMPLATE_TEST_CASE("sparse matrix-vector products match the dense ones", "[linalg][sparse]", float, double) {
+    using T = TestType;
+    const double tol = std::is_same_v<T, float> ? 1e-4 : 1e-12;
+    const std::size_t m = 300, n = 170;
+    const auto entries = random_triplets<T>(m, n, 0.03, 1);
+    const Mat<T> D = dense_of(m, n, entries);
+    const auto A = CsrMat<T>::from_triplets(m, n, entries);
+    const auto C = A.to_csc();
+    const Vec<T> x = random_vec<T>(n, 2);
+    const Vec<T> u = random_vec<T>(m, 3);
+
+    const Vec<T> ref = axiom::linalg::matvec(D, x);
+    const Vec<T> ref_t = axiom::linalg::matvec_t(D, u);
+    for (const std::size_t threads : {1, 3}) {
+        Vec<T> y = Vec<T>::ones(m);
+        axiom::linalg::gemv(T{2}, A, x, T{-1}, y, threads);
+        const Vec<T> yc = axiom::linalg::matvec(C, x, threads);
+        Vec<T> z = Vec<T>::ones(n);
+        axiom::linalg::gemv_t(T{1}, A, u, T{1}, z, threads);
+        const Vec<T> zc = axiom::linalg::matvec_t(C, u, threads);
+        const Vec<T> zp = axiom::linalg::matvec_t(axiom::exec::Parallel{.threads = threads, .min_size = 1}, C, u);
+        REQUIRE(std::equal(zc.begin(), zc.end(), zp.begin()));
+        for (std::size_t i = 0; i < m; ++i) {
+            REQUIRE(double(y[i]) == Catch::Approx(2.0 * ref[i] - 1.0).margin(tol));
+            REQUIRE(double(yc[i]) == Catch::Approx(double(ref[i])).margin(tol));
+        }
+        for (std::size_t j = 0; j < n; ++j) {
+            REQUIRE(double(z[j]) == Catch::Approx(double(ref_t[j]) + 1.0).margin(tol));
+            REQUIRE(double(zc[j]) == Catch::Approx(double(ref_t[j])).margin(tol));
+        }
+    }
+
+    // strided operands, a column of a dense matrix in and a row of another out
+    Mat<T> X(n, 2);
+    X.col(1) = x;
+    Mat<T> Y(3, m);
+    axiom::linalg::gemv(T{1}, A, X.col(1), T{}, Y.row(2));
+    for (std::size_t i = 0; i < m; ++i) REQUIRE(double(Y(2, i)) == Catch::Approx(double(ref[i])).margin(tol));
+
+    REQUIRE_THROWS_AS(axiom::linalg::matvec(A, u), axiom::core::Error);
+    REQUIRE_THROWS_AS(axiom::linalg::matvec_t(C, x), axiom::core::Error);
+
+    // y written in place of x would read already overwritten entries
+    const auto P = CsrMat<T>::from_triplets(2, 2, std::vector<Triplet<T>>{{0, 1, T{1}}, {1, 0, T{1}}});
+    const auto Pc = P.to_csc();
+    Vec<T> v(std::vector<T>{T{1}, T{2}});
+    REQUIRE_THROWS_AS(axiom::linalg::gemv(T{1}, P, v, T{}, v), axiom::core::Error);
+    REQUIRE_THROWS_AS(axiom::linalg::gemv(T{1}, Pc, v, T{}, v), axiom::core::Error);
+    REQUIRE_THROWS_AS(axiom::linalg::gemv_t(T{1}, P, v, T{}, v), axiom::core::Error);
+    REQUIRE_THROWS_AS(axiom::linalg::gemv_t(T{1}, Pc, v, T{}, v), axiom::core::Error);
+    REQUIRE(v[0] == T{1});
+    REQUIRE(v[1] == T{2});
+}
+
+TEST_CASE("sparse times dense matrix", "[linalg][sparse]") {
+    const std::size_t m = 120, k = 90, n = 7;
+    const auto entries = random_triplets<double>(m, k, 0.05, 4);
+    const Mat<double> D = dense_of(m, k, entries);
+    const auto A = CsrMat<double>::from_triplets(m, k, entries);
+    const auto C = CscMat<double>::from_triplets(m, k, entries);
+
+    Mat<double> B(k, n);
+    const Vec<double> bv = random_vec<double>(k * n, 5);
+    std::copy(bv.begin(), bv.end(), B.data());
+    const Mat<double> ref = axiom::linalg::matmul(D, B);
+
+    for (const std::size_t threads : {1, 4}) {
+        const Mat<double> P = axiom::linalg::matmul(A, B, threads);
+        const Mat<double> Pc = axiom::linalg::matmul(C, B, threads);
+        Mat<double> Q = Mat<double>::ones(m, n);
+        axiom::linalg::gemm(0.5, A, B, 2.0, Q, threads);
+        for (std::size_t i = 0; i < m; ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                REQUIRE(P(i, j) == Catch::Approx(ref(i, j)).margin(1e-12));
+                REQUIRE(Pc(i, j) == Catch::Approx(ref(i, j)).margin(1e-12));
+                REQUIRE(Q(i, j) == Catch::Approx(0.5 * ref(i, j) + 2.0).margin(1e-12));
+            }
+        }
+    }
+    REQUIRE_THROWS_AS(axiom::linalg::matmul(A, Mat<double>(m, n)), axiom::core::Error);
+}
+
+TEST_CASE("repeated sparse products reuse arena buffers", "[linalg][sparse]") {
+    const std::size_t m = 2000, n = 1500;
+    const auto A = CsrMat<double>::from_triplets(m, n, random_triplets<double>(m, n, 0.01, 6));
+    const Vec<double> u = random_vec<double>(m, 7);
+    Vec<double> z(n);
+    axiom::linalg::gemv_t(1.0, A, u, 0.0, z, 4);
+    const Vec<double> first = z;
+
+    axiom::core::reset_memory_stats();
+    for (int it = 0; it < 5; ++it) axiom::linalg::gemv_t(1.0, A, u, 0.0, z, 4);
+    REQUIRE(axiom::core::memory_stats().heap_allocations == 0);
+    // per-thread partials are summed in a fixed order, so repeated runs agree bit for bit
+    for (std::size_t j = 0; j < n; ++j) REQUIRE(z[j] == first[j]);
+}
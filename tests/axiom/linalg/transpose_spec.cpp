@@ -0,0 +1,215 @@
+#include <catch2/catch_test_macros.hpp>
+#include "catch2/catch_approx.hpp"
+#include <algorithm>
+#include <concepts>
+#include <utility>
+#include <vector>
+
+#include "axiom/linalg/fixed.hpp"
+#include "axiom/linalg/ops.hpp"
+#include "axiom/linalg/transpose.hpp"
+
+using axiom::core::index;
+using axiom::linalg::ColMajor;
+using axiom::linalg::Mat;
+using axiom::linalg::MatView;
+using axiom::linalg::RowMajor;
+using axiom::linalg::Vec;
+
+namespace {
+    using ColMat = Mat<double, axiom::core::dynamic, axiom::core::dynamic, ColMajor>;
+
+    // A(r, c) = 1000 * r + c, every element distinct
+    template <typename M>
+    M counting(const index rows, const index cols) {
+        M A(rows, cols);
+        for (index r = 0; r < rows; ++r) {
+            for (index c = 0; c < cols; ++c) A(r, c) = 1000.0 * static_cast<double>(r) + static_cast<double>(c);
+        }
+        return A;
+    }
+
+    template <typename A, typename B>
+    bool is_transpose(const A& a, const B& b) {
+        if (a.rows() != b.cols() || a.cols() != b.rows()) return false;
+        for (index r = 0; r < a.rows(); ++r) {
+            for (index c = 0; c < a.cols(); ++c) {
+                if (a(r, c) != b(c, r)) return false;
+            }
+        }
+        return true;
+    }
+}
+
+TEST_CASE("column-major matrices store columns contiguously", "[linalg][transpose]") {
+    ColMat A = counting<ColMat>(3, 4);
+    REQUIRE(A.rows() == 3);
+    REQUIRE(A.cols() == 4);
+    REQUIRE(A.leading_dim() == 3);
+    REQUIRE(A.data()[1] == 1000.0);     // (1, 0) follows (0, 0)
+    REQUIRE(A.data()[3] == 1.0);        // (0, 1) starts the second column
+    REQUIRE(A.col(2).contiguous());
+    REQUIRE(A.row(1).stride() == 3);
+    REQUIRE(*(A.begin() + 2) == 2000.0);
+    REQUIRE_THROWS_AS(A.at(3, 0), axiom::core::Error);
+    REQUIRE_THROWS_AS(A.at(0, 4), axiom::core::Error);
+
+    // data handed over in column order
+    const ColMat B(std::vector<double>{1.0, 2.0, 3.0, 4.0, 5.0, 6.0}, 3);
+    REQUIRE(B.rows() == 2);
+    REQUIRE(B(1, 0) == 2.0);
+    REQUIRE(B(0, 2) == 5.0);
+
+    // converting between layouts keeps every element, expressions and ops accept both
+    const Mat<double> R = A;
+    REQUIRE(R(2, 3) == 2003.0);
+    const ColMat back = R;
+    REQUIRE(back(2, 3) == 2003.0);
+    const ColMat sum = A + 2.0 * R;
+    REQUIRE(sum(1, 2) == 3.0 * 1002.0);
+    const Mat<double> P = axiom::linalg::matmul(A, axiom::linalg::transpose(A));
+    const Mat<double> Q = axiom::linalg::matmul(R, axiom::linalg::transpose(R));
+    for (index r = 0; r < 3; ++r) {
+        for (index c = 0; c < 3; ++c) REQUIRE(P(r, c) == Catch::Approx(Q(r, c)));
+    }
+
+    // fixed-size matrices are row-major only
+    STATIC_REQUIRE(std::same_as<Mat<double, 2, 2>::layout, RowMajor>);
+    STATIC_REQUIRE(std::same_as<ColMat::layout, ColMajor>);
+}
+
+TEST_CASE("transposed views are zero-copy", "[linalg][transpose]") {
+    Mat<double> A = counting<Mat<double>>(5, 7);
+    const MatView<double> T = A.transposed();
+    REQUIRE(T.rows() == 7);
+    REQUIRE(T.cols() == 5);
+    REQUIRE(T.data() == A.data());
+    REQUIRE(is_transpose(A, T));
+    T(6, 4) = -1.0;
+    REQUIRE(A(4, 6) == -1.0);
+    REQUIRE(A.block(1, 2, 3, 4).transposed()(3, 2) == A(3, 5));
+
+    // op(A^T) straight from the strides
+    const Vec<double> x = Vec<double>::ones(5);
+    const Vec<double> y = axiom::linalg::matvec(A.transposed(), x);
+    for (index c = 0; c < 7; ++c) {
+        double s = 0.0;
+        for (index r = 0; r < 5; ++r) s += A(r, c);
+        REQUIRE(y[c] == Catch::Approx(s));
+    }
+    const axiom::linalg::Mat<double, 2, 3> F{1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+    REQUIRE(F.transposed()(2, 1) == 6.0);
+
+    // assigning a matrix its own transpose goes through a temporary
+    Mat<double> S = counting<Mat<double>>(40, 40);
+    const Mat<double> expected = axiom::linalg::transpose(S);
+    S = S.transposed();
+    REQUIRE(is_transpose(S, counting<Mat<double>>(40, 40)));
+    REQUIRE(is_transpose(expected, counting<Mat<double>>(40, 40)));
+
+    // so do += / -= with the matrix's own transpose
+    Mat<double> B(std::vector<double>{1.0, 2.0, 3.0, 4.0}, 2);
+    B += B.transposed();
+    REQUIRE(B(0, 1) == 5.0);
+    REQUIRE(B(1, 0) == 5.0);
+    REQUIRE(B(1, 1) == 8.0);
+    ColMat K = counting<ColMat>(40, 40);
+    K -= K.transposed();
+    for (index r = 0; r < 40; ++r) {
+        for (index c = 0; c < 40; ++c) REQUIRE(K(r, c) == 999.0 * (static_cast<double>(r) - static_cast<double>(c)));
+    }
+
+    // and a transpose anywhere inside an expression
+    Mat<double> N(std::vector<double>{0, 1, 2, 3, 4, 5, 6, 7, 8}, 3);
+    const Mat<double> Z(3, 3);
+    N = N.transposed() + Z;
+    const std::vector<double> nt{0, 3, 6, 1, 4, 7, 2, 5, 8};
+    REQUIRE(std::equal(nt.begin(), nt.end(), N.begin()));
+    Mat<double> C(std::vector<double>{0, 1, 2, 3, 4, 5, 6, 7, 8}, 3);
+    C += 1.0 * C.transposed();
+    const std::vector<double> sym{0, 4, 8, 4, 8, 12, 8, 12, 16};
+    REQUIRE(std::equal(sym.begin(), sym.end(), C.begin()));
+    ColMat D = counting<ColMat>(40, 40);
+    D -= -(D.transposed() - 2.0 * D.transposed());
+    for (index r = 0; r < 40; ++r) {
+        for (index c = 0; c < 40; ++c) REQUIRE(D(r, c) == 999.0 * (static_cast<double>(r) - static_cast<double>(c)));
+    }
+}
+
+TEST_CASE("views and fixed-size matrices take their own transpose through a temporary", "[linalg][transpose]") {
+    axiom::linalg::Mat<double, 2> F(1.0, 2.0, 3.0, 4.0);
+    F += F.transposed();
+    REQUIRE(F == axiom::linalg::Mat<double, 2>(2.0, 5.0, 5.0, 8.0));
+    F -= F.transposed();
+    REQUIRE(F == axiom::linalg::Mat<double, 2>::zeros());
+
+    Mat<double> A(std::vector<double>{1.0, 2.0, 3.0, 4.0}, 2);
+    A.view() += A.transposed();
+    const std::vector<double> sym{2.0, 5.0, 5.0, 8.0};
+    REQUIRE(std::equal(sym.begin(), sym.end(), A.begin()));
+    A.view() -= 0.5 * A.transposed();
+    const std::vector<double> half{1.0, 2.5, 2.5, 4.0};
+    REQUIRE(std::equal(half.begin(), half.end(), A.begin()));
+
+    Mat<double> N(std::vector<double>{0, 1, 2, 3, 4, 5, 6, 7, 8}, 3);
+    N.view() = N.transposed();
+    const std::vector<double> nt{0, 3, 6, 1, 4, 7, 2, 5, 8};
+    REQUIRE(std::equal(nt.begin(), nt.end(), N.begin()));
+
+    // a block shifted over itself reorders too
+    Mat<double> S = counting<Mat<double>>(40, 40);
+    S.block(1, 0, 39, 40) = S.block(0, 0, 39, 40);
+    for (index r = 1; r < 40; ++r) REQUIRE(S(r, 7) == 1000.0 * static_cast<double>(r - 1) + 7.0);
+
+    Mat<double> L = counting<Mat<double>>(40, 40);
+    L.view() = L.transposed();
+    REQUIRE(is_transpose(L, counting<Mat<double>>(40, 40)));
+}
+
+TEST_CASE("blocked transpose handles every shape", "[linalg][transpose]") {
+    const std::vector<std::pair<index, index>> shapes = {{1, 1}, {1, 70}, {70, 1}, {31, 33}, {64, 64}, {129, 65},
+                                                         {300, 17}};
+    for (const auto& [rows, cols] : shapes) {
+        const Mat<double> A = counting<Mat<double>>(rows, cols);
+        const Mat<double> T = axiom::linalg::transpose(A);
+        REQUIRE(is_transpose(A, T));
+        const ColMat C = axiom::linalg::transpose<ColMajor>(A);
+        REQUIRE(is_transpose(A, C));
+        const ColMat L = axiom::linalg::to_layout<ColMajor>(A);
+        REQUIRE(is_transpose(L.transposed(), A));
+
+        const Mat<float> Af = counting<Mat<float>>(rows, cols);
+        REQUIRE(is_transpose(Af, axiom::linalg::transpose(Af.view())));
+    }
+
+    // bands on the pool write the same elements
+    const Mat<double> A = counting<Mat<double>>(517, 300);
+    const Mat<double> seq = axiom::linalg::transpose(A);
+    const Mat<double> par = axiom::linalg::transpose(axiom::exec::Parallel{.threads = 4, .min_size = 1}, A);
+    REQUIRE(std::equal(seq.begin(), seq.end(), par.begin()));
+    const ColMat cpar = axiom::linalg::to_layout<ColMajor>(axiom::exec::par, A);
+    REQUIRE(is_transpose(cpar.transposed(), A));
+}
+
+TEST_CASE("square matrices transpose in place", "[linalg][transpose]") {
+    for (const index n : {1, 2, 31, 32, 33, 100}) {
+        Mat<double> A = counting<Mat<double>>(n, n);
+        axiom::linalg::transpose_in_place(A);
+        REQUIRE(is_transpose(A, counting<Mat<double>>(n, n)));
+
+        ColMat C = counting<ColMat>(n, n);
+        axiom::linalg::transpose_in_place(axiom::exec::Parallel{.threads = 3, .min_size = 1}, C);
+        REQUIRE(is_transpose(C, counting<ColMat>(n, n)));
+    }
+
+    // a square block of a larger matrix, the rest is untouched
+    Mat<double> A = counting<Mat<double>>(6, 8);
+    axiom::linalg::transpose_in_place(A.block(1, 2, 4, 4));
+    REQUIRE(A(1, 3) == 2002.0);
+    REQUIRE(A(3, 2) == 1004.0);
+    REQUIRE(A(0, 3) == 3.0);
+    REQUIRE(A(5, 7) == 5007.0);
+
+    Mat<double> wide(3, 5);
+    REQUIRE_THROWS_AS(axiom::linalg::transpose_in_place(wide), axiom::core::Error);
+}
\ No newline at end of file
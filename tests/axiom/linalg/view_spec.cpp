@@ -0,0 +1,177 @@
+#include <catch2/catch_test_macros.hpp>
+#include "catch2/catch_approx.hpp"
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "axiom/core/memory.hpp"
+#include "axiom/linalg/ops.hpp"
+
+using axiom::linalg::Mat;
+using axiom::linalg::MatView;
+using axiom::linalg::Vec;
+using axiom::linalg::VecView;
+
+namespace {
+    // 4 x 5 matrix with A(r, c) = 10 * r + c
+    Mat<double> counting() {
+        Mat<double> A(4, 5);
+        for (std::size_t r = 0; r < 4; ++r) {
+            for (std::size_t c = 0; c < 5; ++c) A(r, c) = 10.0 * r + c;
+        }
+        return A;
+    }
+}
+
+TEST_CASE("rows, columns, blocks and segments alias the container", "[linalg][view]") {
+    Mat<double> A = counting();
+
+    const VecView<double> r = A.row(2);
+    REQUIRE(r.size() == 5);
+    REQUIRE(r.contiguous());
+    REQUIRE(r[3] == 23.0);
+
+    const VecView<double> c = A.col(1);
+    REQUIRE(c.size() == 4);
+    REQUIRE(c.stride() == 5);
+    REQUIRE(c[3] == 31.0);
+
+    const MatView<double> B = A.block(1, 2, 2, 3);
+    REQUIRE(B.rows() == 2);
+    REQUIRE(B.cols() == 3);
+    REQUIRE(B(1, 2) == 24.0);
+    REQUIRE(B.col(0)[1] == 22.0);
+
+    const auto batch = A.row_range(2, 2);
+    REQUIRE(batch(0, 0) == 20.0);
+    REQUIRE(batch.rows() == 2);
+
+    Vec<double> v = Vec<double>::ones(6);
+    v.segment(2, 3).fill(5.0);
+    REQUIRE(v[1] == 1.0);
+    REQUIRE(v[4] == 5.0);
+    REQUIRE(v[5] == 1.0);
+
+    // writes land in the matrix, no copies are made
+    A.col(4) *= 2.0;
+    REQUIRE(A(3, 4) == 68.0);
+    A.block(0, 0, 2, 2) = Mat<double>::identity(2);
+    REQUIRE(A(0, 1) == 0.0);
+    REQUIRE(A(1, 1) == 1.0);
+    A.row(3) = A.row(0);
+    REQUIRE(A(3, 4) == 8.0);
+
+    STATIC_REQUIRE(std::is_same_v<decltype(std::as_const(A).row(0)), VecView<const double>>);
+    STATIC_REQUIRE_FALSE(std::is_assignable_v<VecView<const double>&, const VecView<const double>&>);
+}
+
+TEST_CASE("writes from an overlapping, shifted view go through a temporary", "[linalg][view]") {
+    Vec<double> v(std::vector<double>{0.0, 1.0, 2.0, 3.0, 4.0});
+    v.view().segment(1, 4) = v.view().segment(0, 4);
+    REQUIRE(std::ranges::equal(v, std::vector<double>{0.0, 0.0, 1.0, 2.0, 3.0}));
+    v.view().segment(0, 4) += v.view().segment(1, 4);
+    REQUIRE(std::ranges::equal(v, std::vector<double>{0.0, 1.0, 3.0, 5.0, 3.0}));
+    v.view().segment(1, 4) -= 2.0 * v.view().segment(0, 4);
+    REQUIRE(std::ranges::equal(v, std::vector<double>{0.0, 1.0, 1.0, -1.0, -7.0}));
+
+    // a row and a column of a square matrix cross at the diagonal
+    Mat<double> A = Mat<double>::identity(3);
+    A(0, 1) = 2.0;
+    A(0, 2) = 3.0;
+    A.col(0) = A.row(0);
+    REQUIRE(A(0, 0) == 1.0);
+    REQUIRE(A(1, 0) == 2.0);
+    REQUIRE(A(2, 0) == 3.0);
+
+    // the same elements in the same order stay on the direct path
+    v.view() = 2.0 * v.view();
+    REQUIRE(v[4] == -14.0);
+}
+
+TEST_CASE("views reject out of range slices and mismatched writes", "[linalg][view]") {
+    Mat<double> A = counting();
+    REQUIRE_THROWS_AS(A.row(4), axiom::core::Error);
+    REQUIRE_THROWS_AS(A.col(5), axiom::core::Error);
+    REQUIRE_THROWS_AS(A.block(3, 3, 2, 1), axiom::core::Error);
+    REQUIRE_THROWS_AS(A.row(0).segment(4, 2), axiom::core::Error);
+    REQUIRE_THROWS_AS(A.row(0) = A.col(0), axiom::core::Error);
+    REQUIRE_THROWS_AS(A.col(0).at(4), axiom::core::Error);
+}
+
+TEST_CASE("vector ops accept strided views", "[linalg][view]") {
+    const Mat<double> A = counting();
+    const Vec<double> ones = Vec<double>::ones(4);
+
+    REQUIRE(axiom::linalg::dot(A.col(2), ones) == Catch::Approx(2 + 12 + 22 + 32));
+    REQUIRE(axiom::linalg::sum(A.col(0)) == Catch::Approx(60.0));
+    REQUIRE(axiom::linalg::norm(A.col(1), 0) == Catch::Approx(31.0));
+    REQUIRE(axiom::linalg::len_squared(A.col(1)) == Catch::Approx(1 + 121 + 441 + 961));
+    REQUIRE(axiom::linalg::maxCoeff(A.col(3)) == 33.0);
+    REQUIRE(axiom::linalg::argMin(A.row(2)) == 0);
+    REQUIRE(axiom::linalg::distanceSquared(A.col(0), A.col(1)) == Catch::Approx(4.0));
+
+    const Vec<double> m = axiom::linalg::max(A.col(0), A.col(1));
+    REQUIRE(m[2] == 21.0);
+
+    // views are expression leaves
+    const Vec<double> e = A.row(1) - A.row(0);
+    REQUIRE(e[4] == Catch::Approx(10.0));
+    const Mat<double> D = A.block(2, 0, 2, 5) - A.block(0, 0, 2, 5);
+    REQUIRE(D(1, 3) == Catch::Approx(20.0));
+
+    // strided and contiguous paths agree
+    const Vec<double> col(std::vector<double>{3.0, 13.0, 23.0, 33.0});
+    REQUIRE(axiom::linalg::norm(A.col(3), 2) == Catch::Approx(axiom::linalg::norm(col, 2)));
+    REQUIRE(axiom::linalg::norm(A.col(3), 1) == Catch::Approx(axiom::linalg::norm(col, 1)));
+}
+
+TEST_CASE("gemm and gemv run on blocks, minibatches and transposed layouts", "[linalg][view]") {
+    const Mat<double> X = counting();
+    const Mat<double> W = Mat<double>::ones(5, 3);
+
+    // a minibatch of rows times W, written into a block of a larger output
+    Mat<double> Y(6, 6);
+    axiom::linalg::gemm(1.0, X.row_range(1, 2), W, 0.0, Y.block(2, 1, 2, 3));
+    REQUIRE(Y(2, 1) == Catch::Approx(10 + 11 + 12 + 13 + 14));
+    REQUIRE(Y(3, 3) == Catch::Approx(20 + 21 + 22 + 23 + 24));
+    REQUIRE(Y(2, 0) == 0.0);
+    REQUIRE(Y(4, 1) == 0.0);
+
+    // X^T as a column-major view of the same buffer
+    const MatView<const double> Xt(X.data(), 5, 4, 1, 5);
+    const Mat<double> G = axiom::linalg::matmul(Xt, X);
+    REQUIRE(G(1, 2) == Catch::Approx(1 * 2 + 11 * 12 + 21 * 22 + 31 * 32));
+
+    const Vec<double> x(std::vector<double>{1.0, -1.0, 2.0, 0.5});
+    const Vec<double> via_view = axiom::linalg::matvec(Xt, x);
+    const Vec<double> via_t = axiom::linalg::matvec_t(X, x);
+    for (std::size_t j = 0; j < 5; ++j) REQUIRE(via_view[j] == Catch::Approx(via_t[j]));
+
+    // strided x and y take the generic loop and still agree
+    Mat<double> out(5, 2);
+    axiom::linalg::gemv(1.0, Xt, X.col(0), 0.0, out.col(1));
+    const Vec<double> ref = axiom::linalg::matvec(Xt, Vec<double>(X.col(0)));
+    for (std::size_t j = 0; j < 5; ++j) REQUIRE(out(j, 1) == Catch::Approx(ref[j]));
+
+    Mat<double> S = counting();
+    REQUIRE_THROWS_AS(axiom::linalg::gemv(1.0, S.block(0, 0, 2, 2), S.row(3).segment(0, 2), 0.0, S.col(1).segment(0, 2)),
+                      axiom::core::Error);
+    REQUIRE_THROWS_AS(axiom::linalg::gemm(1.0, S.block(0, 0, 2, 2), S.block(2, 0, 2, 2), 0.0, S.block(1, 1, 2, 2)),
+                      axiom::core::Error);
+}
+
+TEST_CASE("slicing a matrix makes no allocations", "[linalg][view]") {
+    const Mat<double> A = counting();
+    Vec<double> y(2);
+    const Vec<double> w = Vec<double>::ones(5);
+
+    axiom::core::reset_memory_stats();
+    double acc = 0.0;
+    for (std::size_t b = 0; b + 2 <= A.rows(); b += 2) {
+        axiom::linalg::gemv(1.0, A.row_range(b, 2), w, 0.0, y);
+        acc += axiom::linalg::sum(y) + axiom::linalg::dot(A.col(0), A.col(1));
+    }
+    REQUIRE(axiom::core::memory_stats().heap_allocations == 0);
+    REQUIRE(acc > 0.0);
+}
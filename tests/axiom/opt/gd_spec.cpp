@@ -0,0 +1,189 @@
+#include <catch2/catch_test_macros.hpp>
+#include "catch2/catch_approx.hpp"
+#include <random>
+#include <span>
+#include <vector>
+
+#include "axiom/core/memory.hpp"
+#include "axiom/linalg/decomposition.hpp"
+#include "axiom/opt/gd.hpp"
+
+using axiom::linalg::Mat;
+using axiom::linalg::Vec;
+using axiom::linalg::VecView;
+using axiom::opt::GdOptions;
+using axiom::opt::GradientDescent;
+using axiom::opt::StopReason;
+using axiom::opt::UpdateRule;
+
+namespace {
+    // least squares, f_i(x) = 1/2 (a_i . x - b_i)^2 over the rows of A
+    struct Regression {
+        Mat<double> A;
+        Vec<double> b;
+
+        Regression(const std::size_t samples, const std::size_t dim, const unsigned seed) : A(samples, dim), b(samples) {
+            std::mt19937 rng(seed);
+            std::normal_distribution<double> dist(0.0, 1.0);
+            for (std::size_t i = 0; i < samples; ++i) {
+                double target = 0.0;
+                for (std::size_t j = 0; j < dim; ++j) {
+                    A(i, j) = dist(rng);
+                    target += (static_cast<double>(j) - 1.0) * A(i, j);
+                }
+                b[i] = target + 0.1 * dist(rng);
+            }
+        }
+
+        double operator()(const Vec<double>& x, const std::span<const std::size_t> samples, VecView<double> grad) const {
+            double loss = 0.0;
+            for (const std::size_t i : samples) {
+                const double r = axiom::linalg::dot(A.row(i), x) - b[i];
+                loss += 0.5 * r * r;
+                grad += r * A.row(i);
+            }
+            return loss;
+        }
+    };
+}
+
+TEST_CASE("full-batch gradient descent reaches the least-squares solution", "[opt][gd]") {
+    const Regression problem(200, 5, 1);
+    const Vec<double> best = axiom::linalg::lstsq(problem.A, problem.b);
+
+    GdOptions options;
+    options.learning_rate = 0.5;
+    options.max_iterations = 5000;
+    options.grad_tol = 1e-10;
+    GradientDescent<double> gd(5, 200, options);
+    Vec<double> x(5);
+    const auto result = gd.minimize(problem, x);
+
+    REQUIRE(result.converged());
+    REQUIRE(result.reason == StopReason::kGradientTolerance);
+    REQUIRE(result.grad_norm <= 1e-10);
+    REQUIRE(result.iterations == result.epochs);
+    for (std::size_t j = 0; j < 5; ++j) REQUIRE(x[j] == Catch::Approx(best[j]).margin(1e-8));
+}
+
+TEST_CASE("momentum, Nesterov and Adam converge in mini-batch mode", "[opt][gd]") {
+    const Regression problem(400, 4, 2);
+    const Vec<double> best = axiom::linalg::lstsq(problem.A, problem.b);
+
+    for (const auto rule : {UpdateRule::kPlain, UpdateRule::kMomentum, UpdateRule::kNesterov, UpdateRule::kAdam}) {
+        GdOptions options;
+        options.rule = rule;
+        options.batch_size = 400;
+        options.learning_rate = rule == UpdateRule::kAdam ? 0.05 : 0.1;
+        options.max_iterations = 4000;
+        options.grad_tol = 1e-9;
+        GradientDescent<double> full(4, 400, options);
+        Vec<double> x(4);
+        REQUIRE(full.minimize(problem, x).converged());
+        for (std::size_t j = 0; j < 4; ++j) REQUIRE(x[j] == Catch::Approx(best[j]).margin(1e-6));
+
+        // noisy mini-batches land close to the optimum
+        options.batch_size = 16;
+        options.learning_rate = rule == UpdateRule::kAdam ? 0.01 : 0.02;
+        options.max_iterations = 3000;
+        options.grad_tol = 0.0;
+        GradientDescent<double> mini(4, 400, options);
+        Vec<double> y(4);
+        const auto result = mini.minimize(problem, y);
+        REQUIRE(result.iterations == 3000);
+        REQUIRE(result.epochs == 3000 / 25);
+        for (std::size_t j = 0; j < 4; ++j) REQUIRE(y[j] == Catch::Approx(best[j]).margin(0.05));
+    }
+}
+
+TEST_CASE("sharded gradients are reduced deterministically", "[opt][gd]") {
+    const Regression problem(301, 6, 3);
+    GdOptions options;
+    options.batch_size = 37;
+    options.shards = 5;
+    options.rule = UpdateRule::kMomentum;
+    options.max_iterations = 200;
+    options.grad_tol = 0.0;
+    options.seed = 11;
+
+    Vec<double> serial(6);
+    GradientDescent<double>(6, 301, options).minimize(problem, serial);
+    options.policy.threads = 3;
+    Vec<double> parallel(6);
+    GradientDescent<double>(6, 301, options).minimize(problem, parallel);
+    for (std::size_t j = 0; j < 6; ++j) REQUIRE(serial[j] == parallel[j]);
+
+    // SGD visits one sample per step
+    options.batch_size = 1;
+    options.policy.threads = 1;
+    options.max_iterations = 301 * 2;
+    Vec<double> sgd(6);
+    const auto result = GradientDescent<double>(6, 301, options).minimize(problem, sgd);
+    REQUIRE(result.epochs == 2);
+}
+
+TEST_CASE("the gradient descent loop does not allocate", "[opt][gd]") {
+    const Regression problem(256, 8, 4);
+    GdOptions options;
+    options.rule = UpdateRule::kAdam;
+    options.batch_size = 32;
+    options.shards = 4;
+    options.max_iterations = 500;
+    options.grad_tol = 0.0;
+    options.loss_tol = 1e-12;
+    GradientDescent<double> gd(8, 256, options);
+    Vec<double> x(8);
+
+    axiom::core::reset_memory_stats();
+    const auto result = gd.minimize(problem, x);
+    REQUIRE(axiom::core::memory_stats().heap_allocations == 0);
+    REQUIRE(axiom::core::memory_stats().arena_allocations == 0);
+    REQUIRE(result.iterations > 0);
+}
+
+TEST_CASE("step and loss tolerances stop early, bad options are rejected", "[opt][gd]") {
+    const Regression problem(100, 3, 5);
+    GdOptions options;
+    options.learning_rate = 0.3;
+    options.grad_tol = 0.0;
+    options.step_tol = 1e-6;
+    Vec<double> x(3);
+    auto result = GradientDescent<double>(3, 100, options).minimize(problem, x);
+    REQUIRE(result.reason == StopReason::kStepTolerance);
+    REQUIRE(result.iterations < options.max_iterations);
+
+    options.step_tol = 0.0;
+    options.loss_tol = 1e-10;
+    Vec<double> y(3);
+    result = GradientDescent<double>(3, 100, options).minimize(problem, y);
+    REQUIRE(result.reason == StopReason::kLossTolerance);
+
+    REQUIRE_THROWS_AS(GradientDescent<double>(3, 0), axiom::core::Error);
+    options.batch_size = 101;
+    REQUIRE_THROWS_AS(GradientDescent<double>(3, 100, options), axiom::core::Error);
+    GradientDescent<double> gd(3, 100);
+    Vec<double> wrong(4);
+    REQUIRE_THROWS_AS(gd.minimize(problem, wrong), axiom::core::Error);
+}
+
+TEST_CASE("an epoch cut short reports the mean loss of the samples it saw", "[opt][gd]") {
+    // every sample has loss 1 and no gradient, so any mean over seen samples is 1
+    const auto flat = [](const Vec<double>&, const std::span<const std::size_t> samples, VecView<double>) {
+        return static_cast<double>(samples.size());
+    };
+    GdOptions options;
+    options.batch_size = 10;
+    options.grad_tol = 0.0;
+    options.step_tol = 1e-12;
+    Vec<double> x(2);
+    auto result = GradientDescent<double>(2, 100, options).minimize(flat, x);
+    REQUIRE(result.reason == StopReason::kStepTolerance);
+    REQUIRE(result.iterations == 1);
+    REQUIRE(result.loss == Catch::Approx(1.0));
+
+    options.step_tol = 0.0;
+    options.max_iterations = 3;
+    result = GradientDescent<double>(2, 100, options).minimize(flat, x);
+    REQUIRE(result.iterations == 3);
+    REQUIRE(result.loss == Catch::Approx(1.0));
+}
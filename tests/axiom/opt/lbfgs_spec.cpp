@@ -0,0 +1,244 @@
+#include <catch2/catch_test_macros.hpp>
+#include "catch2/catch_approx.hpp"
+#include <cmath>
+#include <vector>
+
+#include "axiom/core/memory.hpp"
+#include "axiom/opt/lbfgs.hpp"
+
+using axiom::linalg::Vec;
+using axiom::opt::Backtracking;
+using axiom::opt::Lbfgs;
+using axiom::opt::LbfgsOptions;
+using axiom::opt::StopReason;
+using axiom::opt::StrongWolfe;
+
+namespace {
+    // extended Rosenbrock, minimum at x = 1
+    struct Rosenbrock {
+        std::size_t calls = 0;
+
+        double operator()(const Vec<double>& x, Vec<double>& g) {
+            ++calls;
+            double f = 0.0;
+            g.fill(0.0);
+            for (std::size_t i = 0; i + 1 < x.size(); i += 2) {
+                const double a = x[i + 1] - x[i] * x[i], b = 1.0 - x[i];
+                f += 100.0 * a * a + b * b;
+                g[i] += -400.0 * a * x[i] - 2.0 * b;
+                g[i + 1] += 200.0 * a;
+            }
+            return f;
+        }
+    };
+
+    // f(x) = 1/2 sum_i (i + 1)^2 (x_i - c_i)^2, condition number n^2
+    struct Quadratic {
+        Vec<double> center;
+
+        double operator()(const Vec<double>& x, Vec<double>& g) const {
+            double f = 0.0;
+            for (std::size_t i = 0; i < x.size(); ++i) {
+                const double w = static_cast<double>((i + 1) * (i + 1)), r = x[i] - center[i];
+                g[i] = w * r;
+                f += 0.5 * w * r * r;
+            }
+            return f;
+        }
+    };
+
+    // 1-d double well f(x) = x^4 / 4 - x^2 / 2, concave on |x| < 1 / sqrt(3)
+    double double_well(const Vec<double>& x, Vec<double>& g) {
+        g[0] = x[0] * x[0] * x[0] - x[0];
+        return 0.25 * x[0] * x[0] * x[0] * x[0] - 0.5 * x[0] * x[0];
+    }
+
+    // moves to scripted points and records the direction of every search
+    struct ScriptedSearch {
+        std::vector<double> targets;
+        std::vector<double> directions;
+
+        template <typename F>
+        axiom::opt::LineSearchResult<double> search(F& fg, Vec<double>& x, double& f, Vec<double>& g,
+                                                    const Vec<double>& d, double) {
+            const double from = x[0], to = targets[directions.size()];
+            directions.push_back(d[0]);
+            x[0] = to;
+            f = fg(x, g);
+            return {axiom::opt::LineSearchStatus::kConverged, (to - from) / d[0], 1, 1};
+        }
+    };
+
+    Vec<double> start(const std::size_t n) {
+        Vec<double> x(n);
+        for (std::size_t i = 0; i < n; ++i) x[i] = i % 2 == 0 ? -1.2 : 1.0;
+        return x;
+    }
+}
+
+TEST_CASE("Lbfgs minimizes Rosenbrock with every line search", "[opt][lbfgs]") {
+    LbfgsOptions options;
+    options.grad_tol = 1e-8;
+
+    Rosenbrock fg;
+    Vec<double> x = start(10);
+    Lbfgs<double> mt(10, options);
+    const auto r = mt.minimize(fg, x);
+    REQUIRE(r.reason == StopReason::kGradientTolerance);
+    REQUIRE(r.converged());
+    REQUIRE(r.iterations < 200);
+    REQUIRE(r.f_evals == fg.calls);
+    for (std::size_t i = 0; i < x.size(); ++i) REQUIRE(x[i] == Catch::Approx(1.0).margin(1e-6));
+
+    Vec<double> xw = start(10);
+    Lbfgs<double, StrongWolfe<double>> wolfe(10, options);
+    REQUIRE(wolfe.minimize(Rosenbrock{}, xw).converged());
+    for (std::size_t i = 0; i < xw.size(); ++i) REQUIRE(xw[i] == Catch::Approx(1.0).margin(1e-6));
+
+    // Armijo only, pairs that break s.y > 0 are skipped
+    Vec<double> xb = start(10);
+    Lbfgs<double, Backtracking<double>> armijo(10, options);
+    const auto rb = armijo.minimize(Rosenbrock{}, xb);
+    REQUIRE(rb.converged());
+    for (std::size_t i = 0; i < xb.size(); ++i) REQUIRE(xb[i] == Catch::Approx(1.0).margin(1e-5));
+}
+
+TEST_CASE("Lbfgs history handles ill-conditioned quadratics", "[opt][lbfgs]") {
+    constexpr std::size_t n = 50;
+    Quadratic fg{Vec<double>(n)};
+    for (std::size_t i = 0; i < n; ++i) fg.center[i] = std::sin(static_cast<double>(i));
+
+    LbfgsOptions options;
+    options.grad_tol = 1e-9;
+    options.max_iterations = 2000;
+
+    options.history = 1;
+    Vec<double> x1(n);
+    const auto r1 = Lbfgs<double>(n, options).minimize(fg, x1);
+    REQUIRE(r1.converged());
+
+    // the ring buffer wraps many times over
+    options.history = 5;
+    Vec<double> x5(n);
+    const auto r5 = Lbfgs<double>(n, options).minimize(fg, x5);
+    REQUIRE(r5.converged());
+    REQUIRE(r5.iterations > 5);
+    REQUIRE(r5.iterations < r1.iterations);
+    for (std::size_t i = 0; i < n; ++i) REQUIRE(x5[i] == Catch::Approx(fg.center[i]).margin(1e-8));
+
+    options.history = 20;
+    Vec<double> x20(n);
+    const auto r20 = Lbfgs<double>(n, options).minimize(fg, x20);
+    REQUIRE(r20.converged());
+    REQUIRE(r20.iterations <= r5.iterations);
+}
+
+TEST_CASE("Lbfgs minimize does not allocate", "[opt][lbfgs]") {
+    Rosenbrock fg;
+    Lbfgs<double> opt(8);
+    Vec<double> x = start(8);
+    axiom::core::reset_memory_stats();
+    const auto r = opt.minimize(fg, x);
+    REQUIRE(r.converged());
+    REQUIRE(axiom::core::memory_stats().heap_allocations == 0);
+    REQUIRE(opt.line_search().stats().searches > 0);
+}
+
+TEST_CASE("Lbfgs stopping rules", "[opt][lbfgs]") {
+    Rosenbrock fg;
+    LbfgsOptions options;
+    options.max_iterations = 3;
+    Vec<double> x = start(4);
+    const auto r = Lbfgs<double>(4, options).minimize(fg, x);
+    REQUIRE(r.reason == StopReason::kMaxIterations);
+    REQUIRE(r.iterations == 3);
+    REQUIRE_FALSE(r.converged());
+    REQUIRE(r.loss < 24.2 * 2);
+
+    options.max_iterations = 500;
+    options.grad_tol = 0.0;
+    options.loss_tol = 1e-10;
+    Vec<double> xl = start(4);
+    const auto rl = Lbfgs<double>(4, options).minimize(fg, xl);
+    REQUIRE(rl.reason == StopReason::kLossTolerance);
+    REQUIRE(rl.loss < 1e-8);
+
+    // already optimal
+    Vec<double> ones = Vec<double>::ones(4);
+    const auto r0 = Lbfgs<double>(4).minimize(fg, ones);
+    REQUIRE(r0.iterations == 0);
+    REQUIRE(r0.reason == StopReason::kGradientTolerance);
+}
+
+TEST_CASE("Lbfgs box constraints", "[opt][lbfgs]") {
+    constexpr std::size_t n = 6;
+    Quadratic fg{Vec<double>(std::vector<double>{2.0, -3.0, 0.5, 4.0, -0.25, 1.0})};
+    const Vec<double> upper = Vec<double>::ones(n), lower = -1.0 * upper;
+
+    LbfgsOptions options;
+    options.grad_tol = 1e-10;
+    Lbfgs<double> opt(n, options);
+    opt.set_bounds(lower, upper);
+
+    // starts outside the box, the solution is the center clamped onto it
+    Vec<double> x = 5.0 * upper;
+    const auto r = opt.minimize(fg, x);
+    REQUIRE(r.converged());
+    for (std::size_t i = 0; i < n; ++i) {
+        REQUIRE(x[i] >= -1.0);
+        REQUIRE(x[i] <= 1.0);
+        REQUIRE(x[i] == Catch::Approx(axiom::core::clamp(-1.0, 1.0, fg.center[i])).margin(1e-9));
+    }
+
+    // Rosenbrock with x_0 <= 0.5 ends on the bound with x_1 = x_0^2
+    Lbfgs<double> rosen(2, options);
+    rosen.set_bounds(Vec<double>(std::vector<double>{-2.0, -2.0}), Vec<double>(std::vector<double>{0.5, 2.0}));
+    Vec<double> xr = start(2);
+    const auto rr = rosen.minimize(Rosenbrock{}, xr);
+    REQUIRE(rr.converged());
+    REQUIRE(xr[0] == Catch::Approx(0.5));
+    REQUIRE(xr[1] == Catch::Approx(0.25).margin(1e-8));
+    REQUIRE(rr.grad_norm <= 1e-10);
+
+    // dropping the bounds recovers the unconstrained minimum
+    opt.clear_bounds();
+    Vec<double> xf(n);
+    REQUIRE(opt.minimize(fg, xf).converged());
+    for (std::size_t i = 0; i < n; ++i) REQUIRE(xf[i] == Catch::Approx(fg.center[i]).margin(1e-9));
+}
+
+TEST_CASE("Lbfgs keeps the stored pair when a new one fails the curvature test", "[opt][lbfgs]") {
+    LbfgsOptions options;
+    options.history = 1;
+    options.max_iterations = 3;
+    options.grad_tol = 0.0;
+
+    // 2 -> 0.5 crosses the convex part (s.y > 0, stored and filling the history), 0.5 -> 0.55
+    // stays in the concave part (s.y < 0, rejected)
+    Lbfgs<double, ScriptedSearch> opt(1, options, ScriptedSearch{{0.5, 0.55, 0.6}, {}});
+    Vec<double> x(std::vector<double>{2.0});
+    opt.minimize(double_well, x);
+    const auto& dirs = opt.line_search().directions;
+    REQUIRE(dirs.size() == 3);
+
+    // in 1-d one pair gives H = s / y, the third direction must still come from 2 -> 0.5
+    Vec<double> g0(1), g1(1), g2(1);
+    double_well(Vec<double>(std::vector<double>{2.0}), g0);
+    double_well(Vec<double>(std::vector<double>{0.5}), g1);
+    double_well(Vec<double>(std::vector<double>{0.55}), g2);
+    const double h = (0.5 - 2.0) / (g1[0] - g0[0]);
+    REQUIRE(dirs[1] == Catch::Approx(-h * g1[0]));
+    REQUIRE(dirs[2] == Catch::Approx(-h * g2[0]));
+}
+
+TEST_CASE("Lbfgs argument checks", "[opt][lbfgs]") {
+    LbfgsOptions options;
+    options.history = 0;
+    REQUIRE_THROWS_AS(Lbfgs<double>(4, options), axiom::core::Error);
+
+    Lbfgs<double> opt(4);
+    Vec<double> x(3);
+    REQUIRE_THROWS_AS(opt.minimize(Rosenbrock{}, x), axiom::core::Error);
+    REQUIRE_THROWS_AS(opt.set_bounds(Vec<double>(3), Vec<double>(4)), axiom::core::Error);
+    REQUIRE_THROWS_AS(opt.set_bounds(Vec<double>::ones(4), Vec<double>::zeros(4)), axiom::core::Error);
+}
\ No newline at end of file
@@ -0,0 +1,143 @@
+#include <catch2/catch_test_macros.hpp>
+#include "catch2/catch_approx.hpp"
+#include <cmath>
+
+#include "axiom/core/memory.hpp"
+#include "axiom/opt/linsearch.hpp"
+
+using axiom::linalg::Vec;
+using axiom::opt::Backtracking;
+using axiom::opt::LineSearchOptions;
+using axiom::opt::LineSearchStatus;
+using axiom::opt::MoreThuente;
+using axiom::opt::StrongWolfe;
+
+namespace {
+    // extended Rosenbrock, counting every call
+    struct Rosenbrock {
+        std::size_t calls = 0;
+
+        double operator()(const Vec<double>& x, Vec<double>& g) {
+            ++calls;
+            double f = 0.0;
+            g.fill(0.0);
+            for (std::size_t i = 0; i + 1 < x.size(); i += 2) {
+                const double a = x[i + 1] - x[i] * x[i], b = 1.0 - x[i];
+                f += 100.0 * a * a + b * b;
+                g[i] += -400.0 * a * x[i] - 2.0 * b;
+                g[i + 1] += 200.0 * a;
+            }
+            return f;
+        }
+    };
+
+    // f(x) = scale / 2 |x|^2
+    struct Bowl {
+        double scale;
+        std::size_t calls = 0;
+
+        double operator()(const Vec<double>& x, Vec<double>& g) {
+            ++calls;
+            g = scale * x;
+            return 0.5 * scale * axiom::linalg::dot(x, x);
+        }
+    };
+
+    Vec<double> start(const std::size_t n) {
+        Vec<double> x(n);
+        for (std::size_t i = 0; i < n; ++i) x[i] = i % 2 == 0 ? -1.2 : 1.0;
+        return x;
+    }
+
+    template <typename Search>
+    void check_wolfe(Search& search, const double c1, const double c2) {
+        Rosenbrock fg;
+        Vec<double> x = start(6), g(6);
+        double f = fg(x, g);
+        for (int it = 0; it < 5; ++it) {
+            const Vec<double> d = -1.0 * g;
+            const double f0 = f, slope0 = axiom::linalg::dot(g, d);
+            const std::size_t before = fg.calls;
+            const auto r = search.search(fg, x, f, g, d, it == 0 ? 1e-3 : 1.0);
+            REQUIRE(r.converged());
+            REQUIRE(f <= f0 + c1 * r.step * slope0);
+            REQUIRE(std::abs(axiom::linalg::dot(g, d)) <= c2 * std::abs(slope0) + 1e-12);
+            // x, f and g belong together and every call was counted
+            REQUIRE(fg.calls - before == r.f_evals);
+            Vec<double> check(6);
+            Rosenbrock fresh;
+            REQUIRE(fresh(x, check) == f);
+            for (std::size_t i = 0; i < 6; ++i) REQUIRE(check[i] == g[i]);
+        }
+    }
+}
+
+TEST_CASE("strong Wolfe and More-Thuente steps satisfy the strong Wolfe conditions", "[opt][linsearch]") {
+    StrongWolfe<double> wolfe(6);
+    check_wolfe(wolfe, 1e-4, 0.9);
+    MoreThuente<double> mt(6);
+    check_wolfe(mt, 1e-4, 0.9);
+
+    LineSearchOptions tight;
+    tight.c2 = 0.1;
+    StrongWolfe<double> tight_wolfe(6, tight);
+    check_wolfe(tight_wolfe, 1e-4, 0.1);
+    MoreThuente<double> tight_mt(6, tight);
+    check_wolfe(tight_mt, 1e-4, 0.1);
+    REQUIRE(tight_mt.stats().searches == 5);
+    REQUIRE(tight_mt.stats().f_evals == tight_mt.stats().g_evals);
+}
+
+TEST_CASE("backtracking interpolates instead of halving", "[opt][linsearch]") {
+    // the quadratic fit is exact on a bowl, a step 5x too long is fixed by one extra evaluation
+    // where halving would need three
+    Bowl fg{100.0};
+    Vec<double> x = Vec<double>::ones(4), g(4);
+    double f = fg(x, g);
+    const Vec<double> d = -1.0 * g;
+    Backtracking<double> armijo(4);
+    const auto r = armijo.search(fg, x, f, g, d, 0.05);
+    REQUIRE(r.converged());
+    REQUIRE(r.f_evals == 2);
+    REQUIRE(r.step == Catch::Approx(0.01));
+    REQUIRE(f == Catch::Approx(0.0).margin(1e-20));
+
+    // cubic steps on Rosenbrock still only need a handful of evaluations
+    Rosenbrock rb;
+    Vec<double> y = start(6), gy(6);
+    double fy = rb(y, gy);
+    const double f0 = fy;
+    const Vec<double> dy = -1.0 * gy;
+    Backtracking<double> armijo6(6);
+    const auto rr = armijo6.search(rb, y, fy, gy, dy, 1.0);
+    REQUIRE(rr.converged());
+    REQUIRE(fy <= f0 + 1e-4 * rr.step * -axiom::linalg::dot(dy, dy));
+    REQUIRE(rr.f_evals < 8);
+    REQUIRE(armijo6.stats().f_evals == rr.f_evals);
+}
+
+TEST_CASE("line searches reuse their workspace and leave x alone when they fail", "[opt][linsearch]") {
+    Rosenbrock fg;
+    Vec<double> x = start(8), g(8);
+    double f = fg(x, g);
+    MoreThuente<double> mt(8);
+    Vec<double> d(8);
+    axiom::core::reset_memory_stats();
+    for (int it = 0; it < 20; ++it) {
+        d = -1.0 * g;
+        (void)mt.search(fg, x, f, g, d);
+    }
+    REQUIRE(axiom::core::memory_stats().heap_allocations == 0);
+    REQUIRE(fg.calls == mt.stats().f_evals + 1);
+
+    const Vec<double> before = x;
+    const double f_before = f;
+    const auto r = mt.search(fg, x, f, g, g);
+    REQUIRE(r.status == LineSearchStatus::kNotDescent);
+    REQUIRE_FALSE(r.moved());
+    REQUIRE(f == f_before);
+    for (std::size_t i = 0; i < 8; ++i) REQUIRE(x[i] == before[i]);
+
+    REQUIRE_THROWS_AS(mt.search(fg, x, f, g, Vec<double>(3)), axiom::core::Error);
+    REQUIRE_THROWS_AS(mt.search(fg, x, f, g, d, 0.0), axiom::core::Error);
+}
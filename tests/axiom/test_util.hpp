@@ -0,0 +1,75 @@
+#ifndef AXIOM_TEST_UTIL_HPP
+#define AXIOM_TEST_UTIL_HPP
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "axiom/core/cpu.hpp"
+#include "axiom/linalg/mat.hpp"
+#include "axiom/linalg/vec.hpp"
+
+namespace axiom::test {
+/*
+ * helpers shared by the specs:
+ * - random_vec / random_mat fill with uniform values in [-1, 1) from a seeded std::mt19937, so a
+ *   failing case reproduces with the same seed
+ * - for_each_isa(body) runs body once per ISA up to the detected one (scalar, sse2, avx2,
+ *   avx512), with the ISA in the failure message, and restores the active ISA afterwards
+ * - TempFile names a scratch file and removes it when the test leaves
+ * - rosenbrock(x) is generic in the scalar, the same code runs on double, ad::Dual and ad::Var
+ */
+
+    template <typename T>
+    linalg::Vec<T> random_vec(const std::size_t n, const unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<T> dist(T{-1}, T{1});
+        std::vector<T> data(n);
+        for (auto& x : data) x = dist(rng);
+        return linalg::Vec<T>(std::move(data));
+    }
+
+    template <typename T>
+    linalg::Mat<T> random_mat(const std::size_t rows, const std::size_t cols, const unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<T> dist(T{-1}, T{1});
+        std::vector<T> data(rows * cols);
+        for (auto& x : data) x = dist(rng);
+        return linalg::Mat<T>(std::move(data), cols);
+    }
+
+    template <typename F>
+    void for_each_isa(F body) {
+        using core::Isa;
+        const Isa saved = core::active_isa();
+        for (const Isa isa : {Isa::kScalar, Isa::kSse2, Isa::kAvx2, Isa::kAvx512}) {
+            if (isa > core::detected_isa()) break;
+            core::set_active_isa(isa);
+            INFO("isa: " << core::isa_name(isa));
+            body();
+        }
+        core::set_active_isa(saved);
+    }
+
+    template <typename S>
+    S rosenbrock(const linalg::Vec<S>& x) {
+        S f{};
+        for (std::size_t i = 0; i + 1 < x.size(); ++i) {
+            const S a = x[i + 1] - x[i] * x[i];
+            const S b = 1.0 - x[i];
+            f += 100.0 * a * a + b * b;
+        }
+        return f;
+    }
+
+    struct TempFile {
+        std::string path;
+        explicit TempFile(std::string name) : path(std::move(name)) {}
+        ~TempFile() { std::remove(path.c_str()); }
+    };
+}
+
+#endif //AXIOM_TEST_UTIL_HPP
\ No newline at end of file